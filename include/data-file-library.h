@@ -16,8 +16,19 @@
 #define DATA_FILE_LIBRARY_H
 
 #include "data-file-library/version.h"
+#include "data-file-library/core/arena.h"
+#include "data-file-library/core/arrowdat.h"
+#include "data-file-library/core/async.h"
+#include "data-file-library/core/cache.h"
+#include "data-file-library/core/convert.h"
+#include "data-file-library/core/follow.h"
+#include "data-file-library/core/sparse.h"
 #include "data-file-library/core/tsvdat.h"
 #include "data-file-library/core/csvdat.h"
+#include "data-file-library/core/dsvdat.h"
+#include "data-file-library/core/fwfdat.h"
+#include "data-file-library/core/mtxdat.h"
 #include "data-file-library/core/wldat.h"
+#include "data-file-library/core/zarrdat.h"
 
 #endif /* DATA_FILE_LIBRARY_H */
\ No newline at end of file
@@ -0,0 +1,336 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library.hpp
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C++17
+    License: include/data-file-library/license.txt
+
+    Description:
+        C++17 layer over the core functions of the include/data-file-library
+        folder. The owning types dfl::Tensor<T, Rank> and dfl::Matrix<T>
+        keep the data in row-major order, the import functions return them by
+        value (moved, never copied), and the export functions accept
+        non-owning dfl::View<const T> views. The element type T may be double
+        or std::complex<double>, and both are served by the same templates.
+*/
+
+#ifndef DATA_FILE_LIBRARY_HPP
+#define DATA_FILE_LIBRARY_HPP
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "data-file-library.h"
+
+namespace dfl {
+
+/*
+    Non-owning view of a contiguous array, in the spirit of std::span.
+*/
+template <class T>
+class View {
+public:
+    constexpr View() noexcept : data_(nullptr), size_(0) {}
+    constexpr View(T *data, std::size_t size) noexcept
+        : data_(data), size_(size) {}
+    template <class Container, class = decltype(
+        std::declval<Container &>().data())>
+    constexpr View(Container &c) noexcept : data_(c.data()), size_(c.size()) {}
+
+    constexpr T *data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr T *begin() const noexcept { return data_; }
+    constexpr T *end() const noexcept { return data_ + size_; }
+    constexpr T &operator[](std::size_t i) const { return data_[i]; }
+
+private:
+    T *data_;
+    std::size_t size_;
+};
+
+/*
+    Owning N-dimensional array of Rank dimensions following the row-major
+    order. The element at indices (i1, ..., iN) may be accessed through
+    t(i1, ..., iN).
+*/
+template <class T, std::size_t Rank>
+class Tensor {
+    static_assert(Rank >= 1, "dfl::Tensor requires Rank >= 1");
+
+public:
+    using value_type = T;
+    using shape_type = std::array<std::size_t, Rank>;
+
+    Tensor() { shape_.fill(0); }
+    explicit Tensor(const shape_type &shape)
+        : shape_(shape), data_(element_count(shape)) {}
+
+    Tensor(const Tensor &) = default;
+    Tensor(Tensor &&) noexcept = default;
+    Tensor &operator=(const Tensor &) = default;
+    Tensor &operator=(Tensor &&) noexcept = default;
+
+    static constexpr std::size_t rank() noexcept { return Rank; }
+    const shape_type &shape() const noexcept { return shape_; }
+    std::size_t extent(std::size_t d) const { return shape_[d]; }
+    std::size_t size() const noexcept { return data_.size(); }
+
+    T *data() noexcept { return data_.data(); }
+    const T *data() const noexcept { return data_.data(); }
+    T *begin() noexcept { return data_.data(); }
+    T *end() noexcept { return data_.data() + data_.size(); }
+    const T *begin() const noexcept { return data_.data(); }
+    const T *end() const noexcept { return data_.data() + data_.size(); }
+
+    View<T> view() noexcept { return View<T>(data(), size()); }
+    View<const T> view() const noexcept {
+        return View<const T>(data(), size());
+    }
+
+    template <class... Index>
+    T &operator()(Index... indices) {
+        return data_[flat_index(indices...)];
+    }
+    template <class... Index>
+    const T &operator()(Index... indices) const {
+        return data_[flat_index(indices...)];
+    }
+
+private:
+    static std::size_t element_count(const shape_type &shape) {
+        std::size_t n = 1;
+        for (std::size_t s : shape) n *= s;
+        return n;
+    }
+
+    template <class... Index>
+    std::size_t flat_index(Index... indices) const {
+        static_assert(sizeof...(Index) == Rank,
+            "dfl::Tensor: number of indices must match Rank");
+        const std::size_t idx[Rank] = {static_cast<std::size_t>(indices)...};
+        std::size_t flat = 0;
+        for (std::size_t d = 0; d < Rank; d++) {
+            flat = idx[d] + shape_[d] * flat;
+        }
+        return flat;
+    }
+
+    shape_type shape_;
+    std::vector<T> data_;
+};
+
+/*
+    Owning two-dimensional array (rows, columns) in row-major order.
+*/
+template <class T>
+using Matrix = Tensor<T, 2>;
+
+namespace detail {
+
+template <class T>
+constexpr void check_element_type() {
+    static_assert(std::is_same_v<T, double> ||
+        std::is_same_v<T, std::complex<double>>,
+        "dfl: element type must be double or std::complex<double>");
+}
+
+inline int to_int(std::size_t n, const char *what) {
+    if (n > static_cast<std::size_t>(2147483647)) {
+        throw std::length_error(std::string("dfl: ") + what +
+            " exceeds the range of int");
+    }
+    return static_cast<int>(n);
+}
+
+/* Selects the tsvdat_* or csvdat_* functions */
+enum class Sep { csv, tsv };
+
+template <class T>
+Matrix<T> sep_import(const std::string &file_path, Sep sep) {
+    check_element_type<T>();
+    int rows = 0, columns = 0;
+    if (sep == Sep::csv) {
+        csvdat_get_sizes(file_path.c_str(), &rows, &columns);
+    } else {
+        tsvdat_get_sizes(file_path.c_str(), &rows, &columns);
+    }
+    Matrix<T> m({static_cast<std::size_t>(rows),
+        static_cast<std::size_t>(columns)});
+    if (m.size() == 0) return m;
+    if constexpr (std::is_same_v<T, double>) {
+        if (sep == Sep::csv) csvdat_import(file_path.c_str(), m.data());
+        else tsvdat_import(file_path.c_str(), m.data());
+    } else {
+        if (sep == Sep::csv) csvdat_import_cplx(file_path.c_str(), m.data());
+        else tsvdat_import_cplx(file_path.c_str(), m.data());
+    }
+    return m;
+}
+
+template <class T>
+void sep_export(const std::string &file_path, View<const T> data,
+    std::size_t rows, std::size_t columns, Sep sep) {
+    check_element_type<T>();
+    if (data.size() < rows * columns) {
+        throw std::length_error("dfl: view smaller than rows*columns");
+    }
+    int r = to_int(rows, "rows"), c = to_int(columns, "columns");
+    if constexpr (std::is_same_v<T, double>) {
+        if (sep == Sep::csv) {
+            csvdat_export(file_path.c_str(), data.data(), r, c);
+        } else {
+            tsvdat_export(file_path.c_str(), data.data(), r, c);
+        }
+    } else {
+        if (sep == Sep::csv) {
+            csvdat_export_cplx(file_path.c_str(), data.data(), r, c);
+        } else {
+            tsvdat_export_cplx(file_path.c_str(), data.data(), r, c);
+        }
+    }
+}
+
+} /* namespace detail */
+
+/*
+    Imports a Comma-Separated Values data file into a Matrix<T>, where T is
+    double or std::complex<double>.
+*/
+template <class T = double>
+Matrix<T> csv_import(const std::string &file_path) {
+    return detail::sep_import<T>(file_path, detail::Sep::csv);
+}
+
+/*
+    Imports a Tab-Separated Values data file into a Matrix<T>, where T is
+    double or std::complex<double>.
+*/
+template <class T = double>
+Matrix<T> tsv_import(const std::string &file_path) {
+    return detail::sep_import<T>(file_path, detail::Sep::tsv);
+}
+
+/*
+    Exports rows*columns values of a row-major view to a Comma-Separated
+    Values data file.
+*/
+template <class T>
+void csv_export(const std::string &file_path, View<const T> data,
+    std::size_t rows, std::size_t columns) {
+    detail::sep_export<T>(file_path, data, rows, columns, detail::Sep::csv);
+}
+
+template <class T>
+void csv_export(const std::string &file_path, const Matrix<T> &m) {
+    csv_export<T>(file_path, m.view(), m.extent(0), m.extent(1));
+}
+
+/*
+    Exports rows*columns values of a row-major view to a Tab-Separated
+    Values data file.
+*/
+template <class T>
+void tsv_export(const std::string &file_path, View<const T> data,
+    std::size_t rows, std::size_t columns) {
+    detail::sep_export<T>(file_path, data, rows, columns, detail::Sep::tsv);
+}
+
+template <class T>
+void tsv_export(const std::string &file_path, const Matrix<T> &m) {
+    tsv_export<T>(file_path, m.view(), m.extent(0), m.extent(1));
+}
+
+/*
+    Imports a Delimiter-Separated Values data file of the given dialect into
+    a Matrix<T>, where T is double or std::complex<double>.
+*/
+template <class T = double>
+Matrix<T> dsv_import(const std::string &file_path,
+    const dfl_dialect &dialect) {
+    detail::check_element_type<T>();
+    int rows = 0, columns = 0;
+    dsvdat_get_sizes(file_path.c_str(), &rows, &columns, &dialect);
+    Matrix<T> m({static_cast<std::size_t>(rows),
+        static_cast<std::size_t>(columns)});
+    if (m.size() == 0) return m;
+    if constexpr (std::is_same_v<T, double>) {
+        dsvdat_import(file_path.c_str(), m.data(), &dialect);
+    } else {
+        dsvdat_import_cplx(file_path.c_str(), m.data(), &dialect);
+    }
+    return m;
+}
+
+/*
+    Imports a Wolfram Language package source file into a Tensor<T, Rank>.
+    Throws std::runtime_error if the file does not have Rank dimensions.
+*/
+template <class T, std::size_t Rank>
+Tensor<T, Rank> wl_import(const std::string &file_path) {
+    detail::check_element_type<T>();
+    int dimensions = wldat_get_dimensions(file_path.c_str());
+    if (dimensions != static_cast<int>(Rank)) {
+        throw std::runtime_error("dfl::wl_import: file has " +
+            std::to_string(dimensions) + " dimensions, expected " +
+            std::to_string(Rank));
+    }
+    int size[Rank];
+    wldat_get_sizes(file_path.c_str(), size);
+    typename Tensor<T, Rank>::shape_type shape;
+    for (std::size_t d = 0; d < Rank; d++) {
+        shape[d] = static_cast<std::size_t>(size[d]);
+    }
+    Tensor<T, Rank> t(shape);
+    if (t.size() == 0) return t;
+    if constexpr (std::is_same_v<T, double>) {
+        wldat_import(file_path.c_str(), t.data());
+    } else {
+        wldat_import_cplx(file_path.c_str(), t.data());
+    }
+    return t;
+}
+
+/*
+    Exports a row-major view with the given shape to a Wolfram Language
+    package source file.
+*/
+template <class T, std::size_t Rank>
+void wl_export(const std::string &file_path, View<const T> data,
+    const std::array<std::size_t, Rank> &shape,
+    const std::string &comment = "") {
+    detail::check_element_type<T>();
+    int size[Rank];
+    std::size_t total = 1;
+    for (std::size_t d = 0; d < Rank; d++) {
+        size[d] = detail::to_int(shape[d], "size");
+        total *= shape[d];
+    }
+    if (data.size() < total) {
+        throw std::length_error("dfl: view smaller than the tensor shape");
+    }
+    if constexpr (std::is_same_v<T, double>) {
+        wldat_export(file_path.c_str(), data.data(), static_cast<int>(Rank),
+            size, comment.c_str());
+    } else {
+        wldat_export_cplx(file_path.c_str(), data.data(),
+            static_cast<int>(Rank), size, comment.c_str());
+    }
+}
+
+template <class T, std::size_t Rank>
+void wl_export(const std::string &file_path, const Tensor<T, Rank> &t,
+    const std::string &comment = "") {
+    wl_export<T, Rank>(file_path, t.view(), t.shape(), comment);
+}
+
+} /* namespace dfl */
+
+#endif /* DATA_FILE_LIBRARY_HPP */
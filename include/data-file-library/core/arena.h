@@ -0,0 +1,107 @@
+/* 
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/arena.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling the allocators and arenas used by the import
+        functions that allocate their outputs (the *_import_alloc() and
+        *_import_batch() functions).
+*/
+
+#ifndef DATA_FILE_LIBRARY_ARENA_H
+#define DATA_FILE_LIBRARY_ARENA_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/alloc_impl_.h"
+#include "../impl/batch_impl_.h"
+
+/*
+    Initializes an arena, which allocates memory from blocks of at least
+    block_size bytes. An arena may be reset and reused for many imports,
+    avoiding a call to malloc() and free() per file.
+
+    Parameters:
+    - arena, the arena.
+    - block_size, minimum size in bytes of each block, where 0 selects
+    1 MiB.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_arena_init(dfl_arena *arena, size_t block_size) {
+    dfl_arena_init_impl_(arena, block_size);
+}
+
+/*
+    Returns an allocator that allocates from an arena, to be passed to the
+    *_import_alloc() functions. The memory allocated from it is released by
+    dfl_arena_reset() or dfl_arena_destroy(), so dfl_free() does nothing.
+
+    Parameter:
+    - arena, the arena.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_allocator dfl_arena_allocator(dfl_arena *arena) {
+    return dfl_arena_allocator_impl_(arena);
+}
+
+/*
+    Makes all the memory of an arena available again for new allocations,
+    without returning it to the system. Every pointer previously allocated
+    from the arena becomes invalid.
+
+    Parameter:
+    - arena, the arena.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_arena_reset(dfl_arena *arena) {
+    dfl_arena_reset_impl_(arena);
+}
+
+/*
+    Returns all the memory of an arena to the system.
+
+    Parameter:
+    - arena, the arena.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_arena_destroy(dfl_arena *arena) {
+    dfl_arena_destroy_impl_(arena);
+}
+
+/*
+    Releases memory returned by any *_import_alloc() function.
+
+    Parameters:
+    - allocator, the same allocator given to the *_import_alloc() function,
+    or NULL if NULL was given.
+    - ptr, the memory to be released, may be NULL.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_free(const dfl_allocator *allocator, void *ptr) {
+    dfl_free_impl_(allocator, ptr);
+}
+
+/*
+    Releases the arrays of the items output by any *_import_batch()
+    function.
+
+    Parameters:
+    - items, array of count items.
+    - count, number of items.
+    - allocator, the same allocator given to the *_import_batch() function,
+    or NULL if NULL was given.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_batch_free(dfl_batch_item *items, int count,
+    const dfl_allocator *allocator) {
+    batch_free_impl_(items, count, allocator);
+}
+
+#endif /* DATA_FILE_LIBRARY_ARENA_H */
@@ -0,0 +1,102 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/arrowdat.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling Apache Arrow IPC files (.arrow, also known as
+        Feather V2 files, .feather) of numeric columns, read through a
+        memory mapping.
+*/
+
+#ifndef DATA_FILE_LIBRARY_ARROWDAT_H
+#define DATA_FILE_LIBRARY_ARROWDAT_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/arrow_impl_.h"
+#include "../impl/arrowdat_impl_.h"
+
+/*
+    Gets the size in each dimension (number of rows and columns) from an
+    Arrow IPC file, where the rows are those of all its record batches.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void arrowdat_get_sizes(const char *file_path, int *rows, int *columns) {
+    arrowdat_get_sizes_impl_(file_path, rows, columns);
+}
+
+/*
+    Imports double-type data from an Arrow IPC file and stores it in an
+    one-dimensional double-type array following the row-major order. The
+    columns may be of any integer or float type, whose values are
+    converted, and the null values are stored as NAN. Compressed and
+    dictionary-encoded files are not supported.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    to output the data following the row-major order, where rows and columns
+    may be obtained through arrowdat_get_sizes().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void arrowdat_import(const char *file_path, double *data) {
+    arrowdat_import_impl_(file_path, data);
+}
+
+/*
+    Imports an Arrow IPC file into an Arrow struct array of the Arrow C Data
+    Interface, with one child of the same type, name and null values per
+    column, to be handed to an Arrow consumer, e.g., through
+    pyarrow.RecordBatch._import_from_c(). When the file has one record
+    batch, the children point into the memory mapping of the file, without
+    a copy. The consumer releases the schema and the array through their
+    release callbacks. Returns 0 on success, the errno of the failure to
+    open the file, or EINVAL if it is not a supported Arrow IPC file.
+
+    Parameters:
+    - file_path, path to the file.
+    - schema, pointer to a struct ArrowSchema to output the type.
+    - array, pointer to a struct ArrowArray to output the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int arrowdat_import_arrow(const char *file_path, struct ArrowSchema *schema,
+    struct ArrowArray *array) {
+
+    return arrowdat_import_arrow_impl_(file_path, schema, array);
+}
+
+/*
+    Exports double-type data of an one-dimensional double-type array,
+    following the row-major order, to an Arrow IPC file of one record batch
+    with one double-type column per column of the data, named column_1,
+    column_2, ...
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    containing the data. The data is accessed following the row-major order,
+    i.e., through data[j + columns*i], where i is any row and j is any
+    column.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void arrowdat_export(const char *file_path, const double *data, int rows,
+    int columns) {
+
+    arrowdat_export_impl_(file_path, data, (size_t)rows, (size_t)columns);
+}
+
+#endif /* DATA_FILE_LIBRARY_ARROWDAT_H */
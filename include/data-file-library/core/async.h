@@ -0,0 +1,115 @@
+/* 
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/async.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling the executors and tasks of the asynchronous
+        imports and exports (the *_async() functions).
+*/
+
+#ifndef DATA_FILE_LIBRARY_ASYNC_H
+#define DATA_FILE_LIBRARY_ASYNC_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/async_impl_.h"
+
+/*
+    Creates an executor, i.e., a pool of threads that run the tasks of the
+    *_async() functions in the order they are submitted.
+
+    Parameter:
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_executor *dfl_executor_create(int threads) {
+    return dfl_executor_create_impl_(threads);
+}
+
+/*
+    Destroys an executor, after all its queued and running tasks finish.
+    The tasks may still be queried, and must still be released with
+    dfl_task_release().
+
+    Parameter:
+    - executor, the executor.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_executor_destroy(dfl_executor *executor) {
+    dfl_executor_destroy_impl_(executor);
+}
+
+/*
+    Returns, without blocking, the state of a task: DFL_TASK_PENDING,
+    DFL_TASK_RUNNING, DFL_TASK_DONE or DFL_TASK_CANCELLED.
+
+    Parameter:
+    - task, the task.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int dfl_task_state(dfl_task *task) {
+    return dfl_task_state_impl_(task);
+}
+
+/*
+    Returns, without blocking, the status of a task: 0 while it is pending
+    or running and once it is done without failure, otherwise the errno of
+    its failure (e.g., of opening the file, or EINVAL if the dimensions of a
+    WL file exceed 128), or ECANCELED once it is cancelled. Tasks never exit
+    the process on these failures.
+
+    Parameter:
+    - task, the task.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int dfl_task_status(dfl_task *task) {
+    return dfl_task_status_impl_(task);
+}
+
+/*
+    Waits until a task is done or cancelled, and returns its final state,
+    DFL_TASK_DONE or DFL_TASK_CANCELLED. When the task has a callback, it
+    has already returned, so that it must not be called from the callback
+    of the task.
+
+    Parameter:
+    - task, the task.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int dfl_task_wait(dfl_task *task) {
+    return dfl_task_wait_impl_(task);
+}
+
+/*
+    Cancels a task that has not started yet, calling its callback with the
+    state DFL_TASK_CANCELLED. Returns 1 if the task was cancelled, or 0 if it
+    was already running or finished.
+
+    Parameter:
+    - task, the task.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int dfl_task_cancel(dfl_task *task) {
+    return dfl_task_cancel_impl_(task);
+}
+
+/*
+    Releases a task, waiting for it and its callback first if they have not
+    finished. It must not be called from the callback of the task.
+
+    Parameter:
+    - task, the task.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_task_release(dfl_task *task) {
+    dfl_task_release_impl_(task);
+}
+
+#endif /* DATA_FILE_LIBRARY_ASYNC_H */
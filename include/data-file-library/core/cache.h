@@ -0,0 +1,74 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/cache.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling the caches of imported files used by the
+        *_import_cached() functions.
+*/
+
+#ifndef DATA_FILE_LIBRARY_CACHE_H
+#define DATA_FILE_LIBRARY_CACHE_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/cache_impl_.h"
+
+/*
+    Creates a thread-safe cache of imported files, which keeps the values of
+    the files imported through the *_import_cached() functions up to a
+    number of bytes, evicting the least recently used files.
+
+    Parameter:
+    - max_bytes, largest number of bytes of the values kept by the cache.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_cache *dfl_cache_create(size_t max_bytes) {
+    return dfl_cache_create_impl_(max_bytes);
+}
+
+/*
+    Destroys a cache. All its views must have been released.
+
+    Parameter:
+    - cache, the cache.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_cache_destroy(dfl_cache *cache) {
+    dfl_cache_destroy_impl_(cache);
+}
+
+/*
+    Removes all files of a cache, so that the next imports parse them
+    again. The values of the files that still have views are released when
+    their last view is released.
+
+    Parameter:
+    - cache, the cache.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_cache_clear(dfl_cache *cache) {
+    dfl_cache_clear_impl_(cache);
+}
+
+/*
+    Releases a view given by a *_import_cached() function. Its values must
+    not be used afterwards.
+
+    Parameters:
+    - cache, the cache of the view.
+    - view, the view, which is reset.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_cache_release(dfl_cache *cache, dfl_cache_view *view) {
+    dfl_cache_release_impl_(cache, view);
+}
+
+#endif /* DATA_FILE_LIBRARY_CACHE_H */
@@ -0,0 +1,53 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/convert.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for converting files between the supported formats by
+        streaming their values, with bounded memory.
+*/
+
+#ifndef DATA_FILE_LIBRARY_CONVERT_H
+#define DATA_FILE_LIBRARY_CONVERT_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/convert_impl_.h"
+
+/*
+    Converts a Comma-Separated Values, Tab-Separated Values, Wolfram
+    Language package source or binary file to any of these formats by
+    streaming its values. A thread parses the input into a fixed ring of
+    batches while the calling thread formats and writes them, so that the
+    memory used is that of the ring whatever the size of the files. The
+    innermost lists of WL files are the rows of CSV and TSV files, and
+    binary files hold the raw double-type values. Only real values are
+    converted. Returns 0 on success, the errno of the failure to open or
+    write a file, or EINVAL for an unknown format, a binary input without
+    columns, or an input value that is not a real number (e.g., a complex
+    one or an empty cell), in which case the output stops before it.
+
+    Parameters:
+    - input_path, path to the input, or "-" for the standard input.
+    - output_path, path to the output, or "-" for the standard output.
+    - options, pointer to a dfl_convert_options with the DFL_FILE_* formats
+    (DFL_FILE_AUTO selects it from the extension of the path), the columns
+    of binary inputs, the options of the numbers and the comment of WL
+    outputs, and the number and size of the batches, or NULL for the
+    defaults.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int dfl_convert(const char *input_path, const char *output_path,
+    const dfl_convert_options *options) {
+
+    return dfl_convert_impl_(input_path, output_path, options);
+}
+
+#endif /* DATA_FILE_LIBRARY_CONVERT_H */
@@ -20,7 +20,15 @@
 #endif
 
 #include "../impl/cplx_c_cpp_impl_.h"
+#include "../impl/alloc_impl_.h"
+#include "../impl/arrow_impl_.h"
+#include "../impl/batch_impl_.h"
+#include "../impl/async_impl_.h"
+#include "../impl/cache_impl_.h"
+#include "../impl/follow_impl_.h"
+#include "../impl/probe_impl_.h"
 #include "../impl/sepdat_impl_.h"
+#include "../impl/stats_impl_.h"
 
 /*
     Gets the size in each dimension (number of rows and columns) from a
@@ -38,6 +46,63 @@ void csvdat_get_sizes(const char *file_path, int *rows,
     sepdat_get_sizes_impl_(file_path, rows, columns, ',');
 }
 
+/*
+    Gets the size in each dimension (number of rows and columns) from a
+    Comma-Separated Values data file as size_t, so that files with more than
+    2^31 rows, columns or values may be handled.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_get_sizes64(const char *file_path, size_t *rows,
+    size_t *columns) {
+
+    sepdat_get_sizes64_impl_(file_path, rows, columns, ',');
+}
+
+/*
+    Gets the size in each dimension (number of rows and columns) from a
+    Comma-Separated Values data file as size_t, as csvdat_get_sizes64(), but
+    returning the errno of the failure to open the file instead of exiting,
+    e.g., for bindings to other languages. Returns 0 on success.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_get_sizes_status(const char *file_path, size_t *rows,
+    size_t *columns) {
+
+    return sepdat_get_sizes_status_impl_(file_path, rows, columns, ',');
+}
+
+/*
+    Probes a Comma-Separated Values data file in one scan, finding its
+    number of rows and columns, the smallest number of columns of a row and
+    the number of ragged rows (rows with less columns, whose missing values
+    are not written by the import functions), whether any value is complex,
+    and the number formats used (DFL_FORMAT_* flags), so that the cheapest
+    import function may be chosen and the memory allocated once.
+
+    Parameters:
+    - file_path, path to the file.
+    - probe, pointer to a dfl_probe to output the result.
+    - sample_bytes, number of bytes to be scanned, where 0 scans the whole
+    file. For larger files, probe->sampled is set and probe->rows is an
+    estimate.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_probe(const char *file_path, dfl_probe *probe,
+    long long sample_bytes) {
+
+    sepdat_probe_impl_(file_path, probe, sample_bytes, ',');
+}
+
 /*
     Imports double-type data from a Comma-Separated Values data file
     and stores in an
@@ -83,6 +148,325 @@ void csvdat_import_cplx(const char *file_path,
     sepdat_import_cplx_impl_(file_path, data, ',');
 }
 
+/*
+    Imports double-type data from a Comma-Separated Values data file, as
+    csvdat_import(), while recording the cells that are not numbers, which
+    are otherwise stored as NAN silently. The check costs nothing for valid
+    cells, so that no second pass looking for NaNs is needed. Returns the
+    number of bad cells found.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    to output the data following the row-major order, where rows and columns
+    may be obtained through csvdat_get_sizes().
+    - report, pointer to a dfl_parse_report with the mode
+    (DFL_PARSE_STRICT to stop at the first bad cell, or DFL_PARSE_LENIENT to
+    import every cell) and an array of max_errors dfl_cell_error to output
+    the row, column and byte offset of the first bad cells.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_import_checked(const char *file_path, double *data,
+    dfl_parse_report *report) {
+
+    return sepdat_import_checked_impl_(file_path, data, report, ',');
+}
+
+/*
+    Imports 'double complex'-type data from a Comma-Separated Values data
+    file, as csvdat_import_cplx(), while recording the cells that are not
+    numbers. Returns the number of bad cells found.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns to output the data following the row-major order, where rows
+    and columns may be obtained through csvdat_get_sizes().
+    - report, pointer to a dfl_parse_report with the mode and the array of
+    max_errors dfl_cell_error to output the first bad cells.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_import_cplx_checked(const char *file_path, tpdfcplx_impl_ *data,
+    dfl_parse_report *report) {
+
+    return sepdat_import_cplx_checked_impl_(file_path, data, report, ',');
+}
+
+/*
+    Computes the statistics of each column of a Comma-Separated Values data
+    file while it is parsed, without storing its values, i.e., with memory
+    proportional to the number of columns. Returns the number of columns of
+    the file.
+
+    Parameters:
+    - file_path, path to the file.
+    - stats, array of max_columns dfl_stats to output the count, the number
+    of skipped cells, min, max, sum, mean, population variance and Euclidean
+    norm of the first max_columns columns.
+    - max_columns, size of the stats array.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_stats(const char *file_path, dfl_stats *stats, int max_columns) {
+    return sepdat_stats_impl_(file_path, stats, max_columns, ',', 0);
+}
+
+/*
+    Same as csvdat_stats(), but for 'double complex'-type data, whose
+    statistics are those of the absolute values, e.g., the norm of each
+    column.
+
+    Parameters:
+    - file_path, path to the file.
+    - stats, array of max_columns dfl_stats to output the statistics of the
+    absolute values of the first max_columns columns.
+    - max_columns, size of the stats array.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_stats_cplx(const char *file_path, dfl_stats *stats,
+    int max_columns) {
+
+    return sepdat_stats_impl_(file_path, stats, max_columns, ',', 1);
+}
+
+/*
+    Imports double-type data from a Comma-Separated Values data file into an
+    one-dimensional double-type array allocated by the library, following
+    the row-major order, so that the sizes do not need to be known in
+    advance. The returned array must be released with dfl_free() and the
+    same allocator.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - allocator, allocator of the returned array, e.g., from
+    dfl_arena_allocator(), or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+double *csvdat_import_alloc(const char *file_path, int *rows, int *columns,
+    const dfl_allocator *allocator) {
+
+    return sepdat_import_alloc_impl_(file_path, rows, columns, allocator,
+        ',');
+}
+
+/*
+    Imports 'double complex'-type data from a Comma-Separated Values data
+    file into an one-dimensional 'double complex'-type array allocated by the
+    library, following the row-major order, so that the sizes do not need to
+    be known in advance. The returned array must be released with dfl_free()
+    and the same allocator.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - allocator, allocator of the returned array, e.g., from
+    dfl_arena_allocator(), or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+tpdfcplx_impl_ *csvdat_import_cplx_alloc(const char *file_path, int *rows,
+    int *columns, const dfl_allocator *allocator) {
+
+    return sepdat_import_cplx_alloc_impl_(file_path, rows, columns,
+        allocator, ',');
+}
+
+/*
+    Imports double-type data from a Comma-Separated Values data file into a
+    double-type array with arbitrary strides, e.g., following the
+    column-major order or into a sub-block of a larger array, without an
+    intermediate copy.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array to output the value of row i and column j at
+    data[i*row_stride + j*column_stride], where the number of rows and
+    columns may be obtained through csvdat_get_sizes(). The row-major order
+    has row_stride = columns and column_stride = 1, and the column-major
+    order has row_stride = 1 and column_stride = rows (or a larger leading
+    dimension).
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_import_strided(const char *file_path, double *data,
+    int row_stride, int column_stride) {
+
+    sepdat_import_strided_impl_(file_path, data, row_stride, column_stride,
+        ',');
+}
+
+/*
+    Imports 'double complex'-type data from a Comma-Separated Values data file
+    into a 'double complex'-type array with arbitrary strides. See
+    csvdat_import_strided() and csvdat_import_cplx().
+
+    Parameters:
+    - file_path, path to the file.
+    - data, 'double complex'-type array to output the value of row i and
+    column j at data[i*row_stride + j*column_stride].
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_import_cplx_strided(const char *file_path,
+    tpdfcplx_impl_ *data, int row_stride, int column_stride) {
+
+    sepdat_import_cplx_strided_impl_(file_path, data, row_stride,
+        column_stride, ',');
+}
+
+/*
+    Reads double-type data from a Comma-Separated Values data file of known
+    sizes, e.g., from csvdat_get_sizes_status(), into a double-type array
+    with arbitrary strides, without scanning the file again for its sizes
+    and returning the errno of the failure to open the file instead of
+    exiting. Returns 0 on success.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array to output the value of row i and column j at
+    data[i*row_stride + j*column_stride].
+    - rows, number of rows of the file.
+    - columns, number of columns of the file.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_read_strided(const char *file_path, double *data, size_t rows,
+    size_t columns, ptrdiff_t row_stride, ptrdiff_t column_stride) {
+
+    return sepdat_read_status_impl_(file_path, data, NULL, rows, columns,
+        row_stride, column_stride, ',');
+}
+
+/*
+    Same as csvdat_read_strided(), but for 'double complex'-type data.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, 'double complex'-type array to output the value of row i and
+    column j at data[i*row_stride + j*column_stride].
+    - rows, number of rows of the file.
+    - columns, number of columns of the file.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_read_cplx_strided(const char *file_path, tpdfcplx_impl_ *data,
+    size_t rows, size_t columns, ptrdiff_t row_stride,
+    ptrdiff_t column_stride) {
+
+    return sepdat_read_status_impl_(file_path, NULL, data, rows, columns,
+        row_stride, column_stride, ',');
+}
+
+/*
+    Imports 'double complex'-type data from a Comma-Separated Values data file
+    into two double-type arrays, one with the real parts and one with the
+    imaginary parts (split planes), without an interleaved intermediate
+    array. The complex values are of the types accepted by
+    csvdat_import_cplx().
+
+    Parameters:
+    - file_path, path to the file.
+    - re, one-dimensional double-type array of the size rows*columns to
+    output the real parts following the row-major order, where rows and
+    columns may be obtained through csvdat_get_sizes().
+    - im, one-dimensional double-type array of the size rows*columns to
+    output the imaginary parts following the row-major order.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_import_cplx_split(const char *file_path, double *re,
+    double *im) {
+
+    sepdat_import_cplx_split_impl_(file_path, re, im, ',');
+}
+
+/*
+    Imports double-type data from many Comma-Separated Values files at once,
+    using a pool of threads that take the files one after another and read
+    ahead the next files while the current ones are parsed. For each file,
+    the rows and columns (dimensions 2, size[0] rows and size[1] columns),
+    the data, and a status are output to the respective item. The arrays of
+    the items must be released with dfl_batch_free().
+
+    Parameters:
+    - file_paths, array of count paths.
+    - count, number of files.
+    - items, array of count dfl_batch_item to output, for each file, status
+    (0 on success or the errno of the failure, which never exits the
+    process), dimensions, size and data.
+    - threads, number of threads, where 0 selects the number of processors.
+    - allocator, allocator of the arrays of the items, e.g., from
+    dfl_arena_allocator(), or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_import_batch(const char *const *file_paths, int count,
+    dfl_batch_item *items, int threads, const dfl_allocator *allocator) {
+
+    batch_import_impl_(file_paths, count, items, threads, allocator, ',',
+        0, 0);
+}
+
+/*
+    Same as csvdat_import_batch(), but for 'double complex'-type data, which
+    is output to the data_cplx array of each item.
+
+    Parameters:
+    - file_paths, array of count paths.
+    - count, number of files.
+    - items, array of count dfl_batch_item to output, for each file, status,
+    dimensions, size and data_cplx.
+    - threads, number of threads, where 0 selects the number of processors.
+    - allocator, allocator of the arrays of the items, or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_import_cplx_batch(const char *const *file_paths, int count,
+    dfl_batch_item *items, int threads, const dfl_allocator *allocator) {
+
+    batch_import_impl_(file_paths, count, items, threads, allocator, ',',
+        0, 1);
+}
+
+/*
+    Imports incrementally double-type data from a Comma-Separated Values data
+    file that is still being written, e.g., by a solver appending rows. The
+    first call imports the whole file, and each later call with the same
+    state parses only the complete lines appended since the previous one,
+    so that repeated refreshes cost O(new data) instead of O(file). The
+    values so far are kept in follow->data (follow->rows rows and
+    follow->columns columns, following the row-major order). If the file was
+    truncated or replaced (e.g., rotated), the values are discarded, the
+    file is imported again and follow->restarted is set. Returns the number
+    of rows appended by the call, or -1 if the file could not be read.
+
+    Parameters:
+    - file_path, path to the file.
+    - follow, state initialized with dfl_follow_init(), which must be
+    released with dfl_follow_destroy().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_follow(const char *file_path, dfl_follow *follow) {
+    return sepdat_follow_impl_(file_path, follow, ',', 0);
+}
+
+/*
+    Same as csvdat_follow(), but for 'double complex'-type data, which is
+    kept in follow->data_cplx. A state must be used either with
+    csvdat_follow() or with csvdat_follow_cplx(), not both.
+
+    Parameters:
+    - file_path, path to the file.
+    - follow, state initialized with dfl_follow_init(), which must be
+    released with dfl_follow_destroy().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_follow_cplx(const char *file_path, dfl_follow *follow) {
+    return sepdat_follow_impl_(file_path, follow, ',', 1);
+}
+
 /*
     Exports double-type data of an one-dimensional
     double-type array, following the row-major order, to a Comma-Separated
@@ -127,4 +511,310 @@ void csvdat_export_cplx(const char *file_path,
     sepdat_export_cplx_impl_(file_path, data, rows, columns, ',');
 }
 
+/*
+    Exports double-type data of an one-dimensional double-type array,
+    following the row-major order, to a Comma-Separated Values data file, as
+    csvdat_export(), but with the sizes as size_t, so that more than 2^31
+    values may be exported.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    containing the data following the row-major order.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_export64(const char *file_path, const double *data, size_t rows,
+    size_t columns) {
+
+    sepdat_export_impl_(file_path, data, rows, columns, ',');
+}
+
+/*
+    Exports 'double complex'-type data of an one-dimensional
+    'double complex'-type array, following the row-major order, to a
+    Comma-Separated Values data file, as csvdat_export_cplx(), but with the
+    sizes as size_t, so that more than 2^31 values may be exported.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns containing the data following the row-major order.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_export_cplx64(const char *file_path, const tpdfcplx_impl_ *data,
+    size_t rows, size_t columns) {
+
+    sepdat_export_cplx_impl_(file_path, data, rows, columns, ',');
+}
+
+/*
+    Exports double-type data of a double-type array with arbitrary strides,
+    e.g., following the column-major order or a sub-block of a larger array,
+    to a Comma-Separated Values data file, without an intermediate copy.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array containing the value of row i and column j at
+    data[i*row_stride + j*column_stride].
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_export_strided(const char *file_path, const double *data,
+    int rows, int columns, int row_stride, int column_stride) {
+
+    sepdat_export_strided_impl_(file_path, data, rows, columns, row_stride,
+        column_stride, ',');
+}
+
+/*
+    Exports 'double complex'-type data of a 'double complex'-type array with
+    arbitrary strides to a Comma-Separated Values data file. See
+    csvdat_export_strided() and csvdat_export_cplx().
+
+    Parameters:
+    - file_path, path to the file.
+    - data, 'double complex'-type array containing the value of row i and
+    column j at data[i*row_stride + j*column_stride].
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_export_cplx_strided(const char *file_path,
+    const tpdfcplx_impl_ *data, int rows, int columns, int row_stride,
+    int column_stride) {
+
+    sepdat_export_cplx_strided_impl_(file_path, data, rows, columns,
+        row_stride, column_stride, ',');
+}
+
+/*
+    Exports 'double complex'-type data given by two double-type arrays, one
+    with the real parts and one with the imaginary parts (split planes),
+    following the row-major order, to a Comma-Separated Values data file,
+    without an interleaved intermediate array. The exported complex values
+    are of the type a+bi.
+
+    Parameters:
+    - file_path, path to the file.
+    - re, one-dimensional double-type array of the size rows*columns
+    containing the real parts, accessed through re[j + columns*i].
+    - im, one-dimensional double-type array of the size rows*columns
+    containing the imaginary parts, accessed through im[j + columns*i].
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void csvdat_export_cplx_split(const char *file_path, const double *re,
+    const double *im, int rows, int columns) {
+
+    sepdat_export_cplx_split_impl_(file_path, re, im, rows, columns, ',');
+}
+
+/*
+    Exports double-type data of an one-dimensional double-type array,
+    following the row-major order, to a Comma-Separated Values data file, as
+    csvdat_export(), but for files of many gigabytes, which are written without
+    filling the page cache. On Linux with the GNU C library, the file is
+    preallocated with an upper bound of its size and written in aligned
+    blocks with O_DIRECT, falling back to buffered writes whose pages are
+    dropped from the page cache if the file system does not support it.
+    This needs _GNU_SOURCE defined before any #include, as the wrapper
+    src/data-file-library.c does; header-only builds without it write the
+    file by stdio and drop it from the page cache when closed, unless
+    DATA_FILE_LIBRARY_DIRECT_IO is defined, which makes them fail to
+    compile instead. Returns 0, or the errno of the failure to open or write
+    the file.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    containing the data following the row-major order.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_export_direct(const char *file_path, const double *data,
+    size_t rows, size_t columns) {
+
+    return sepdat_export_direct_impl_(file_path, data, NULL, rows, columns,
+        ',');
+}
+
+/*
+    Exports 'double complex'-type data of an one-dimensional
+    'double complex'-type array, following the row-major order, to a
+    Comma-Separated Values data file, as csvdat_export_cplx(), but without
+    filling the page cache. See csvdat_export_direct().
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns containing the data following the row-major order.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_export_cplx_direct(const char *file_path,
+    const tpdfcplx_impl_ *data, size_t rows, size_t columns) {
+
+    return sepdat_export_direct_impl_(file_path, NULL, data, rows, columns,
+        ',');
+}
+
+/*
+    Imports double-type data from a Comma-Separated Values data file into an
+    Arrow struct array of the Arrow C Data Interface, with one double-type
+    child per column, named column_1, column_2, ... The file is parsed
+    directly into the column buffers, so that an Arrow consumer, e.g.,
+    pyarrow.RecordBatch._import_from_c(), takes them without a copy, and
+    releases them through the release callbacks of the schema and the
+    array. Returns 0 on success or the errno of the failure to open the
+    file.
+
+    Parameters:
+    - file_path, path to the file.
+    - schema, pointer to a struct ArrowSchema to output the type.
+    - array, pointer to a struct ArrowArray to output the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_import_arrow(const char *file_path, struct ArrowSchema *schema,
+    struct ArrowArray *array) {
+
+    return sepdat_import_arrow_impl_(file_path, schema, array, ',');
+}
+
+/*
+    Imports double-type data from a Comma-Separated Values data file
+    through a cache, so that repeated imports of a file that did not change
+    are memory lookups. Concurrent imports of the same file share a single
+    parse. The values are shared with the other views of the file, must not
+    be modified, and remain valid until the view is released with
+    dfl_cache_release(). Returns the status of the view.
+
+    Parameters:
+    - cache, cache from dfl_cache_create().
+    - file_path, path to the file.
+    - view, pointer to a dfl_cache_view to output status (0 on success or
+    the errno of the failure to open the file), dimensions, size and data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_import_cached(dfl_cache *cache, const char *file_path,
+    dfl_cache_view *view) {
+
+    return cache_import_impl_(cache, file_path, view, DFL_CACHE_CSV_IMPL_, 0);
+}
+
+/*
+    Same as csvdat_import_cached(), but for 'double complex'-type data, which
+    is output to the data_cplx field of the view.
+
+    Parameters:
+    - cache, cache from dfl_cache_create().
+    - file_path, path to the file.
+    - view, pointer to a dfl_cache_view to output status, dimensions, size
+    and data_cplx.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int csvdat_import_cplx_cached(dfl_cache *cache, const char *file_path,
+    dfl_cache_view *view) {
+
+    return cache_import_impl_(cache, file_path, view, DFL_CACHE_CSV_IMPL_, 1);
+}
+
+/*
+    Asynchronous version of csvdat_import(), run by a thread of the
+    executor. Returns a task, which may be polled, waited on or cancelled,
+    and must be released with dfl_task_release(). The data array must
+    remain valid until the task finishes.
+
+    Parameters:
+    - executor, executor from dfl_executor_create().
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns.
+    - callback, function called when the task finishes, or NULL.
+    - user_data, pointer given back to the callback.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_task *csvdat_import_async(dfl_executor *executor, const char *file_path,
+    double *data, dfl_task_callback callback, void *user_data) {
+
+    return sepdat_import_async_impl_(executor, file_path, data, 0, callback,
+        user_data, ',');
+}
+
+/*
+    Asynchronous version of csvdat_import_cplx(). See csvdat_import_async().
+
+    Parameters:
+    - executor, executor from dfl_executor_create().
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns.
+    - callback, function called when the task finishes, or NULL.
+    - user_data, pointer given back to the callback.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_task *csvdat_import_cplx_async(dfl_executor *executor,
+    const char *file_path, tpdfcplx_impl_ *data, dfl_task_callback callback,
+    void *user_data) {
+
+    return sepdat_import_async_impl_(executor, file_path, data, 1, callback,
+        user_data, ',');
+}
+
+/*
+    Asynchronous version of csvdat_export(), run by a thread of the
+    executor. Returns a task, which may be polled, waited on or cancelled,
+    and must be released with dfl_task_release(). The data array must
+    remain valid until the task finishes.
+
+    Parameters:
+    - executor, executor from dfl_executor_create().
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - callback, function called when the task finishes, or NULL.
+    - user_data, pointer given back to the callback.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_task *csvdat_export_async(dfl_executor *executor, const char *file_path,
+    const double *data, int rows, int columns, dfl_task_callback callback,
+    void *user_data) {
+
+    return sepdat_export_async_impl_(executor, file_path, data, rows,
+        columns, 0, callback, user_data, ',');
+}
+
+/*
+    Asynchronous version of csvdat_export_cplx(). See csvdat_export_async().
+
+    Parameters:
+    - executor, executor from dfl_executor_create().
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - callback, function called when the task finishes, or NULL.
+    - user_data, pointer given back to the callback.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_task *csvdat_export_cplx_async(dfl_executor *executor,
+    const char *file_path, const tpdfcplx_impl_ *data, int rows, int columns,
+    dfl_task_callback callback, void *user_data) {
+
+    return sepdat_export_async_impl_(executor, file_path, data, rows,
+        columns, 1, callback, user_data, ',');
+}
+
 #endif /* DATA_FILE_LIBRARY_CSVDAT_H */
\ No newline at end of file
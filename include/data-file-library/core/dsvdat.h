@@ -0,0 +1,191 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/dsvdat.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling Delimiter-Separated Values files, whose lines
+        are separated by line break and columns are separated by any of the
+        separators of a dialect, which also gives their comments, header
+        rows and line breaks.
+*/
+
+#ifndef DATA_FILE_LIBRARY_DSVDAT_H
+#define DATA_FILE_LIBRARY_DSVDAT_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/cplx_c_cpp_impl_.h"
+#include "../impl/sepdat_impl_.h"
+#include "../impl/dsvdat_impl_.h"
+
+/*
+    Gets the size in each dimension (number of rows and columns) from a
+    Delimiter-Separated Values data file. The header rows, the comments and
+    the blank lines are not counted.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - dialect, pointer to the dialect, or NULL for comma-separated values.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dsvdat_get_sizes(const char *file_path, int *rows, int *columns,
+    const dfl_dialect *dialect) {
+
+    dsvdat_get_sizes_impl_(file_path, rows, columns, dialect);
+}
+
+/*
+    Gets the size in each dimension (number of rows and columns) from a
+    Delimiter-Separated Values data file as size_t, so that files with more
+    than 2^31 rows, columns or values may be handled.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - dialect, pointer to the dialect, or NULL for comma-separated values.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dsvdat_get_sizes64(const char *file_path, size_t *rows,
+    size_t *columns, const dfl_dialect *dialect) {
+
+    dsvdat_get_sizes64_impl_(file_path, rows, columns, dialect);
+}
+
+/*
+    Imports double-type data from a Delimiter-Separated Values data file
+    and stores the values in an one-dimensional double-type array following
+    the row-major order. The values may also be in the base 10 exponential
+    form eN or *^N, where N is an integer.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    to output the data following the row-major order, where rows and columns
+    may be obtained through dsvdat_get_sizes(). The outputted data may be
+    accessed through data[j + columns*i], where i is any row and j is
+    any column.
+    - dialect, pointer to the dialect, or NULL for comma-separated values.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dsvdat_import(const char *file_path, double *data,
+    const dfl_dialect *dialect) {
+
+    dsvdat_import_impl_(file_path, data, dialect, NULL);
+}
+
+/*
+    Imports 'double complex'-type data from a Delimiter-Separated Values
+    data file and stores the values in an one-dimensional
+    'double complex'-type array following the row-major order. The complex
+    values may be of the type a, a+bi, bi, and i, where i may also be j,
+    *i, *j, or *I, and where a and b may also be in the base 10 exponential
+    form eN or *^N, where N is an integer.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns to output the data following the row-major order, where rows
+    and columns may be obtained through dsvdat_get_sizes().
+    - dialect, pointer to the dialect, or NULL for comma-separated values.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dsvdat_import_cplx(const char *file_path, tpdfcplx_impl_ *data,
+    const dfl_dialect *dialect) {
+
+    dsvdat_import_cplx_impl_(file_path, data, dialect, NULL);
+}
+
+/*
+    Imports double-type data from a Delimiter-Separated Values data file, as
+    dsvdat_import(), while recording the cells that are not numbers.
+    Returns the number of bad cells found.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    to output the data following the row-major order.
+    - dialect, pointer to the dialect, or NULL for comma-separated values.
+    - report, pointer to a dfl_parse_report with the mode and the array of
+    max_errors dfl_cell_error to output the first bad cells, whose offsets
+    count the skipped lines too.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int dsvdat_import_checked(const char *file_path, double *data,
+    const dfl_dialect *dialect, dfl_parse_report *report) {
+
+    return dsvdat_import_impl_(file_path, data, dialect, report);
+}
+
+/*
+    Imports 'double complex'-type data from a Delimiter-Separated Values
+    data file, as dsvdat_import_cplx(), while recording the cells that are
+    not numbers. Returns the number of bad cells found.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns to output the data following the row-major order.
+    - dialect, pointer to the dialect, or NULL for comma-separated values.
+    - report, pointer to a dfl_parse_report with the mode and the array of
+    max_errors dfl_cell_error to output the first bad cells.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int dsvdat_import_cplx_checked(const char *file_path, tpdfcplx_impl_ *data,
+    const dfl_dialect *dialect, dfl_parse_report *report) {
+
+    return dsvdat_import_cplx_impl_(file_path, data, dialect, report);
+}
+
+/*
+    Exports double-type data from an one-dimensional double-type array,
+    following the row-major order, to a Delimiter-Separated Values data file
+    whose columns are separated by the first separator of the dialect.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns.
+    - rows, number of rows.
+    - columns, number of columns.
+    - dialect, pointer to the dialect, or NULL for comma-separated values.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dsvdat_export(const char *file_path, const double *data, int rows,
+    int columns, const dfl_dialect *dialect) {
+
+    sepdat_export_impl_(file_path, data, rows, columns,
+        dsvdat_export_separator_impl_(dialect));
+}
+
+/*
+    Exports 'double complex'-type data from an one-dimensional
+    'double complex'-type array, following the row-major order, to a
+    Delimiter-Separated Values data file whose columns are separated by the
+    first separator of the dialect.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns.
+    - rows, number of rows.
+    - columns, number of columns.
+    - dialect, pointer to the dialect, or NULL for comma-separated values.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dsvdat_export_cplx(const char *file_path, const tpdfcplx_impl_ *data,
+    int rows, int columns, const dfl_dialect *dialect) {
+
+    sepdat_export_cplx_impl_(file_path, data, rows, columns,
+        dsvdat_export_separator_impl_(dialect));
+}
+
+#endif /* DATA_FILE_LIBRARY_DSVDAT_H */
@@ -0,0 +1,49 @@
+/* 
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/follow.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling the state of the incremental (tail-follow)
+        imports of files that are still being written (the *_follow()
+        functions).
+*/
+
+#ifndef DATA_FILE_LIBRARY_FOLLOW_H
+#define DATA_FILE_LIBRARY_FOLLOW_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/follow_impl_.h"
+
+/*
+    Initializes the state of an incremental import, before its first call
+    to a *_follow() function.
+
+    Parameter:
+    - follow, the state.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_follow_init(dfl_follow *follow) {
+    dfl_follow_init_impl_(follow);
+}
+
+/*
+    Releases the values of an incremental import and resets its state, so
+    that it may be used again for another file.
+
+    Parameter:
+    - follow, the state.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_follow_destroy(dfl_follow *follow) {
+    dfl_follow_destroy_impl_(follow);
+}
+
+#endif /* DATA_FILE_LIBRARY_FOLLOW_H */
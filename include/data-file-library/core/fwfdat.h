@@ -0,0 +1,148 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/fwfdat.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling fixed-width files, i.e., files having a
+        structure in which lines are separated by line break and columns
+        have given widths in characters, without separators, as written by
+        the formatted output of Fortran.
+*/
+
+#ifndef DATA_FILE_LIBRARY_FWFDAT_H
+#define DATA_FILE_LIBRARY_FWFDAT_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/fwfdat_impl_.h"
+
+/*
+    Gets the size in each dimension (number of rows and columns) from a
+    fixed-width file.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns, i.e., of positive widths.
+    - widths, one-dimensional int-type array of size count with the width
+    in characters of each field, from the start of the line, where a
+    negative width -n skips n characters, as the nX edit descriptor of
+    Fortran.
+    - count, number of fields.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void fwfdat_get_sizes(const char *file_path, int *rows, int *columns,
+    const int *widths, int count) {
+
+    fwfdat_get_sizes_impl_(file_path, rows, columns, widths, count);
+}
+
+/*
+    Imports double-type data from a fixed-width file and stores the values
+    in an one-dimensional double-type array following the row-major order.
+    The rows are split among many threads, and the digits are converted
+    eight at a time. The values may also be in the Fortran exponential
+    forms dDn and d+n (for exponents of three digits). Fields that are not
+    numbers, including blank fields and the fields beyond the end of a
+    shorter line, are stored as NAN.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    to output the data following the row-major order, where rows and columns
+    may be obtained through fwfdat_get_sizes(). The outputted data may be
+    accessed through data[j + columns*i], where i is any row and j is
+    any column.
+    - widths, one-dimensional int-type array of size count with the width
+    in characters of each field, where a negative width -n skips n
+    characters.
+    - count, number of fields.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void fwfdat_import(const char *file_path, double *data, const int *widths,
+    int count, int threads) {
+
+    fwfdat_import_impl_(file_path, data, NULL, widths, count, threads);
+}
+
+/*
+    Imports 'double complex'-type data from a fixed-width file and stores
+    the values in an one-dimensional 'double complex'-type array following
+    the row-major order, as fwfdat_import(). The complex values may be of
+    the types accepted by csvdat_import_cplx().
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns to output the data following the row-major order, where rows
+    and columns may be obtained through fwfdat_get_sizes().
+    - widths, one-dimensional int-type array of size count with the width
+    in characters of each field, where a negative width -n skips n
+    characters.
+    - count, number of fields.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void fwfdat_import_cplx(const char *file_path, tpdfcplx_impl_ *data,
+    const int *widths, int count, int threads) {
+
+    fwfdat_import_impl_(file_path, NULL, data, widths, count, threads);
+}
+
+/*
+    Exports double-type data of an one-dimensional double-type array,
+    following the row-major order, to a fixed-width file. Each value is
+    right-aligned in its field with as many significant digits (up to 17)
+    as fit in its width, or written as asterisks if it does not fit, and
+    the skipped fields are filled with blanks.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    containing the data, where columns is the number of positive widths.
+    The data is accessed following the row-major order, i.e., through
+    data[j + columns*i], where i is any row and j is any column.
+    - rows, number of rows of the data.
+    - widths, one-dimensional int-type array of size count with the width
+    in characters of each field, where a negative width -n writes n blanks.
+    - count, number of fields.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void fwfdat_export(const char *file_path, const double *data, int rows,
+    const int *widths, int count) {
+
+    fwfdat_export_impl_(file_path, data, NULL, (size_t)rows, widths, count);
+}
+
+/*
+    Exports 'double complex'-type data of an one-dimensional
+    'double complex'-type array, following the row-major order, to a
+    fixed-width file, as fwfdat_export(). The exported complex values are
+    of the type a+bi.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns containing the data following the row-major order, where
+    columns is the number of positive widths.
+    - rows, number of rows of the data.
+    - widths, one-dimensional int-type array of size count with the width
+    in characters of each field, where a negative width -n writes n blanks.
+    - count, number of fields.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void fwfdat_export_cplx(const char *file_path, const tpdfcplx_impl_ *data,
+    int rows, const int *widths, int count) {
+
+    fwfdat_export_impl_(file_path, NULL, data, (size_t)rows, widths, count);
+}
+
+#endif /* DATA_FILE_LIBRARY_FWFDAT_H */
@@ -0,0 +1,194 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/mtxdat.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling Matrix Market files (.mtx), i.e., matrices
+        in the coordinate layout (one line "i j value" per entry) or in the
+        array layout (one value per line, following the column-major order),
+        whose coordinate entries are parsed in parallel.
+*/
+
+#ifndef DATA_FILE_LIBRARY_MTXDAT_H
+#define DATA_FILE_LIBRARY_MTXDAT_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/mtxdat_impl_.h"
+
+/*
+    Gets the size in each dimension (number of rows and columns) from a
+    Matrix Market file.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void mtxdat_get_sizes(const char *file_path, int *rows, int *columns) {
+    mtx_header_impl_ header;
+    mtxdat_open_impl_(file_path, &header, 1);
+    *rows = (int)header.rows;
+    *columns = (int)header.columns;
+}
+
+/*
+    Imports double-type data from a Matrix Market file of real, integer or
+    pattern values (or the real parts of complex values) and stores the
+    values in an one-dimensional double-type array following the row-major
+    order. Positions without entries are zero, repeated entries are summed,
+    and the mirrored entries of symmetric and skew-symmetric matrices are
+    stored too.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    to output the data following the row-major order, where rows and columns
+    may be obtained through mtxdat_get_sizes(). The outputted data may be
+    accessed through data[j + columns*i], where i is any row and j is
+    any column.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void mtxdat_import(const char *file_path, double *data) {
+    mtxdat_import_impl_(file_path, data, NULL);
+}
+
+/*
+    Imports 'double complex'-type data from a Matrix Market file and stores
+    the values in an one-dimensional 'double complex'-type array following
+    the row-major order, as mtxdat_import(), with the conjugate mirrored
+    entries of Hermitian matrices.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns to output the data following the row-major order, where rows
+    and columns may be obtained through mtxdat_get_sizes().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void mtxdat_import_cplx(const char *file_path, tpdfcplx_impl_ *data) {
+    mtxdat_import_impl_(file_path, NULL, data);
+}
+
+/*
+    Imports double-type data from a Matrix Market file in the coordinate
+    layout into a two-dimensional sparse array in the coordinate (COO) form,
+    without storing the dense matrix. The entries are kept in the order of
+    the file, each followed by its mirror for symmetric and skew-symmetric
+    matrices. Returns 0 on success, the errno of the failure to open the
+    file, or EINVAL if it is not a Matrix Market file in the coordinate
+    layout.
+
+    Parameters:
+    - file_path, path to the file.
+    - sparse, pointer to a dfl_sparse to output dimensions, size, count,
+    the zero-based indices and values. Its arrays must be released with
+    dfl_sparse_free().
+    - allocator, allocator of the arrays, e.g., from dfl_arena_allocator(),
+    or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int mtxdat_import_sparse(const char *file_path, dfl_sparse *sparse,
+    const dfl_allocator *allocator) {
+
+    return mtxdat_import_sparse_impl_(file_path, sparse, allocator, 0);
+}
+
+/*
+    Same as mtxdat_import_sparse(), but for 'double complex'-type data, which
+    is output to the values_cplx array of the sparse array, with the
+    conjugate mirrored entries of Hermitian matrices.
+
+    Parameters:
+    - file_path, path to the file.
+    - sparse, pointer to a dfl_sparse to output the sparse array.
+    - allocator, allocator of the arrays, or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int mtxdat_import_cplx_sparse(const char *file_path, dfl_sparse *sparse,
+    const dfl_allocator *allocator) {
+
+    return mtxdat_import_sparse_impl_(file_path, sparse, allocator, 1);
+}
+
+/*
+    Exports double-type data of an one-dimensional double-type array,
+    following the row-major order, to a Matrix Market file in the array
+    layout of real values with general symmetry.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    containing the data. The data is accessed following the row-major
+    order, i.e., through data[j + columns*i], where i is any row and j is
+    any column.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void mtxdat_export(const char *file_path, const double *data, int rows,
+    int columns) {
+
+    mtxdat_export_impl_(file_path, data, NULL, (size_t)rows,
+        (size_t)columns);
+}
+
+/*
+    Exports 'double complex'-type data of an one-dimensional
+    'double complex'-type array, following the row-major order, to a Matrix
+    Market file in the array layout of complex values with general symmetry.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns containing the data following the row-major order.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void mtxdat_export_cplx(const char *file_path, const tpdfcplx_impl_ *data,
+    int rows, int columns) {
+
+    mtxdat_export_impl_(file_path, NULL, data, (size_t)rows,
+        (size_t)columns);
+}
+
+/*
+    Exports a two-dimensional sparse array in the coordinate (COO) form to
+    a Matrix Market file in the coordinate layout of real values with
+    general symmetry, one entry per value, in the order of the values.
+
+    Parameters:
+    - file_path, path to the file.
+    - sparse, pointer to the sparse array, e.g., from mtxdat_import_sparse()
+    or wldat_import_sparse().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void mtxdat_export_sparse(const char *file_path, const dfl_sparse *sparse) {
+    mtxdat_export_sparse_impl_(file_path, sparse, 0);
+}
+
+/*
+    Same as mtxdat_export_sparse(), but for the 'double complex'-type values
+    of the values_cplx array of the sparse array, written as complex values.
+
+    Parameters:
+    - file_path, path to the file.
+    - sparse, pointer to the sparse array.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void mtxdat_export_cplx_sparse(const char *file_path,
+    const dfl_sparse *sparse) {
+
+    mtxdat_export_sparse_impl_(file_path, sparse, 1);
+}
+
+#endif /* DATA_FILE_LIBRARY_MTXDAT_H */
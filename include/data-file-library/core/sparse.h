@@ -0,0 +1,85 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/sparse.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling the sparse arrays in the coordinate (COO)
+        form output by the sparse imports (the *_import_sparse()
+        functions).
+*/
+
+#ifndef DATA_FILE_LIBRARY_SPARSE_H
+#define DATA_FILE_LIBRARY_SPARSE_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/sparse_impl_.h"
+
+/*
+    Converts a two-dimensional sparse array in the coordinate form to the
+    compressed sparse row (CSR) form, with the values of each row sorted by
+    column, in a time proportional to the number of values, rows and
+    columns. Repeated positions are kept in their order. Returns 0, or
+    EINVAL if the array is not two-dimensional or has no real values.
+
+    Parameters:
+    - sparse, pointer to the sparse array.
+    - row_offsets, one-dimensional long long-type array of size size[0] + 1
+    to output the offsets of the rows, where the values of the row i are
+    those from row_offsets[i] to row_offsets[i + 1] - 1.
+    - column_indices, one-dimensional int-type array of size count to output
+    the column of each value.
+    - values, one-dimensional double-type array of size count to output the
+    values.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int dfl_sparse_to_csr(const dfl_sparse *sparse, long long *row_offsets,
+    int *column_indices, double *values) {
+
+    return dfl_sparse_to_csr_impl_(sparse, row_offsets, column_indices,
+        values, 0);
+}
+
+/*
+    Same as dfl_sparse_to_csr(), but for the 'double complex'-type values
+    of the values_cplx array of the sparse array.
+
+    Parameters:
+    - sparse, pointer to the sparse array.
+    - row_offsets, one-dimensional long long-type array of size size[0] + 1
+    to output the offsets of the rows.
+    - column_indices, one-dimensional int-type array of size count to output
+    the column of each value.
+    - values, one-dimensional complex double-type array of size count to
+    output the values.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int dfl_sparse_to_csr_cplx(const dfl_sparse *sparse, long long *row_offsets,
+    int *column_indices, tpdfcplx_impl_ *values) {
+
+    return dfl_sparse_to_csr_impl_(sparse, row_offsets, column_indices,
+        values, 1);
+}
+
+/*
+    Releases the arrays of a sparse array output by any *_import_sparse()
+    function.
+
+    Parameters:
+    - sparse, pointer to the sparse array, whose pointers are reset.
+    - allocator, the same allocator given to the *_import_sparse() function,
+    or NULL if NULL was given.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void dfl_sparse_free(dfl_sparse *sparse, const dfl_allocator *allocator) {
+    dfl_sparse_free_impl_(sparse, allocator);
+}
+
+#endif /* DATA_FILE_LIBRARY_SPARSE_H */
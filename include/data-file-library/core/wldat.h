@@ -20,6 +20,13 @@
 #endif
 
 #include "../impl/cplx_c_cpp_impl_.h"
+#include "../impl/alloc_impl_.h"
+#include "../impl/batch_impl_.h"
+#include "../impl/async_impl_.h"
+#include "../impl/cache_impl_.h"
+#include "../impl/parallel_impl_.h"
+#include "../impl/sparse_impl_.h"
+#include "../impl/stats_impl_.h"
 #include "../impl/wldat_impl_.h"
 
 /*
@@ -60,7 +67,7 @@ void wldat_get_comment(const char *file_path, char *comment) {
 */
 DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
 int wldat_get_dimensions(const char *file_path) {
-    wldat_get_dimensions_impl_(file_path);
+    return wldat_get_dimensions_impl_(file_path);
 }
 
 /*
@@ -78,6 +85,42 @@ void wldat_get_sizes(const char *file_path, int *size) {
     wldat_get_sizes_impl_(file_path, size);
 }
 
+/*
+    Gets the size of each dimension from a Wolfram Language package source
+    format as size_t, so that dimensions with more than 2^31 elements may be
+    handled.
+
+    Parameters:
+    - file_path, path to the file.
+    - size, array of size given by wldat_get_dimensions(), to
+    sequentially output the size of each dimension. The size of this array
+    is limited to 128.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_get_sizes64(const char *file_path, size_t *size) {
+    wldat_get_sizes64_impl_(file_path, size);
+}
+
+/*
+    Gets the number of dimensions and the size of each dimension from a
+    Wolfram Language package source format as size_t, opening the file once
+    and returning an error instead of exiting, e.g., for bindings to other
+    languages. Returns 0, the errno of the failure to open the file, or
+    EINVAL if the dimensions exceed 128.
+
+    Parameters:
+    - file_path, path to the file.
+    - &dimensions, to output the number of dimensions.
+    - size, array of size 128 to sequentially output the size of each
+    dimension.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_get_sizes_status(const char *file_path, int *dimensions,
+    size_t *size) {
+
+    return wldat_get_sizes_status_impl_(file_path, dimensions, size);
+}
+
 /*
     Imports data of real numbers from a Wolfram Language
     package source format, and stores in an one-dimensional
@@ -116,6 +159,275 @@ void wldat_import_cplx(const char *file_path,
     wldat_import_cplx_impl_(file_path, data); 
 }
 
+/*
+    Imports data of real numbers from a Wolfram Language package source
+    format into an one-dimensional double-type array allocated by the
+    library, following the row-major order, so that the dimensions and sizes
+    do not need to be known in advance. The returned data and size arrays
+    must be released with dfl_free() and the same allocator.
+
+    Parameters:
+    - file_path, path to the data file.
+    - &dimensions, to output the number N of dimensions.
+    - &size, to output an array of size N, allocated by the library, with
+    the size of each dimension.
+    - allocator, allocator of the returned arrays, e.g., from
+    dfl_arena_allocator(), or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+double *wldat_import_alloc(const char *file_path, int *dimensions,
+    int **size, const dfl_allocator *allocator) {
+
+    return wldat_import_alloc_impl_(file_path, dimensions, size, allocator);
+}
+
+/*
+    Imports data of complex numbers from a Wolfram Language package source
+    format into an one-dimensional 'double complex'-type array allocated by
+    the library, following the row-major order, so that the dimensions and
+    sizes do not need to be known in advance. The returned data and size
+    arrays must be released with dfl_free() and the same allocator.
+
+    Parameters:
+    - file_path, path to the data file.
+    - &dimensions, to output the number N of dimensions.
+    - &size, to output an array of size N, allocated by the library, with
+    the size of each dimension.
+    - allocator, allocator of the returned arrays, e.g., from
+    dfl_arena_allocator(), or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+tpdfcplx_impl_ *wldat_import_cplx_alloc(const char *file_path,
+    int *dimensions, int **size, const dfl_allocator *allocator) {
+
+    return wldat_import_cplx_alloc_impl_(file_path, dimensions, size,
+        allocator);
+}
+
+/*
+    Imports data of real numbers from a Wolfram Language package source
+    format into a double-type array with arbitrary strides, e.g., following
+    the column-major order or into a sub-block of a larger array, without an
+    intermediate copy.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type to output the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]], where N may
+    be obtained through wldat_get_dimensions(). The row-major order has
+    stride[N-1] = 1 and stride[n-1] = stride[n]*Sn+1, and the column-major
+    order has stride[0] = 1 and stride[n] = stride[n-1]*Sn.
+    - stride, array of size N containing the stride of each dimension.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_import_strided(const char *file_path, double *data,
+    const int *stride) {
+
+    wldat_import_strided_impl_(file_path, data, stride);
+}
+
+/*
+    Imports data of complex numbers from a Wolfram Language package source
+    format into a 'double complex'-type array with arbitrary strides. See
+    wldat_import_strided() and wldat_import_cplx().
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type to output the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - stride, array of size N containing the stride of each dimension.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_import_cplx_strided(const char *file_path, tpdfcplx_impl_ *data,
+    const int *stride) {
+
+    wldat_import_cplx_strided_impl_(file_path, data, stride);
+}
+
+/*
+    Reads data of real numbers from a Wolfram Language package source format
+    of known dimensions and sizes, e.g., from wldat_get_sizes_status(), into
+    a double-type array with arbitrary strides, without scanning the file
+    again for its dimensions and returning the errno of the failure to open
+    the file instead of exiting. Returns 0 on success.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type to output the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - dimensions, number N of dimensions of the data.
+    - stride, array of size N containing the stride of each dimension.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_read_strided(const char *file_path, double *data, int dimensions,
+    const ptrdiff_t *stride) {
+
+    return wldat_read_status_impl_(file_path, data, NULL, dimensions, stride);
+}
+
+/*
+    Same as wldat_read_strided(), but for data of complex numbers.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type to output the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - dimensions, number N of dimensions of the data.
+    - stride, array of size N containing the stride of each dimension.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_read_cplx_strided(const char *file_path, tpdfcplx_impl_ *data,
+    int dimensions, const ptrdiff_t *stride) {
+
+    return wldat_read_status_impl_(file_path, NULL, data, dimensions, stride);
+}
+
+/*
+    Imports data of complex numbers from a Wolfram Language package source
+    format into two double-type arrays, one with the real parts and one with
+    the imaginary parts (split planes), without an interleaved intermediate
+    array.
+
+    Parameters:
+    - file_path, path to the data file.
+    - re, array of double-type of size S1*S2*...*SN to output the real parts
+    following the row-major order, where N may be obtained through
+    wldat_get_dimensions() and Sn through wldat_get_sizes().
+    - im, array of double-type of size S1*S2*...*SN to output the imaginary
+    parts following the row-major order.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_import_cplx_split(const char *file_path, double *re,
+    double *im) {
+
+    wldat_import_cplx_split_impl_(file_path, re, im);
+}
+
+/*
+    Imports double-type data from a Wolfram Language package source format,
+    as wldat_import(), but with many threads, each of which parses a range
+    of the top-level sub-lists directly into its block of the output. The
+    sizes and the start of the sub-lists are found by a single scan of the
+    braces. Data of one dimension is imported by the calling thread only.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type of size S1*S2*...*SN to output the values
+    following the row-major order, where N may be obtained through
+    wldat_get_dimensions() and Sn through wldat_get_sizes().
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_import_parallel(const char *file_path, double *data,
+    int threads) {
+
+    wldat_import_parallel_impl_(file_path, data, NULL, threads);
+}
+
+/*
+    Same as wldat_import_parallel(), but for 'double complex'-type data, as
+    wldat_import_cplx().
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type of size S1*S2*...*SN to output
+    the values following the row-major order.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_import_cplx_parallel(const char *file_path, tpdfcplx_impl_ *data,
+    int threads) {
+
+    wldat_import_parallel_impl_(file_path, NULL, data, threads);
+}
+
+/*
+    Computes the statistics of the values of a Wolfram Language package
+    source format while it is parsed, without storing them, grouped by their
+    index along an axis, e.g., the last axis for the columns of a matrix.
+    Returns the size of the axis, or 1 if all values are grouped together.
+
+    Parameters:
+    - file_path, path to the data file.
+    - stats, array of max_count dfl_stats to output the count, the number of
+    skipped values, min, max, sum, mean, population variance and Euclidean
+    norm of the first max_count indices.
+    - max_count, size of the stats array.
+    - axis, dimension whose index groups the values, from 0 for the
+    outermost to N-1 for the innermost, or -1 to group all values in
+    stats[0].
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_stats(const char *file_path, dfl_stats *stats, int max_count,
+    int axis) {
+
+    return wldat_stats_impl_(file_path, stats, max_count, axis, 0);
+}
+
+/*
+    Same as wldat_stats(), but for 'double complex'-type data, whose
+    statistics are those of the absolute values.
+
+    Parameters:
+    - file_path, path to the data file.
+    - stats, array of max_count dfl_stats to output the statistics of the
+    absolute values of the first max_count indices.
+    - max_count, size of the stats array.
+    - axis, dimension whose index groups the values, or -1.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_stats_cplx(const char *file_path, dfl_stats *stats, int max_count,
+    int axis) {
+
+    return wldat_stats_impl_(file_path, stats, max_count, axis, 1);
+}
+
+/*
+    Imports double-type data from many Wolfram Language package source
+    files at once, using a pool of threads that take the files one after
+    another and read ahead the next files while the current ones are
+    parsed. For each file, the dimensions and size of each dimension, the
+    data, and a status are output to the respective item. The arrays of the
+    items must be released with dfl_batch_free().
+
+    Parameters:
+    - file_paths, array of count paths.
+    - count, number of files.
+    - items, array of count dfl_batch_item to output, for each file, status
+    (0 on success or the errno of the failure, which never exits the
+    process), dimensions, size and data.
+    - threads, number of threads, where 0 selects the number of processors.
+    - allocator, allocator of the arrays of the items, e.g., from
+    dfl_arena_allocator(), or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_import_batch(const char *const *file_paths, int count,
+    dfl_batch_item *items, int threads, const dfl_allocator *allocator) {
+
+    batch_import_impl_(file_paths, count, items, threads, allocator, ',',
+        1, 0);
+}
+
+/*
+    Same as wldat_import_batch(), but for 'double complex'-type data, which
+    is output to the data_cplx array of each item.
+
+    Parameters:
+    - file_paths, array of count paths.
+    - count, number of files.
+    - items, array of count dfl_batch_item to output, for each file, status,
+    dimensions, size and data_cplx.
+    - threads, number of threads, where 0 selects the number of processors.
+    - allocator, allocator of the arrays of the items, or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_import_cplx_batch(const char *const *file_paths, int count,
+    dfl_batch_item *items, int threads, const dfl_allocator *allocator) {
+
+    batch_import_impl_(file_paths, count, items, threads, allocator, ',',
+        1, 1);
+}
+
 /*
     Exports double-type data of an one-dimensional
     double-type array, following the row-major order, to Wolfram Language
@@ -135,7 +447,7 @@ void wldat_export(const char *file_path,
     const double *data, int dimensions, const int *size,
     const char *comment) {
 
-    wldat_export_impl_(file_path, data, dimensions, size, comment);
+    wldat_export_impl_(file_path, data, dimensions, size, comment, NULL);
 }
 
 /*
@@ -159,7 +471,429 @@ void wldat_export_cplx(const char *file_path,
     const char *comment) {
 
     wldat_export_cplx_impl_(file_path, data, dimensions, size,
+        comment, NULL);
+}
+
+/*
+    Exports double-type data of a double-type array with arbitrary strides,
+    e.g., following the column-major order or a sub-block of a larger array,
+    to Wolfram Language package source format, without an intermediate copy.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type containing the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - stride, array of size N containing the stride of each dimension.
+    - comment, text to be stored at the very first line of the file.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_export_strided(const char *file_path, const double *data,
+    int dimensions, const int *size, const int *stride, const char *comment) {
+
+    wldat_export_strided_impl_(file_path, data, dimensions, size, stride,
+        comment, NULL);
+}
+
+/*
+    Exports 'double complex'-type data of a 'double complex'-type array with
+    arbitrary strides to Wolfram Language package source format. See
+    wldat_export_strided() and wldat_export_cplx().
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type containing the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - stride, array of size N containing the stride of each dimension.
+    - comment, text to be stored at the very first line of the file.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_export_cplx_strided(const char *file_path,
+    const tpdfcplx_impl_ *data, int dimensions, const int *size,
+    const int *stride, const char *comment) {
+
+    wldat_export_cplx_strided_impl_(file_path, data, dimensions, size, stride,
+        comment, NULL);
+}
+
+/*
+    Exports 'double complex'-type data given by two double-type arrays, one
+    with the real parts and one with the imaginary parts (split planes),
+    following the row-major order, to Wolfram Language package source format
+    of arbitrary dimension, without an interleaved intermediate array.
+
+    Parameters:
+    - file_path, path to the data file.
+    - re, array of double-type of size S1*S2*...*SN containing the real
+    parts.
+    - im, array of double-type of size S1*S2*...*SN containing the
+    imaginary parts.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_export_cplx_split(const char *file_path, const double *re,
+    const double *im, int dimensions, const int *size, const char *comment) {
+
+    wldat_export_cplx_split_impl_(file_path, re, im, dimensions, size,
+        comment, NULL);
+}
+
+/*
+    Exports double-type data of an one-dimensional double-type array,
+    following the row-major order, to Wolfram Language package source format
+    of arbitrary dimension, as wldat_export(), but with the numbers written
+    as given by the options, e.g., with the fewest digits that are read back
+    as the same values, without spaces and with integer values written as
+    integers, which makes the files smaller and faster to write.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type of size S1*S2*...*SN, containing data
+    following the row-major order.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+    - format, pointer to a dfl_wl_format with the options (precision,
+    no_spaces and integers), or NULL for the form of wldat_export().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_export_formatted(const char *file_path, const double *data,
+    int dimensions, const int *size, const char *comment,
+    const dfl_wl_format *format) {
+
+    wldat_export_impl_(file_path, data, dimensions, size, comment, format);
+}
+
+/*
+    Exports 'double complex'-type data of an one-dimensional
+    'double complex'-type array, following the row-major order, to Wolfram
+    Language package source format of arbitrary dimension, as
+    wldat_export_cplx(), but with the numbers written as given by the
+    options. See wldat_export_formatted().
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type of size S1*S2*...*SN,
+    containing data following the row-major order.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+    - format, pointer to a dfl_wl_format with the options, or NULL for the
+    form of wldat_export_cplx().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_export_cplx_formatted(const char *file_path,
+    const tpdfcplx_impl_ *data, int dimensions, const int *size,
+    const char *comment, const dfl_wl_format *format) {
+
+    wldat_export_cplx_impl_(file_path, data, dimensions, size, comment,
+        format);
+}
+
+/*
+    Exports double-type data of an one-dimensional double-type array,
+    following the row-major order, to Wolfram Language package source format
+    of arbitrary dimension, as wldat_export(), but with the sizes as size_t,
+    so that more than 2^31 values may be exported, e.g., a 2048x2048x2048
+    field.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type of size S1*S2*...*SN, containing data
+    following the row-major order.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_export64(const char *file_path, const double *data,
+    int dimensions, const size_t *size, const char *comment) {
+
+    wldat_export64_impl_(file_path, data, dimensions, size, comment, NULL);
+}
+
+/*
+    Exports 'double complex'-type data of an one-dimensional
+    'double complex'-type array, following the row-major order, to Wolfram
+    Language package source format of arbitrary dimension, as
+    wldat_export_cplx(), but with the sizes as size_t, so that more than
+    2^31 values may be exported.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type of size S1*S2*...*SN,
+    containing data following the row-major order.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_export_cplx64(const char *file_path, const tpdfcplx_impl_ *data,
+    int dimensions, const size_t *size, const char *comment) {
+
+    wldat_export_cplx64_impl_(file_path, data, dimensions, size, comment,
+        NULL);
+}
+
+/*
+    Exports double-type data of an one-dimensional double-type array,
+    following the row-major order, to Wolfram Language package source format
+    of arbitrary dimension, as wldat_export(), but for files of many
+    gigabytes, which are written without filling the page cache. On Linux
+    with the GNU C library, the file is preallocated with an upper bound of
+    its size and written in aligned blocks with O_DIRECT, falling back to
+    buffered writes whose pages are dropped from the page cache if the file
+    system does not support it. This needs _GNU_SOURCE defined before any
+    #include; see csvdat_export_direct(). Returns 0, or the errno of the
+    failure to open or write the file.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type of size S1*S2*...*SN, containing data
+    following the row-major order.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_export_direct(const char *file_path, const double *data,
+    int dimensions, const int *size, const char *comment) {
+
+    return wldat_export_direct_impl_(file_path, data, NULL, dimensions, size,
+        comment);
+}
+
+/*
+    Exports 'double complex'-type data of an one-dimensional
+    'double complex'-type array, following the row-major order, to Wolfram
+    Language package source format of arbitrary dimension, as
+    wldat_export_cplx(), but without filling the page cache. See
+    wldat_export_direct().
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type of size S1*S2*...*SN,
+    containing data following the row-major order.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_export_cplx_direct(const char *file_path,
+    const tpdfcplx_impl_ *data, int dimensions, const int *size,
+    const char *comment) {
+
+    return wldat_export_direct_impl_(file_path, NULL, data, dimensions, size,
         comment);
 }
 
+/*
+    Imports double-type data from a Wolfram Language package source format
+    through a cache, so that repeated imports of a file that did not change
+    are memory lookups. Concurrent imports of the same file share a single
+    parse. The values are shared with the other views of the file, must not
+    be modified, and remain valid until the view is released with
+    dfl_cache_release(). Returns the status of the view.
+
+    Parameters:
+    - cache, cache from dfl_cache_create().
+    - file_path, path to the file.
+    - view, pointer to a dfl_cache_view to output status (0 on success or
+    the errno of the failure to open the file), dimensions, size and data.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_import_cached(dfl_cache *cache, const char *file_path,
+    dfl_cache_view *view) {
+
+    return cache_import_impl_(cache, file_path, view, DFL_CACHE_WL_IMPL_, 0);
+}
+
+/*
+    Same as wldat_import_cached(), but for 'double complex'-type data, which
+    is output to the data_cplx field of the view.
+
+    Parameters:
+    - cache, cache from dfl_cache_create().
+    - file_path, path to the file.
+    - view, pointer to a dfl_cache_view to output status, dimensions, size
+    and data_cplx.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_import_cplx_cached(dfl_cache *cache, const char *file_path,
+    dfl_cache_view *view) {
+
+    return cache_import_impl_(cache, file_path, view, DFL_CACHE_WL_IMPL_, 1);
+}
+
+/*
+    Imports double-type data from a Wolfram Language package source file
+    holding a SparseArray into a sparse array in the coordinate (COO) form,
+    without storing the dense array. Both the rule form,
+    SparseArray[{{i1, ..., iN} -> v, ...}, dims] (dims may be omitted), and
+    the Automatic form written by Put[] are read. Returns 0 on success, the
+    errno of the failure to open the file, or EINVAL if it is not a
+    SparseArray of numbers.
+
+    Parameters:
+    - file_path, path to the data file.
+    - sparse, pointer to a dfl_sparse to output dimensions, size, count,
+    the zero-based indices, values and background. Its arrays must be
+    released with dfl_sparse_free().
+    - allocator, allocator of the arrays, e.g., from dfl_arena_allocator(),
+    or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_import_sparse(const char *file_path, dfl_sparse *sparse,
+    const dfl_allocator *allocator) {
+
+    return wldat_import_sparse_impl_(file_path, sparse, allocator, 0);
+}
+
+/*
+    Same as wldat_import_sparse(), but for 'double complex'-type data, which
+    is output to the values_cplx array of the sparse array.
+
+    Parameters:
+    - file_path, path to the data file.
+    - sparse, pointer to a dfl_sparse to output the sparse array.
+    - allocator, allocator of the arrays, or NULL for malloc().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int wldat_import_cplx_sparse(const char *file_path, dfl_sparse *sparse,
+    const dfl_allocator *allocator) {
+
+    return wldat_import_sparse_impl_(file_path, sparse, allocator, 1);
+}
+
+/*
+    Exports double-type data of a sparse array in the coordinate form to
+    Wolfram Language package source format, as
+    SparseArray[{{i1, ..., iN} -> v, ...}, dims], so that only the explicit
+    values are written.
+
+    Parameters:
+    - file_path, path to the data file.
+    - sparse, pointer to the sparse array, whose dimensions, size, count,
+    indices, values and background are written.
+    - comment, text to be stored at the very first line of the file.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_export_sparse(const char *file_path, const dfl_sparse *sparse,
+    const char *comment) {
+
+    wldat_export_sparse_impl_(file_path, sparse, comment, 0);
+}
+
+/*
+    Same as wldat_export_sparse(), but for the 'double complex'-type data of
+    the values_cplx array of the sparse array.
+
+    Parameters:
+    - file_path, path to the data file.
+    - sparse, pointer to the sparse array.
+    - comment, text to be stored at the very first line of the file.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void wldat_export_cplx_sparse(const char *file_path,
+    const dfl_sparse *sparse, const char *comment) {
+
+    wldat_export_sparse_impl_(file_path, sparse, comment, 1);
+}
+
+/*
+    Asynchronous version of wldat_import(), run by a thread of the
+    executor. Returns a task, which may be polled, waited on or cancelled,
+    and must be released with dfl_task_release(). The data array must
+    remain valid until the task finishes.
+
+    Parameters:
+    - executor, executor from dfl_executor_create().
+    - file_path, path to the data file.
+    - data, array of double-type of size S1*S2*...*SN.
+    - callback, function called when the task finishes, or NULL.
+    - user_data, pointer given back to the callback.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_task *wldat_import_async(dfl_executor *executor, const char *file_path,
+    double *data, dfl_task_callback callback, void *user_data) {
+
+    return wldat_import_async_impl_(executor, file_path, data, 0, callback,
+        user_data);
+}
+
+/*
+    Asynchronous version of wldat_import_cplx(). See wldat_import_async().
+
+    Parameters:
+    - executor, executor from dfl_executor_create().
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type of size S1*S2*...*SN.
+    - callback, function called when the task finishes, or NULL.
+    - user_data, pointer given back to the callback.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_task *wldat_import_cplx_async(dfl_executor *executor,
+    const char *file_path, tpdfcplx_impl_ *data, dfl_task_callback callback,
+    void *user_data) {
+
+    return wldat_import_async_impl_(executor, file_path, data, 1, callback,
+        user_data);
+}
+
+/*
+    Asynchronous version of wldat_export(), run by a thread of the
+    executor. Returns a task, which may be polled, waited on or cancelled,
+    and must be released with dfl_task_release(). The size array and the
+    comment are copied, but the data array must remain valid until the task
+    finishes.
+
+    Parameters:
+    - executor, executor from dfl_executor_create().
+    - file_path, path to the data file.
+    - data, array of double-type of size S1*S2*...*SN.
+    - dimensions, number N of the dimensions of the data, limited to 128,
+    above which the task fails with EINVAL.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+    - callback, function called when the task finishes, or NULL.
+    - user_data, pointer given back to the callback.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_task *wldat_export_async(dfl_executor *executor, const char *file_path,
+    const double *data, int dimensions, const int *size,
+    const char *comment, dfl_task_callback callback, void *user_data) {
+
+    return wldat_export_async_impl_(executor, file_path, data, dimensions,
+        size, comment, 0, callback, user_data);
+}
+
+/*
+    Asynchronous version of wldat_export_cplx(). See wldat_export_async().
+
+    Parameters:
+    - executor, executor from dfl_executor_create().
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type of size S1*S2*...*SN.
+    - dimensions, number N of the dimensions of the data, limited to 128,
+    above which the task fails with EINVAL.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+    - callback, function called when the task finishes, or NULL.
+    - user_data, pointer given back to the callback.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+dfl_task *wldat_export_cplx_async(dfl_executor *executor,
+    const char *file_path, const tpdfcplx_impl_ *data, int dimensions,
+    const int *size, const char *comment, dfl_task_callback callback,
+    void *user_data) {
+
+    return wldat_export_async_impl_(executor, file_path, data, dimensions,
+        size, comment, 1, callback, user_data);
+}
+
 #endif /* DATA_FILE_LIBRARY_WLDAT_H */
\ No newline at end of file
@@ -0,0 +1,205 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/core/zarrdat.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Functions for handling chunked stores of N-dimensional arrays in the
+        Zarr version 2 layout (directories with a .zarray manifest and one
+        file per chunk), written and read in parallel, whose slabs are read
+        from the overlapping chunks only.
+*/
+
+#ifndef DATA_FILE_LIBRARY_ZARRDAT_H
+#define DATA_FILE_LIBRARY_ZARRDAT_H
+
+#ifndef DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+#define DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_ static inline
+#endif
+
+#include "../impl/zarrdat_impl_.h"
+
+/*
+    Gets the number of dimensions of a Zarr store.
+
+    Parameter:
+    - dir_path, path to the directory of the store.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int zarrdat_get_dimensions(const char *dir_path) {
+    return zarrdat_get_sizes_impl_(dir_path, NULL, NULL);
+}
+
+/*
+    Gets the size of each dimension of a Zarr store.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - size, one-dimensional int-type array of size N to output the size of
+    each dimension, where N may be obtained through zarrdat_get_dimensions().
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void zarrdat_get_sizes(const char *dir_path, int *size) {
+    zarrdat_get_sizes_impl_(dir_path, size, NULL);
+}
+
+/*
+    Gets the size of each dimension of the chunks of a Zarr store.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - chunk, one-dimensional int-type array of size N to output the size of
+    each dimension of the chunks.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+void zarrdat_get_chunks(const char *dir_path, int *chunk) {
+    zarrdat_get_sizes_impl_(dir_path, NULL, chunk);
+}
+
+/*
+    Exports double-type data of an one-dimensional double-type array,
+    following the row-major order, to a Zarr store of float64 values. The
+    chunks at the edges of the array are padded with zeros, and the chunks
+    are written in parallel. Returns 0 on success, the errno of the failure
+    to write a file, or EINVAL for invalid sizes, or a level above 0 when
+    the library is compiled without DATA_FILE_LIBRARY_ZLIB.
+
+    Parameters:
+    - dir_path, path to the directory of the store, created if needed.
+    - data, one-dimensional double-type array of the size S1*S2*...*SN
+    containing the data following the row-major order.
+    - dimensions, number N of dimensions.
+    - size, one-dimensional int-type array of size N with the size of each
+    dimension.
+    - chunk, one-dimensional int-type array of size N with the size of each
+    dimension of the chunks.
+    - level, zlib compression level (1 to 9) of the chunks, or 0 for raw
+    chunks.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int zarrdat_export(const char *dir_path, const double *data, int dimensions,
+    const int *size, const int *chunk, int level, int threads) {
+
+    return zarrdat_export_impl_(dir_path, data, dimensions, size, chunk,
+        level, threads, 0);
+}
+
+/*
+    Exports complex double-type data of an one-dimensional complex
+    double-type array, following the row-major order, to a Zarr store of
+    complex128 values. Returns as zarrdat_export().
+
+    Parameters:
+    - dir_path, path to the directory of the store, created if needed.
+    - data, one-dimensional complex double-type array of the size
+    S1*S2*...*SN containing the data following the row-major order.
+    - dimensions, number N of dimensions.
+    - size, one-dimensional int-type array of size N with the size of each
+    dimension.
+    - chunk, one-dimensional int-type array of size N with the size of each
+    dimension of the chunks.
+    - level, zlib compression level (1 to 9) of the chunks, or 0 for raw
+    chunks.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int zarrdat_export_cplx(const char *dir_path, const tpdfcplx_impl_ *data,
+    int dimensions, const int *size, const int *chunk, int level,
+    int threads) {
+
+    return zarrdat_export_impl_(dir_path, data, dimensions, size, chunk,
+        level, threads, 1);
+}
+
+/*
+    Imports double-type data from a Zarr store of float64 values, raw or
+    zlib-compressed, reading its chunks in parallel. Missing chunks hold the
+    fill value of the store. Returns 0 on success, the errno of the failure
+    to open a file, or EINVAL if the store is not supported or is of
+    complex128 values.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - data, one-dimensional double-type array of the size S1*S2*...*SN to
+    output the data following the row-major order, where the sizes may be
+    obtained through zarrdat_get_sizes().
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int zarrdat_import(const char *dir_path, double *data, int threads) {
+    return zarrdat_import_slab_impl_(dir_path, data, NULL, NULL, threads, 0);
+}
+
+/*
+    Imports complex double-type data from a Zarr store of complex128
+    values. Returns as zarrdat_import(), with EINVAL for stores of float64
+    values.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - data, one-dimensional complex double-type array of the size
+    S1*S2*...*SN to output the data following the row-major order.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int zarrdat_import_cplx(const char *dir_path, tpdfcplx_impl_ *data,
+    int threads) {
+
+    return zarrdat_import_slab_impl_(dir_path, data, NULL, NULL, threads, 1);
+}
+
+/*
+    Imports a slab, i.e., the values of the indices start[d] to
+    start[d] + count[d] - 1 of each dimension d, from a Zarr store of
+    float64 values, reading only the chunks that overlap it. Returns as
+    zarrdat_import(), with EINVAL for slabs out of the bounds of the array.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - data, one-dimensional double-type array of the size
+    count[0]*count[1]*...*count[N-1] to output the slab following the
+    row-major order.
+    - start, one-dimensional int-type array of size N with the first index
+    of the slab in each dimension.
+    - count, one-dimensional int-type array of size N with the size of the
+    slab in each dimension.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int zarrdat_import_slab(const char *dir_path, double *data,
+    const int *start, const int *count, int threads) {
+
+    return zarrdat_import_slab_impl_(dir_path, data, start, count, threads,
+        0);
+}
+
+/*
+    Imports a slab from a Zarr store of complex128 values, reading only the
+    chunks that overlap it. Returns as zarrdat_import_slab(), with EINVAL
+    for stores of float64 values.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - data, one-dimensional complex double-type array of the size
+    count[0]*count[1]*...*count[N-1] to output the slab following the
+    row-major order.
+    - start, one-dimensional int-type array of size N with the first index
+    of the slab in each dimension.
+    - count, one-dimensional int-type array of size N with the size of the
+    slab in each dimension.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+DATA_FILE_LIBRARY_STATIC_INLINE_IMPL_
+int zarrdat_import_slab_cplx(const char *dir_path, tpdfcplx_impl_ *data,
+    const int *start, const int *count, int threads) {
+
+    return zarrdat_import_slab_impl_(dir_path, data, start, count, threads,
+        1);
+}
+
+#endif /* DATA_FILE_LIBRARY_ZARRDAT_H */
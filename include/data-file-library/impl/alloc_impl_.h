@@ -0,0 +1,261 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/alloc_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the allocator interface used by the functions that
+        allocate their outputs, and of a growable arena (bump allocator)
+        that may be reset and reused across many imports.
+*/
+
+#ifndef DATA_FILE_LIBRARY_ALLOC_IMPL_H
+#define DATA_FILE_LIBRARY_ALLOC_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For malloc(), free() and EXIT_FAILURE */
+#include <stddef.h> /* For size_t */
+#include <limits.h> /* For INT_MAX */
+
+/*
+    Allocator interface. allocate() must return memory suitably aligned for
+    any type, or NULL on failure; deallocate() may be NULL when the memory
+    is released all at once (e.g., by an arena).
+*/
+typedef struct dfl_allocator {
+    void *(*allocate)(void *context, size_t size);
+    void (*deallocate)(void *context, void *ptr);
+    void *context;
+} dfl_allocator;
+
+/*
+    Block of memory of an arena, followed by its storage.
+*/
+typedef struct dfl_arena_block_impl_ {
+    struct dfl_arena_block_impl_ *next;
+    size_t capacity;
+    size_t used;
+} dfl_arena_block_impl_;
+
+/*
+    Arena of memory. Allocations are served by bumping a pointer inside
+    chained blocks, freeing is a no-op, and a reset makes all the blocks
+    available again without returning them to the system.
+*/
+typedef struct dfl_arena {
+    dfl_arena_block_impl_ *first;
+    dfl_arena_block_impl_ *current;
+    size_t block_size;
+} dfl_arena;
+
+/* Alignment of every allocation of an arena */
+#define DFL_ARENA_ALIGNMENT_IMPL_ 16
+
+/* Size of the block header, rounded up to the alignment */
+#define DFL_ARENA_HEADER_IMPL_ \
+    ((sizeof(dfl_arena_block_impl_) + DFL_ARENA_ALIGNMENT_IMPL_ - 1) \
+    / DFL_ARENA_ALIGNMENT_IMPL_ * DFL_ARENA_ALIGNMENT_IMPL_)
+
+/*
+    Allocates size bytes with the given allocator, or with malloc() if
+    allocator is NULL. Exits if there is no memory available.
+
+    Parameters:
+    - allocator, the allocator, or NULL.
+    - size, number of bytes.
+*/
+static inline void *dfl_allocate_impl_(const dfl_allocator *allocator,
+    size_t size) {
+
+    void *ptr;
+    if (size == 0) size = 1;
+    if (allocator == NULL) {
+        ptr = malloc(size);
+    } else {
+        ptr = allocator->allocate(allocator->context, size);
+    }
+    if (ptr == NULL) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " dfl_allocate_impl_() ->"
+                        " Error in allocating %lu bytes."
+                        " Exiting.", (unsigned long)size);
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+/*
+    Returns a size as int for the functions with int sizes, exiting if it
+    exceeds INT_MAX instead of truncating it. The functions with size_t
+    sizes (e.g., *_get_sizes64()) have no such limit.
+
+    Parameters:
+    - size, the size.
+    - function, name of the calling function, for the warning.
+*/
+static inline int size_to_int_impl_(size_t size, const char *function) {
+    if (size > (size_t)INT_MAX) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " %s() ->"
+                        " Error: Size %lu exceeds INT_MAX."
+                        " Exiting.", function, (unsigned long)size);
+        exit(EXIT_FAILURE);
+    }
+    return (int)size;
+}
+
+/*
+    Doubles the capacity of a buffer allocated with malloc(), e.g., of the
+    characters of a value, so that long values are never cut short. Exits if
+    there is no memory available.
+
+    Parameters:
+    - buffer, the buffer, which is reallocated.
+    - capacity, size of the buffer, which is doubled.
+    - function, name of the calling function, for the warning.
+*/
+static inline void buffer_grow_impl_(char **buffer, size_t *capacity,
+    const char *function) {
+
+    char *grown = (char *)realloc(*buffer, 2*(*capacity));
+    if (grown == NULL) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " %s() ->"
+                        " Error in allocating memory."
+                        " Exiting.", function);
+        exit(EXIT_FAILURE);
+    }
+    *buffer = grown;
+    *capacity *= 2;
+}
+
+/*
+    Releases memory from dfl_allocate_impl_() with the same allocator.
+
+    Parameters:
+    - allocator, the allocator, or NULL.
+    - ptr, memory to be released, may be NULL.
+*/
+static inline void dfl_free_impl_(const dfl_allocator *allocator,
+    void *ptr) {
+
+    if (ptr == NULL) return;
+    if (allocator == NULL) {
+        free(ptr);
+    } else if (allocator->deallocate != NULL) {
+        allocator->deallocate(allocator->context, ptr);
+    }
+}
+
+/*
+    Implementation for initializing an arena.
+
+    Parameters:
+    - arena, the arena.
+    - block_size, minimum size in bytes of each block, where 0 selects
+    1 MiB. Larger requests get blocks of their own size.
+*/
+static inline void dfl_arena_init_impl_(dfl_arena *arena,
+    size_t block_size) {
+
+    arena->first = NULL;
+    arena->current = NULL;
+    arena->block_size = block_size > 0 ? block_size : (size_t)1 << 20;
+}
+
+/*
+    Implementation of allocate() for arenas.
+
+    Parameters:
+    - context, the dfl_arena.
+    - size, number of bytes.
+*/
+static inline void *dfl_arena_allocate_impl_(void *context, size_t size) {
+
+    dfl_arena *arena = (dfl_arena *)context;
+    size = (size + DFL_ARENA_ALIGNMENT_IMPL_ - 1)
+        / DFL_ARENA_ALIGNMENT_IMPL_ * DFL_ARENA_ALIGNMENT_IMPL_;
+
+    /* Look for room in the current block and the ones after it */
+    dfl_arena_block_impl_ *block = arena->current;
+    dfl_arena_block_impl_ *last = arena->current;
+    while (block != NULL) {
+        if (block->capacity - block->used >= size) {
+            void *ptr = (char *)block + DFL_ARENA_HEADER_IMPL_ + block->used;
+            block->used += size;
+            arena->current = block;
+            return ptr;
+        }
+        last = block;
+        block = block->next;
+    }
+
+    /* Append a new block */
+    size_t capacity = size > arena->block_size ? size : arena->block_size;
+    block = (dfl_arena_block_impl_ *)malloc(DFL_ARENA_HEADER_IMPL_ +
+        capacity);
+    if (block == NULL) return NULL;
+    block->next = NULL;
+    block->capacity = capacity;
+    block->used = size;
+    if (last == NULL) {
+        arena->first = block;
+    } else {
+        last->next = block;
+    }
+    arena->current = block;
+    return (char *)block + DFL_ARENA_HEADER_IMPL_;
+}
+
+/*
+    Implementation for returning the allocator that allocates from an arena.
+
+    Parameters:
+    - arena, the arena.
+*/
+static inline dfl_allocator dfl_arena_allocator_impl_(dfl_arena *arena) {
+    dfl_allocator allocator;
+    allocator.allocate = dfl_arena_allocate_impl_;
+    allocator.deallocate = NULL;
+    allocator.context = arena;
+    return allocator;
+}
+
+/*
+    Implementation for making all the memory of an arena available again,
+    without returning it to the system. Every pointer previously allocated
+    from the arena becomes invalid.
+
+    Parameters:
+    - arena, the arena.
+*/
+static inline void dfl_arena_reset_impl_(dfl_arena *arena) {
+    for (dfl_arena_block_impl_ *block = arena->first; block != NULL;
+        block = block->next) {
+        block->used = 0;
+    }
+    arena->current = arena->first;
+}
+
+/*
+    Implementation for returning all the memory of an arena to the system.
+
+    Parameters:
+    - arena, the arena.
+*/
+static inline void dfl_arena_destroy_impl_(dfl_arena *arena) {
+    dfl_arena_block_impl_ *block = arena->first;
+    while (block != NULL) {
+        dfl_arena_block_impl_ *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->first = NULL;
+    arena->current = NULL;
+}
+
+#endif /* DATA_FILE_LIBRARY_ALLOC_IMPL_H */
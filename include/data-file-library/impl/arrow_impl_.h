@@ -0,0 +1,398 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/arrow_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the export of imported data through the Apache
+        Arrow C Data Interface, whose ArrowSchema and ArrowArray structs are
+        defined here as in the Arrow specification, so that no Arrow library
+        is needed. The data is imported directly into the column buffers of
+        a struct array, whose release callbacks free them, so that the
+        consumer (pyarrow, polars, DuckDB, ...) takes it without a copy. The
+        buffers are owned by a reference-counted owner, which is either an
+        allocation or a memory-mapped file, so that the children may be
+        moved out of the parent and released on their own.
+*/
+
+#ifndef DATA_FILE_LIBRARY_ARROW_IMPL_H
+#define DATA_FILE_LIBRARY_ARROW_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For malloc() and free() */
+#include <string.h> /* For memset() and strerror() */
+#include <errno.h> /* For errno */
+#include <stdint.h> /* For int64_t and uintptr_t */
+#include <sys/stat.h> /* For stat() */
+#include "alloc_impl_.h"
+#include "thread_impl_.h"
+#include "sepdat_impl_.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h> /* For open() */
+#include <sys/mman.h> /* For mmap() and munmap() */
+#endif
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+/*
+    Type of an array of the Arrow C Data Interface.
+*/
+struct ArrowSchema {
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+    void (*release)(struct ArrowSchema *);
+    void *private_data;
+};
+
+/*
+    Data of an array of the Arrow C Data Interface.
+*/
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+    void (*release)(struct ArrowArray *);
+    void *private_data;
+};
+
+#endif /* ARROW_C_DATA_INTERFACE */
+
+/* Alignment in bytes of the buffers, as recommended by Arrow */
+#define DFL_ARROW_ALIGNMENT_IMPL_ 64
+
+/*
+    Reference-counted owner of the memory behind the buffers of arrays,
+    which is either an allocation or the bytes of a memory-mapped file.
+*/
+typedef struct {
+    tpmutex_impl_ mutex;
+    int references;
+    void *memory;
+    const unsigned char *bytes;
+    size_t size;
+    int mapped;
+} arrow_owner_impl_;
+
+/*
+    Private data of an array: the owner and the pointers of its buffers.
+*/
+typedef struct {
+    arrow_owner_impl_ *owner;
+    const void *buffers[2];
+} arrow_private_impl_;
+
+/*
+    Creates an owner of an allocation, with one reference.
+
+    Parameter:
+    - memory, the allocation, released with free().
+*/
+static inline arrow_owner_impl_ *arrow_owner_create_impl_(void *memory) {
+    arrow_owner_impl_ *owner = (arrow_owner_impl_ *)dfl_allocate_impl_(NULL,
+        sizeof(arrow_owner_impl_));
+    mutex_init_impl_(&owner->mutex);
+    owner->references = 1;
+    owner->memory = memory;
+    owner->bytes = (const unsigned char *)memory;
+    owner->size = 0;
+    owner->mapped = 0;
+    return owner;
+}
+
+/*
+    Adds a reference to an owner.
+*/
+static inline void arrow_owner_retain_impl_(arrow_owner_impl_ *owner) {
+    mutex_lock_impl_(&owner->mutex);
+    owner->references++;
+    mutex_unlock_impl_(&owner->mutex);
+}
+
+/*
+    Removes a reference from an owner, and releases its memory with the
+    last one.
+*/
+static inline void arrow_owner_release_impl_(arrow_owner_impl_ *owner) {
+    mutex_lock_impl_(&owner->mutex);
+    int references = --owner->references;
+    mutex_unlock_impl_(&owner->mutex);
+    if (references > 0) return;
+
+    if (owner->mapped) {
+#if defined(_WIN32) || defined(_WIN64)
+        UnmapViewOfFile((LPCVOID)owner->bytes);
+#else
+        munmap((void *)owner->bytes, owner->size);
+#endif
+    }
+    free(owner->memory);
+    mutex_destroy_impl_(&owner->mutex);
+    free(owner);
+}
+
+/*
+    Maps a file into memory, read-only, and returns its owner, or NULL with
+    the errno of the failure to open it in status. Where the file cannot be
+    mapped, it is read into an allocation instead.
+
+    Parameters:
+    - file_path, path to the file.
+    - status, to output the errno on failure.
+*/
+static inline arrow_owner_impl_ *arrow_map_impl_(const char *file_path,
+    int *status) {
+
+    /* Report a missing or unreadable file instead of exiting */
+    FILE *file = fopen(file_path, "rb");
+    struct stat info;
+    if (!file || stat(file_path, &info) != 0) {
+        *status = errno != 0 ? errno : EIO;
+        if (file) fclose(file);
+        return NULL;
+    }
+    size_t size = (size_t)info.st_size;
+    arrow_owner_impl_ *owner = arrow_owner_create_impl_(NULL);
+    owner->size = size;
+
+    /* Map the file */
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE handle = CreateFileA(file_path, GENERIC_READ, FILE_SHARE_READ,
+        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle != INVALID_HANDLE_VALUE && size > 0) {
+        HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0,
+            NULL);
+        if (mapping != NULL) {
+            LPVOID view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (view != NULL) {
+                owner->bytes = (const unsigned char *)view;
+                owner->mapped = 1;
+            }
+            CloseHandle(mapping);
+        }
+    }
+    if (handle != INVALID_HANDLE_VALUE) CloseHandle(handle);
+#else
+    int fd = open(file_path, O_RDONLY);
+    if (fd >= 0 && size > 0) {
+        void *view = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view != MAP_FAILED) {
+            owner->bytes = (const unsigned char *)view;
+            owner->mapped = 1;
+        }
+    }
+    if (fd >= 0) close(fd);
+#endif
+
+    /* Otherwise, read it */
+    if (!owner->mapped) {
+        owner->memory = dfl_allocate_impl_(NULL, size);
+        owner->bytes = (const unsigned char *)owner->memory;
+        owner->size = fread(owner->memory, 1, size, file);
+    }
+    fclose(file);
+    *status = 0;
+    return owner;
+}
+
+/*
+    Allocates size bytes aligned to DFL_ARROW_ALIGNMENT_IMPL_ and returns
+    them, with the allocation to be released in memory.
+
+    Parameters:
+    - size, number of bytes.
+    - memory, to output the allocation.
+*/
+static inline void *arrow_aligned_allocate_impl_(size_t size, void **memory) {
+    *memory = dfl_allocate_impl_(NULL, size + DFL_ARROW_ALIGNMENT_IMPL_);
+    uintptr_t address = (uintptr_t)*memory;
+    address = (address + DFL_ARROW_ALIGNMENT_IMPL_ - 1) &
+        ~(uintptr_t)(DFL_ARROW_ALIGNMENT_IMPL_ - 1);
+    return (void *)address;
+}
+
+/*
+    Release callback of the schemas, which releases the children, the
+    name and the format.
+*/
+static inline void arrow_schema_release_impl_(struct ArrowSchema *schema) {
+    for (int64_t k = 0; k < schema->n_children; k++) {
+        struct ArrowSchema *child = schema->children[k];
+        if (child->release != NULL) child->release(child);
+        free(child);
+    }
+    free(schema->children);
+    free((void *)schema->name);
+    free((void *)schema->format);
+    schema->release = NULL;
+}
+
+/*
+    Initializes a schema, with n_children zeroed children.
+
+    Parameters:
+    - schema, the schema.
+    - format, format string of the type, e.g., "g" for double or "+s" for
+    a struct.
+    - name, name of the field, copied.
+    - flags, ARROW_FLAG_* flags.
+    - n_children, number of children.
+*/
+static inline void arrow_schema_init_impl_(struct ArrowSchema *schema,
+    const char *format, const char *name, int64_t flags,
+    int64_t n_children) {
+
+    memset(schema, 0, sizeof(struct ArrowSchema));
+    size_t length = strlen(format) + 1;
+    char *format_copy = (char *)dfl_allocate_impl_(NULL, length);
+    memcpy(format_copy, format, length);
+    length = strlen(name) + 1;
+    char *name_copy = (char *)dfl_allocate_impl_(NULL, length);
+    memcpy(name_copy, name, length);
+    schema->format = format_copy;
+    schema->name = name_copy;
+    schema->flags = flags;
+    schema->n_children = n_children;
+    if (n_children > 0) {
+        schema->children = (struct ArrowSchema **)dfl_allocate_impl_(NULL,
+            (size_t)n_children * sizeof(struct ArrowSchema *));
+        for (int64_t k = 0; k < n_children; k++) {
+            schema->children[k] = (struct ArrowSchema *)dfl_allocate_impl_(
+                NULL, sizeof(struct ArrowSchema));
+            memset(schema->children[k], 0, sizeof(struct ArrowSchema));
+        }
+    }
+    schema->release = arrow_schema_release_impl_;
+}
+
+/*
+    Release callback of the arrays, which releases the children and the
+    reference to the owner of the buffers.
+*/
+static inline void arrow_array_release_impl_(struct ArrowArray *array) {
+    for (int64_t k = 0; k < array->n_children; k++) {
+        struct ArrowArray *child = array->children[k];
+        if (child->release != NULL) child->release(child);
+        free(child);
+    }
+    free(array->children);
+    arrow_private_impl_ *data = (arrow_private_impl_ *)array->private_data;
+    arrow_owner_release_impl_(data->owner);
+    free(data);
+    array->release = NULL;
+}
+
+/*
+    Initializes an array whose buffers belong to an owner, to which a
+    reference is added, with n_children zeroed children.
+
+    Parameters:
+    - array, the array.
+    - owner, the owner of the buffers.
+    - length, number of elements.
+    - null_count, number of null elements.
+    - n_buffers, number of buffers, 1 for structs or 2 for primitive types.
+    - validity, validity bitmap, or NULL if there are no nulls.
+    - values, values buffer of primitive types, otherwise NULL.
+    - n_children, number of children.
+*/
+static inline void arrow_array_init_impl_(struct ArrowArray *array,
+    arrow_owner_impl_ *owner, int64_t length, int64_t null_count,
+    int64_t n_buffers, const void *validity, const void *values,
+    int64_t n_children) {
+
+    memset(array, 0, sizeof(struct ArrowArray));
+    arrow_private_impl_ *data = (arrow_private_impl_ *)dfl_allocate_impl_(
+        NULL, sizeof(arrow_private_impl_));
+    arrow_owner_retain_impl_(owner);
+    data->owner = owner;
+    data->buffers[0] = validity;
+    data->buffers[1] = values;
+    array->length = length;
+    array->null_count = null_count;
+    array->n_buffers = n_buffers;
+    array->buffers = data->buffers;
+    array->n_children = n_children;
+    if (n_children > 0) {
+        array->children = (struct ArrowArray **)dfl_allocate_impl_(NULL,
+            (size_t)n_children * sizeof(struct ArrowArray *));
+        for (int64_t k = 0; k < n_children; k++) {
+            array->children[k] = (struct ArrowArray *)dfl_allocate_impl_(
+                NULL, sizeof(struct ArrowArray));
+            memset(array->children[k], 0, sizeof(struct ArrowArray));
+        }
+    }
+    array->private_data = data;
+    array->release = arrow_array_release_impl_;
+}
+
+/*
+    Implementation for importing double-type data from a
+    breakline-separated lines and char-separated columns data file into an
+    Arrow struct array of one double-type ("g") child per column, named
+    column_1, column_2, ... The file is parsed directly into the column
+    buffers, which are released by the release callbacks. Returns 0 on
+    success or the errno of the failure to open the file.
+
+    Parameters:
+    - file_path, path to the file.
+    - schema, to output the type of the array.
+    - array, to output the array.
+    - sep, column separator.
+*/
+static inline int sepdat_import_arrow_impl_(const char *file_path,
+    struct ArrowSchema *schema, struct ArrowArray *array, char sep) {
+
+    /* Report a missing or unreadable file instead of exiting */
+    FILE *file = fopen(file_path, "r");
+    if (!file) return errno != 0 ? errno : EIO;
+    fclose(file);
+
+    size_t rows;
+    size_t columns;
+    sepdat_get_sizes64_impl_(file_path, &rows, &columns, sep);
+
+    /* One block of columns, each starting at an aligned address */
+    size_t stride = (rows + 7) & ~(size_t)7;
+    void *memory;
+    double *values = (double *)arrow_aligned_allocate_impl_(
+        stride * columns * sizeof(double), &memory);
+    memset(values, 0, stride * columns * sizeof(double));
+    sepdat_read_strided_impl_(file_path, values, rows, columns, 1,
+        (ptrdiff_t)stride, sep, NULL);
+
+    arrow_owner_impl_ *owner = arrow_owner_create_impl_(memory);
+    arrow_schema_init_impl_(schema, "+s", "", 0, (int64_t)columns);
+    arrow_array_init_impl_(array, owner, (int64_t)rows, 0, 1, NULL, NULL,
+        (int64_t)columns);
+    for (size_t j = 0; j < columns; j++) {
+        char name[32];
+        snprintf(name, sizeof(name), "column_%lu", (unsigned long)(j + 1));
+        arrow_schema_init_impl_(schema->children[j], "g", name, 0, 0);
+        arrow_array_init_impl_(array->children[j], owner, (int64_t)rows, 0,
+            2, NULL, values + j*stride, 0);
+    }
+    arrow_owner_release_impl_(owner);
+    return 0;
+}
+
+#endif /* DATA_FILE_LIBRARY_ARROW_IMPL_H */
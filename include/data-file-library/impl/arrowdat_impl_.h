@@ -0,0 +1,961 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/arrowdat_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the Apache Arrow IPC file format (also known as
+        Feather V2), limited to flat tables of numeric columns, without
+        compression or dictionaries, in little-endian byte order. The
+        metadata of the format are FlatBuffers, which are written and read
+        here by a minimal builder and a bounds-checked reader, so that no
+        Arrow or FlatBuffers library is needed. The files are read through
+        a memory mapping, whose buffers are exported without a copy through
+        the Arrow C Data Interface when the file has one record batch.
+*/
+
+#ifndef DATA_FILE_LIBRARY_ARROWDAT_IMPL_H
+#define DATA_FILE_LIBRARY_ARROWDAT_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For realloc() and free() */
+#include <string.h> /* For memcpy(), memcmp() and strerror() */
+#include <errno.h> /* For errno */
+#include <math.h> /* For NAN */
+#include <stddef.h> /* For size_t and ptrdiff_t */
+#include <stdint.h> /* For the fixed-width integer types */
+#include "alloc_impl_.h"
+#include "arrow_impl_.h"
+
+/* Magic bytes at the start and at the end of the files */
+#define DFL_ARROW_MAGIC_IMPL_ "ARROW1"
+
+/* Version of the metadata written, i.e., V5 */
+#define DFL_ARROW_VERSION_IMPL_ 4
+
+/*
+    Reads an unsigned little-endian integer of count bytes.
+*/
+static inline unsigned long long arrow_read_le_impl_(
+    const unsigned char *bytes, int count) {
+
+    unsigned long long value = 0;
+    for (int k = count - 1; k >= 0; k--) {
+        value = (value << 8) | bytes[k];
+    }
+    return value;
+}
+
+/*
+    Writes an unsigned little-endian integer of count bytes to a file.
+*/
+static inline void arrow_write_le_impl_(FILE *file, unsigned long long value,
+    int count) {
+
+    for (int k = 0; k < count; k++) {
+        putc((int)(value & 0xFF), file);
+        value >>= 8;
+    }
+}
+
+/*
+    FlatBuffer being read, whose positions are offsets from its start. The
+    position 0 holds the offset to the root table, so that 0 marks absent
+    or invalid objects.
+*/
+typedef struct {
+    const unsigned char *bytes;
+    size_t size;
+} fb_reader_impl_;
+
+/*
+    Returns the position of the root table of a FlatBuffer, or 0.
+*/
+static inline size_t fb_get_root_impl_(const fb_reader_impl_ *fb) {
+    if (fb->size < 8) return 0;
+    size_t table = (size_t)arrow_read_le_impl_(fb->bytes, 4);
+    return table >= 4 && table <= fb->size - 4 ? table : 0;
+}
+
+/*
+    Returns the position of a field of size bytes of a table, or 0 if it is
+    absent or out of bounds.
+
+    Parameters:
+    - fb, the FlatBuffer.
+    - table, position of the table, or 0.
+    - slot, index of the field in the schema of the table.
+    - size, size in bytes of the field.
+*/
+static inline size_t fb_get_field_impl_(const fb_reader_impl_ *fb,
+    size_t table, int slot, size_t size) {
+
+    if (table == 0) return 0;
+    int32_t soffset = (int32_t)(uint32_t)arrow_read_le_impl_(
+        fb->bytes + table, 4);
+    long long vtable = (long long)table - (long long)soffset;
+    if (vtable < 0 || (unsigned long long)vtable + 4 > fb->size) return 0;
+    size_t vtable_size = (size_t)arrow_read_le_impl_(fb->bytes + vtable, 2);
+    size_t entry = 4 + 2*(size_t)slot;
+    if (entry + 2 > vtable_size || (size_t)vtable + vtable_size > fb->size) {
+        return 0;
+    }
+    size_t offset = (size_t)arrow_read_le_impl_(fb->bytes + vtable + entry,
+        2);
+    if (offset == 0 || table + offset + size > fb->size) return 0;
+    return table + offset;
+}
+
+/*
+    Returns a scalar field of size bytes of a table, or a default value if
+    it is absent.
+*/
+static inline unsigned long long fb_get_scalar_impl_(
+    const fb_reader_impl_ *fb, size_t table, int slot, int size,
+    unsigned long long value) {
+
+    size_t field = fb_get_field_impl_(fb, table, slot, (size_t)size);
+    return field != 0 ? arrow_read_le_impl_(fb->bytes + field, size) : value;
+}
+
+/*
+    Follows the offset stored at a position, and returns the position of
+    the object it points to, or 0 if it is out of bounds.
+*/
+static inline size_t fb_follow_impl_(const fb_reader_impl_ *fb,
+    size_t position) {
+
+    if (position == 0 || position + 4 > fb->size) return 0;
+    size_t target = position + (size_t)arrow_read_le_impl_(
+        fb->bytes + position, 4);
+    return target > position && target <= fb->size - 4 ? target : 0;
+}
+
+/*
+    Returns the position of the table, vector or string that a field of a
+    table points to, or 0 if it is absent.
+*/
+static inline size_t fb_get_offset_impl_(const fb_reader_impl_ *fb,
+    size_t table, int slot) {
+
+    return fb_follow_impl_(fb, fb_get_field_impl_(fb, table, slot, 4));
+}
+
+/*
+    Returns the position of the first element of a vector field of a table,
+    with its number of elements in count, or 0 if it is absent.
+
+    Parameters:
+    - fb, the FlatBuffer.
+    - table, position of the table.
+    - slot, index of the field in the schema of the table.
+    - size, size in bytes of each element.
+    - count, to output the number of elements.
+*/
+static inline size_t fb_get_vector_impl_(const fb_reader_impl_ *fb,
+    size_t table, int slot, size_t size, size_t *count) {
+
+    *count = 0;
+    size_t vector = fb_get_offset_impl_(fb, table, slot);
+    if (vector == 0) return 0;
+    size_t n = (size_t)arrow_read_le_impl_(fb->bytes + vector, 4);
+    if (n > (fb->size - vector - 4) / size) return 0;
+    *count = n;
+    return vector + 4;
+}
+
+/*
+    Returns the string field of a table, with its length in length, or
+    NULL if it is absent. The string is not null-terminated.
+*/
+static inline const char *fb_get_string_impl_(const fb_reader_impl_ *fb,
+    size_t table, int slot, size_t *length) {
+
+    return (const char *)(fb->bytes +
+        fb_get_vector_impl_(fb, table, slot, 1, length));
+}
+
+/*
+    FlatBuffer being written, whose objects are laid out after the objects
+    that point to them, so that every offset is patched forward once the
+    object it points to is written.
+*/
+typedef struct {
+    unsigned char *bytes;
+    size_t size;
+    size_t capacity;
+} fb_builder_impl_;
+
+/*
+    Field of a table being written: its index in the schema of the table,
+    its size in bytes (1, 2, 4 or 8), and its value. Offsets to other
+    objects are fields of 4 bytes patched by fb_patch_impl_().
+*/
+typedef struct {
+    int slot;
+    int size;
+    unsigned long long value;
+} fb_field_impl_;
+
+/*
+    Appends count zeroed bytes to a FlatBuffer and returns their position.
+*/
+static inline size_t fb_append_impl_(fb_builder_impl_ *fb, size_t count) {
+    if (fb->size + count > fb->capacity) {
+        size_t capacity = fb->capacity > 0 ? 2*fb->capacity : 256;
+        while (capacity < fb->size + count) capacity *= 2;
+        unsigned char *bytes = (unsigned char *)realloc(fb->bytes, capacity);
+        if (bytes == NULL) {
+            fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                            " fb_append_impl_() ->"
+                            " Error in allocating %lu bytes."
+                            " Exiting.", (unsigned long)capacity);
+            exit(EXIT_FAILURE);
+        }
+        fb->bytes = bytes;
+        fb->capacity = capacity;
+    }
+    size_t position = fb->size;
+    memset(fb->bytes + position, 0, count);
+    fb->size += count;
+    return position;
+}
+
+/*
+    Appends zeroed bytes until the size of a FlatBuffer is a multiple of
+    alignment, a power of 2.
+*/
+static inline void fb_align_impl_(fb_builder_impl_ *fb, size_t alignment) {
+    fb_append_impl_(fb, (alignment - fb->size % alignment) % alignment);
+}
+
+/*
+    Stores an unsigned little-endian integer of count bytes at a position
+    of a FlatBuffer.
+*/
+static inline void fb_set_impl_(fb_builder_impl_ *fb, size_t position,
+    unsigned long long value, int count) {
+
+    for (int k = 0; k < count; k++) {
+        fb->bytes[position + k] = (unsigned char)(value & 0xFF);
+        value >>= 8;
+    }
+}
+
+/*
+    Stores at a position of a FlatBuffer the offset to an object written
+    after it.
+*/
+static inline void fb_patch_impl_(fb_builder_impl_ *fb, size_t position,
+    size_t target) {
+
+    fb_set_impl_(fb, position, target - position, 4);
+}
+
+/*
+    Appends a table, preceded by its vtable, and returns its position.
+
+    Parameters:
+    - fb, the FlatBuffer.
+    - fields, array of count fields.
+    - count, number of fields.
+    - positions, array of count positions to output where each field is
+    stored, for patching the offsets.
+*/
+static inline size_t fb_add_table_impl_(fb_builder_impl_ *fb,
+    const fb_field_impl_ *fields, int count, size_t *positions) {
+
+    int slots = 0;
+    for (int k = 0; k < count; k++) {
+        if (fields[k].slot + 1 > slots) slots = fields[k].slot + 1;
+    }
+
+    /* Lay out the fields after the offset to the vtable */
+    fb_align_impl_(fb, 2);
+    size_t vtable = fb->size;
+    size_t vtable_size = 4 + 2*(size_t)slots;
+    size_t table = (vtable + vtable_size + 7) & ~(size_t)7;
+    size_t cursor = table + 4;
+    for (int k = 0; k < count; k++) {
+        size_t size = (size_t)fields[k].size;
+        cursor = (cursor + size - 1) & ~(size - 1);
+        positions[k] = cursor;
+        cursor += size;
+    }
+    fb_append_impl_(fb, cursor - vtable);
+
+    fb_set_impl_(fb, vtable, vtable_size, 2);
+    fb_set_impl_(fb, vtable + 2, cursor - table, 2);
+    for (int k = 0; k < count; k++) {
+        fb_set_impl_(fb, vtable + 4 + 2*(size_t)fields[k].slot,
+            positions[k] - table, 2);
+        fb_set_impl_(fb, positions[k], fields[k].value, fields[k].size);
+    }
+    fb_set_impl_(fb, table, table - vtable, 4);
+    return table;
+}
+
+/*
+    Appends a vector of count zeroed elements of size bytes, aligned to
+    alignment, and returns the position of its length. The elements start
+    4 bytes after it.
+*/
+static inline size_t fb_add_vector_impl_(fb_builder_impl_ *fb, size_t count,
+    size_t size, size_t alignment) {
+
+    fb_align_impl_(fb, 4);
+    if ((fb->size + 4) % alignment != 0) fb_append_impl_(fb, 4);
+    size_t vector = fb_append_impl_(fb, 4 + count*size);
+    fb_set_impl_(fb, vector, count, 4);
+    return vector;
+}
+
+/*
+    Appends a null-terminated string and returns the position of its
+    length.
+*/
+static inline size_t fb_add_string_impl_(fb_builder_impl_ *fb,
+    const char *str) {
+
+    size_t length = strlen(str);
+    size_t vector = fb_add_vector_impl_(fb, length + 1, 1, 4);
+    fb_set_impl_(fb, vector, length, 4);
+    memcpy(fb->bytes + vector + 4, str, length);
+    return vector;
+}
+
+/*
+    Appends the Schema table of a file of double-type columns named
+    column_1, column_2, ... and returns its position.
+
+    Parameters:
+    - fb, the FlatBuffer.
+    - columns, number of columns.
+*/
+static inline size_t arrowdat_add_schema_impl_(fb_builder_impl_ *fb,
+    size_t columns) {
+
+    fb_field_impl_ schema_fields[1] = {{1, 4, 0}};
+    size_t schema_at[1];
+    size_t schema = fb_add_table_impl_(fb, schema_fields, 1, schema_at);
+    size_t vector = fb_add_vector_impl_(fb, columns, 4, 4);
+    fb_patch_impl_(fb, schema_at[0], vector);
+
+    for (size_t j = 0; j < columns; j++) {
+        /* Field: name, type (FloatingPoint) and children (none) */
+        fb_field_impl_ fields[4] = {{0, 4, 0}, {3, 4, 0}, {5, 4, 0},
+            {2, 1, 3}};
+        size_t at[4];
+        size_t field = fb_add_table_impl_(fb, fields, 4, at);
+        fb_patch_impl_(fb, vector + 4 + 4*j, field);
+
+        char name[32];
+        snprintf(name, sizeof(name), "column_%lu", (unsigned long)(j + 1));
+        fb_patch_impl_(fb, at[0], fb_add_string_impl_(fb, name));
+
+        /* FloatingPoint with the precision DOUBLE */
+        fb_field_impl_ type_fields[1] = {{0, 2, 2}};
+        size_t type_at[1];
+        fb_patch_impl_(fb, at[1], fb_add_table_impl_(fb, type_fields, 1,
+            type_at));
+        fb_patch_impl_(fb, at[2], fb_add_vector_impl_(fb, 0, 4, 4));
+    }
+    return schema;
+}
+
+/*
+    Starts a FlatBuffer with a Message table as its root, and returns the
+    position of the offset to its header, to be patched.
+
+    Parameters:
+    - fb, the FlatBuffer, empty.
+    - header_type, type of the header, 1 for Schema or 3 for RecordBatch.
+    - body_length, size in bytes of the body after the message.
+*/
+static inline size_t arrowdat_add_message_impl_(fb_builder_impl_ *fb,
+    int header_type, unsigned long long body_length) {
+
+    fb_append_impl_(fb, 4);
+    fb_field_impl_ fields[4] = {{3, 8, body_length}, {2, 4, 0},
+        {0, 2, DFL_ARROW_VERSION_IMPL_}, {1, 1, 0}};
+    fields[3].value = (unsigned long long)header_type;
+    size_t at[4];
+    fb_patch_impl_(fb, 0, fb_add_table_impl_(fb, fields, 4, at));
+    return at[1];
+}
+
+/*
+    Writes an encapsulated message, i.e., the continuation marker, the size
+    of the metadata and the metadata padded to 8 bytes, and returns the
+    number of bytes written.
+
+    Parameters:
+    - file, the file.
+    - fb, the FlatBuffer of the Message.
+*/
+static inline size_t arrowdat_write_message_impl_(FILE *file,
+    const fb_builder_impl_ *fb) {
+
+    size_t padded = (fb->size + 7) & ~(size_t)7;
+    arrow_write_le_impl_(file, 0xFFFFFFFFu, 4);
+    arrow_write_le_impl_(file, padded, 4);
+    fwrite(fb->bytes, 1, fb->size, file);
+    for (size_t k = fb->size; k < padded; k++) putc(0, file);
+    return 8 + padded;
+}
+
+/*
+    Implementation for exporting double-type data, following the row-major
+    order, to an Arrow IPC file of one record batch with one double-type
+    column per column of the data.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns.
+    - rows, number of rows.
+    - columns, number of columns.
+*/
+static inline void arrowdat_export_impl_(const char *file_path,
+    const double *data, size_t rows, size_t columns) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "wb");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " arrowdat_export_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    /* Each column is padded to DFL_ARROW_ALIGNMENT_IMPL_ in the body */
+    size_t column_length = rows * sizeof(double);
+    size_t padded = (column_length + DFL_ARROW_ALIGNMENT_IMPL_ - 1) &
+        ~(size_t)(DFL_ARROW_ALIGNMENT_IMPL_ - 1);
+    size_t body_length = columns * padded;
+
+    fwrite(DFL_ARROW_MAGIC_IMPL_ "\0\0", 1, 8, file);
+    size_t position = 8;
+
+    /* Schema message */
+    fb_builder_impl_ fb = {NULL, 0, 0};
+    size_t header_at = arrowdat_add_message_impl_(&fb, 1, 0);
+    fb_patch_impl_(&fb, header_at, arrowdat_add_schema_impl_(&fb, columns));
+    position += arrowdat_write_message_impl_(file, &fb);
+
+    /* Record batch message, with a node and two buffers per column */
+    fb.size = 0;
+    header_at = arrowdat_add_message_impl_(&fb, 3, body_length);
+    fb_field_impl_ fields[3] = {{0, 8, rows}, {1, 4, 0}, {2, 4, 0}};
+    size_t at[3];
+    fb_patch_impl_(&fb, header_at, fb_add_table_impl_(&fb, fields, 3, at));
+    size_t nodes = fb_add_vector_impl_(&fb, columns, 16, 8);
+    fb_patch_impl_(&fb, at[1], nodes);
+    for (size_t j = 0; j < columns; j++) {
+        fb_set_impl_(&fb, nodes + 4 + 16*j, rows, 8);
+    }
+    size_t buffers = fb_add_vector_impl_(&fb, 2*columns, 16, 8);
+    fb_patch_impl_(&fb, at[2], buffers);
+    for (size_t j = 0; j < columns; j++) {
+        fb_set_impl_(&fb, buffers + 4 + 32*j, j*padded, 8);
+        fb_set_impl_(&fb, buffers + 20 + 32*j, j*padded, 8);
+        fb_set_impl_(&fb, buffers + 28 + 32*j, column_length, 8);
+    }
+    size_t block_offset = position;
+    size_t metadata_length = arrowdat_write_message_impl_(file, &fb);
+    position += metadata_length;
+
+    /* Body, gathering each column of the row-major data */
+    double chunk[4096];
+    for (size_t j = 0; j < columns; j++) {
+        for (size_t i = 0; i < rows; i += 4096) {
+            size_t count = rows - i < 4096 ? rows - i : 4096;
+            for (size_t k = 0; k < count; k++) {
+                chunk[k] = data[(i + k)*columns + j];
+            }
+            fwrite(chunk, sizeof(double), count, file);
+        }
+        for (size_t k = column_length; k < padded; k++) putc(0, file);
+    }
+    position += body_length;
+
+    /* End-of-stream marker */
+    arrow_write_le_impl_(file, 0xFFFFFFFFu, 4);
+    arrow_write_le_impl_(file, 0, 4);
+
+    /* Footer, with the schema and the block of the record batch */
+    fb.size = 0;
+    fb_append_impl_(&fb, 4);
+    fb_field_impl_ footer_fields[4] = {{1, 4, 0}, {2, 4, 0}, {3, 4, 0},
+        {0, 2, DFL_ARROW_VERSION_IMPL_}};
+    size_t footer_at[4];
+    fb_patch_impl_(&fb, 0, fb_add_table_impl_(&fb, footer_fields, 4,
+        footer_at));
+    fb_patch_impl_(&fb, footer_at[0], arrowdat_add_schema_impl_(&fb,
+        columns));
+    fb_patch_impl_(&fb, footer_at[1], fb_add_vector_impl_(&fb, 0, 24, 8));
+    size_t blocks = fb_add_vector_impl_(&fb, 1, 24, 8);
+    fb_patch_impl_(&fb, footer_at[2], blocks);
+    fb_set_impl_(&fb, blocks + 4, block_offset, 8);
+    fb_set_impl_(&fb, blocks + 12, metadata_length, 4);
+    fb_set_impl_(&fb, blocks + 20, body_length, 8);
+    fwrite(fb.bytes, 1, fb.size, file);
+    arrow_write_le_impl_(file, fb.size, 4);
+    fwrite(DFL_ARROW_MAGIC_IMPL_, 1, 6, file);
+    free(fb.bytes);
+
+    /* Close file */
+    fclose(file);
+}
+
+/*
+    Column of an Arrow IPC file: its name, not null-terminated, its format
+    string in the C Data Interface, the size in bytes of its values, and
+    whether it may have nulls.
+*/
+typedef struct {
+    const char *name;
+    size_t name_length;
+    const char *format;
+    size_t width;
+    int nullable;
+} arrowdat_field_impl_;
+
+/*
+    Buffers of a column in a record batch, pointing into the file.
+*/
+typedef struct {
+    const unsigned char *validity;
+    const unsigned char *values;
+    long long null_count;
+} arrowdat_chunk_impl_;
+
+/*
+    Arrow IPC file opened for reading: its mapping, its columns, and the
+    length and the buffers of each record batch.
+*/
+typedef struct {
+    arrow_owner_impl_ *owner;
+    size_t columns;
+    size_t batches;
+    size_t rows;
+    arrowdat_field_impl_ *fields;
+    size_t *lengths;
+    arrowdat_chunk_impl_ *chunks;
+} arrowdat_file_impl_;
+
+/*
+    Returns the format string and the width of a column of type Int (2) or
+    FloatingPoint (3), or NULL if the type is not supported.
+
+    Parameters:
+    - fb, the FlatBuffer of the footer.
+    - type_type, type of the column.
+    - type, position of the table of the type.
+    - width, to output the size in bytes of the values.
+*/
+static inline const char *arrowdat_type_impl_(const fb_reader_impl_ *fb,
+    int type_type, size_t type, size_t *width) {
+
+    if (type_type == 2) {
+        static const char *const signed_formats[4] = {"c", "s", "i", "l"};
+        static const char *const unsigned_formats[4] = {"C", "S", "I", "L"};
+        int bits = (int)fb_get_scalar_impl_(fb, type, 0, 4, 0);
+        int is_signed = (int)fb_get_scalar_impl_(fb, type, 1, 1, 0);
+        for (int k = 0; k < 4; k++) {
+            if (bits == 8 << k) {
+                *width = (size_t)1 << k;
+                return is_signed ? signed_formats[k] : unsigned_formats[k];
+            }
+        }
+    } else if (type_type == 3 && type != 0) {
+        int precision = (int)fb_get_scalar_impl_(fb, type, 0, 2, 0);
+        if (precision == 1) {
+            *width = 4;
+            return "f";
+        }
+        if (precision == 2) {
+            *width = 8;
+            return "g";
+        }
+    }
+    return NULL;
+}
+
+/*
+    Parses the footer and the record batch messages of a mapped Arrow IPC
+    file. Returns 0 on success or EINVAL if the file is not a valid or
+    supported Arrow IPC file.
+*/
+static inline int arrowdat_parse_impl_(arrowdat_file_impl_ *file) {
+    const unsigned char *bytes = file->owner->bytes;
+    size_t size = file->owner->size;
+    if (size < 18 || memcmp(bytes, DFL_ARROW_MAGIC_IMPL_, 6) != 0 ||
+        memcmp(bytes + size - 6, DFL_ARROW_MAGIC_IMPL_, 6) != 0) {
+        return EINVAL;
+    }
+
+    /* Footer */
+    size_t footer_length = (size_t)arrow_read_le_impl_(bytes + size - 10, 4);
+    if (footer_length > size - 18) return EINVAL;
+    size_t footer_start = size - 10 - footer_length;
+    fb_reader_impl_ footer = {bytes + footer_start, footer_length};
+    size_t root = fb_get_root_impl_(&footer);
+    size_t schema = fb_get_offset_impl_(&footer, root, 1);
+    if (schema == 0 || fb_get_scalar_impl_(&footer, schema, 0, 2, 0) != 0) {
+        /* Missing schema, or big-endian */
+        return EINVAL;
+    }
+
+    /* Columns */
+    size_t fields = fb_get_vector_impl_(&footer, schema, 1, 4,
+        &file->columns);
+    if (file->columns == 0) return EINVAL;
+    file->fields = (arrowdat_field_impl_ *)dfl_allocate_impl_(NULL,
+        file->columns * sizeof(arrowdat_field_impl_));
+    for (size_t j = 0; j < file->columns; j++) {
+        arrowdat_field_impl_ *field = &file->fields[j];
+        size_t table = fb_follow_impl_(&footer, fields + 4*j);
+        if (table == 0 || fb_get_field_impl_(&footer, table, 4, 4) != 0) {
+            /* Missing field, or dictionary-encoded */
+            return EINVAL;
+        }
+        field->name = fb_get_string_impl_(&footer, table, 0,
+            &field->name_length);
+        field->nullable = (int)fb_get_scalar_impl_(&footer, table, 1, 1, 0);
+        field->format = arrowdat_type_impl_(&footer,
+            (int)fb_get_scalar_impl_(&footer, table, 2, 1, 0),
+            fb_get_offset_impl_(&footer, table, 3), &field->width);
+        if (field->format == NULL) return EINVAL;
+    }
+
+    /* Record batches */
+    size_t blocks = fb_get_vector_impl_(&footer, root, 3, 24,
+        &file->batches);
+    file->lengths = (size_t *)dfl_allocate_impl_(NULL,
+        file->batches * sizeof(size_t));
+    file->chunks = (arrowdat_chunk_impl_ *)dfl_allocate_impl_(NULL,
+        file->batches * file->columns * sizeof(arrowdat_chunk_impl_));
+    for (size_t b = 0; b < file->batches; b++) {
+        const unsigned char *block = footer.bytes + blocks + 24*b;
+        unsigned long long offset = arrow_read_le_impl_(block, 8);
+        unsigned long long metadata_length = arrow_read_le_impl_(block + 8,
+            4);
+        unsigned long long body_length = arrow_read_le_impl_(block + 16, 8);
+        if (offset < 8 || offset > footer_start ||
+            metadata_length > footer_start - offset ||
+            body_length > footer_start - offset - metadata_length) {
+            return EINVAL;
+        }
+
+        /* Message, with or without the continuation marker */
+        size_t start = (size_t)offset + 4;
+        size_t length = (size_t)arrow_read_le_impl_(bytes + offset, 4);
+        if (length == 0xFFFFFFFFu) {
+            start += 4;
+            length = (size_t)arrow_read_le_impl_(bytes + offset + 4, 4);
+        }
+        if (start + length > offset + metadata_length) return EINVAL;
+        fb_reader_impl_ message = {bytes + start, length};
+        size_t message_root = fb_get_root_impl_(&message);
+        size_t header = fb_get_offset_impl_(&message, message_root, 2);
+        if (fb_get_scalar_impl_(&message, message_root, 1, 1, 0) != 3 ||
+            header == 0 || fb_get_field_impl_(&message, header, 3, 4) != 0) {
+            /* Not a record batch, or compressed */
+            return EINVAL;
+        }
+        unsigned long long rows = fb_get_scalar_impl_(&message, header, 0, 8,
+            0);
+        size_t node_count, buffer_count;
+        size_t nodes = fb_get_vector_impl_(&message, header, 1, 16,
+            &node_count);
+        size_t buffers = fb_get_vector_impl_(&message, header, 2, 16,
+            &buffer_count);
+        if (node_count < file->columns || buffer_count < 2*file->columns) {
+            return EINVAL;
+        }
+        file->lengths[b] = (size_t)rows;
+        file->rows += (size_t)rows;
+
+        /* Buffers of each column, checked against the body */
+        const unsigned char *body = bytes + offset + metadata_length;
+        for (size_t j = 0; j < file->columns; j++) {
+            arrowdat_chunk_impl_ *chunk = &file->chunks[b*file->columns + j];
+            const unsigned char *node = message.bytes + nodes + 16*j;
+            const unsigned char *buffer = message.bytes + buffers + 32*j;
+            unsigned long long validity_offset = arrow_read_le_impl_(buffer,
+                8);
+            unsigned long long validity_length = arrow_read_le_impl_(
+                buffer + 8, 8);
+            unsigned long long values_offset = arrow_read_le_impl_(
+                buffer + 16, 8);
+            unsigned long long values_length = arrow_read_le_impl_(
+                buffer + 24, 8);
+            chunk->null_count = (long long)arrow_read_le_impl_(node + 8, 8);
+            if (arrow_read_le_impl_(node, 8) != rows ||
+                values_offset > body_length ||
+                values_length > body_length - values_offset ||
+                rows > values_length / file->fields[j].width) {
+                return EINVAL;
+            }
+            chunk->values = body + values_offset;
+            chunk->validity = NULL;
+            if (chunk->null_count > 0) {
+                if (validity_offset > body_length ||
+                    validity_length > body_length - validity_offset ||
+                    validity_length < (rows + 7) / 8) {
+                    return EINVAL;
+                }
+                chunk->validity = body + validity_offset;
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+    Releases an Arrow IPC file opened by arrowdat_open_impl_().
+*/
+static inline void arrowdat_close_impl_(arrowdat_file_impl_ *file) {
+    if (file->owner != NULL) arrow_owner_release_impl_(file->owner);
+    free(file->fields);
+    free(file->lengths);
+    free(file->chunks);
+    memset(file, 0, sizeof(arrowdat_file_impl_));
+}
+
+/*
+    Maps and parses an Arrow IPC file. Returns 0 on success, the errno of
+    the failure to open the file, or EINVAL if it is not a valid or
+    supported Arrow IPC file, in which case it is already closed.
+
+    Parameters:
+    - file_path, path to the file.
+    - file, to output the opened file.
+*/
+static inline int arrowdat_open_impl_(const char *file_path,
+    arrowdat_file_impl_ *file) {
+
+    memset(file, 0, sizeof(arrowdat_file_impl_));
+    int status;
+    file->owner = arrow_map_impl_(file_path, &status);
+    if (file->owner == NULL) return status;
+    status = arrowdat_parse_impl_(file);
+    if (status != 0) arrowdat_close_impl_(file);
+    return status;
+}
+
+/*
+    Opens an Arrow IPC file, exiting with a warning on failure, as the
+    imports of the other formats do.
+
+    Parameters:
+    - file_path, path to the file.
+    - file, to output the opened file.
+    - caller, name of the calling function, for the warning.
+*/
+static inline void arrowdat_open_or_exit_impl_(const char *file_path,
+    arrowdat_file_impl_ *file, const char *caller) {
+
+    int status = arrowdat_open_impl_(file_path, file);
+    if (status != 0) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " %s() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", caller, status == EINVAL ?
+                        "Not a supported Arrow IPC file" : strerror(status));
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*
+    Converts count values of a column to double, storing the k-th at
+    data[k*stride].
+
+    Parameters:
+    - values, the values, possibly unaligned.
+    - format, format string of the column.
+    - count, number of values.
+    - data, double-type array to output the values.
+    - stride, distance in elements between two consecutive values.
+*/
+static inline void arrowdat_convert_impl_(const unsigned char *values,
+    const char *format, size_t count, double *data, ptrdiff_t stride) {
+
+#define DFL_ARROW_CONVERT_IMPL_(type) \
+    for (size_t k = 0; k < count; k++) { \
+        type value; \
+        memcpy(&value, values + k*sizeof(type), sizeof(type)); \
+        data[(ptrdiff_t)k*stride] = (double)value; \
+    }
+
+    switch (format[0]) {
+    case 'c': DFL_ARROW_CONVERT_IMPL_(int8_t) break;
+    case 's': DFL_ARROW_CONVERT_IMPL_(int16_t) break;
+    case 'i': DFL_ARROW_CONVERT_IMPL_(int32_t) break;
+    case 'l': DFL_ARROW_CONVERT_IMPL_(int64_t) break;
+    case 'C': DFL_ARROW_CONVERT_IMPL_(uint8_t) break;
+    case 'S': DFL_ARROW_CONVERT_IMPL_(uint16_t) break;
+    case 'I': DFL_ARROW_CONVERT_IMPL_(uint32_t) break;
+    case 'L': DFL_ARROW_CONVERT_IMPL_(uint64_t) break;
+    case 'f': DFL_ARROW_CONVERT_IMPL_(float) break;
+    default: DFL_ARROW_CONVERT_IMPL_(double) break;
+    }
+
+#undef DFL_ARROW_CONVERT_IMPL_
+}
+
+/*
+    Implementation for getting the number of rows and columns of an Arrow
+    IPC file.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows of all record batches.
+    - &columns, to output the number of columns.
+*/
+static inline void arrowdat_get_sizes_impl_(const char *file_path,
+    int *rows, int *columns) {
+
+    arrowdat_file_impl_ file;
+    arrowdat_open_or_exit_impl_(file_path, &file,
+        "arrowdat_get_sizes_impl_");
+    *rows = size_to_int_impl_(file.rows, "arrowdat_get_sizes_impl_");
+    *columns = size_to_int_impl_(file.columns, "arrowdat_get_sizes_impl_");
+    arrowdat_close_impl_(&file);
+}
+
+/*
+    Implementation for importing the columns of an Arrow IPC file into an
+    one-dimensional double-type array following the row-major order. The
+    values of integer and float columns are converted, and the nulls are
+    stored as NAN.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns.
+*/
+static inline void arrowdat_import_impl_(const char *file_path,
+    double *data) {
+
+    arrowdat_file_impl_ file;
+    arrowdat_open_or_exit_impl_(file_path, &file, "arrowdat_import_impl_");
+    size_t columns = file.columns;
+    size_t first = 0;
+    for (size_t b = 0; b < file.batches; b++) {
+        size_t rows = file.lengths[b];
+        for (size_t j = 0; j < columns; j++) {
+            const arrowdat_chunk_impl_ *chunk = &file.chunks[b*columns + j];
+            double *column = data + first*columns + j;
+            arrowdat_convert_impl_(chunk->values, file.fields[j].format,
+                rows, column, (ptrdiff_t)columns);
+            if (chunk->validity != NULL) {
+                for (size_t i = 0; i < rows; i++) {
+                    if (!((chunk->validity[i >> 3] >> (i & 7)) & 1)) {
+                        column[i*columns] = NAN;
+                    }
+                }
+            }
+        }
+        first += rows;
+    }
+    arrowdat_close_impl_(&file);
+}
+
+/*
+    Implementation for importing an Arrow IPC file into an Arrow struct
+    array through the C Data Interface, with one child per column of the
+    same type and name. When the file has a single record batch whose
+    buffers are aligned, the children point into the memory mapping of the
+    file, which is unmapped when the last of them is released. Otherwise,
+    the record batches are concatenated into new buffers. Returns 0 on
+    success, the errno of the failure to open the file, or EINVAL if it is
+    not a valid or supported Arrow IPC file.
+
+    Parameters:
+    - file_path, path to the file.
+    - schema, to output the type of the array.
+    - array, to output the array.
+*/
+static inline int arrowdat_import_arrow_impl_(const char *file_path,
+    struct ArrowSchema *schema, struct ArrowArray *array) {
+
+    arrowdat_file_impl_ file;
+    int status = arrowdat_open_impl_(file_path, &file);
+    if (status != 0) return status;
+    size_t columns = file.columns;
+    size_t rows = file.rows;
+
+    /* The buffers of the file may be used only if they are aligned */
+    int zero_copy = file.batches == 1;
+    for (size_t j = 0; j < columns && zero_copy; j++) {
+        if ((uintptr_t)file.chunks[j].values % file.fields[j].width != 0) {
+            zero_copy = 0;
+        }
+    }
+
+    arrow_owner_impl_ *owner = arrow_owner_create_impl_(NULL);
+    arrow_schema_init_impl_(schema, "+s", "", 0, (int64_t)columns);
+    arrow_array_init_impl_(array, owner, (int64_t)rows, 0, 1, NULL, NULL,
+        (int64_t)columns);
+    arrow_owner_release_impl_(owner);
+
+    for (size_t j = 0; j < columns; j++) {
+        const arrowdat_field_impl_ *field = &file.fields[j];
+        char *name = (char *)dfl_allocate_impl_(NULL, field->name_length + 1);
+        memcpy(name, field->name, field->name_length);
+        name[field->name_length] = '\0';
+        arrow_schema_init_impl_(schema->children[j], field->format, name,
+            field->nullable ? ARROW_FLAG_NULLABLE : 0, 0);
+        free(name);
+
+        if (zero_copy) {
+            const arrowdat_chunk_impl_ *chunk = &file.chunks[j];
+            arrow_array_init_impl_(array->children[j], file.owner,
+                (int64_t)rows, chunk->validity != NULL ? chunk->null_count :
+                0, 2, chunk->validity, chunk->values, 0);
+            continue;
+        }
+
+        /* Concatenate the values and the validity bits of the batches */
+        size_t width = field->width;
+        size_t values_length = (rows*width + DFL_ARROW_ALIGNMENT_IMPL_ - 1) &
+            ~(size_t)(DFL_ARROW_ALIGNMENT_IMPL_ - 1);
+        size_t validity_length = (rows + 7) / 8;
+        void *memory;
+        unsigned char *values = (unsigned char *)arrow_aligned_allocate_impl_(
+            values_length + validity_length, &memory);
+        unsigned char *validity = values + values_length;
+        memset(validity, 0, validity_length);
+        long long null_count = 0;
+        size_t first = 0;
+        for (size_t b = 0; b < file.batches; b++) {
+            const arrowdat_chunk_impl_ *chunk = &file.chunks[b*columns + j];
+            size_t length = file.lengths[b];
+            memcpy(values + first*width, chunk->values, length*width);
+            for (size_t i = 0; i < length; i++) {
+                int valid = chunk->validity == NULL ||
+                    ((chunk->validity[i >> 3] >> (i & 7)) & 1);
+                if (valid) {
+                    validity[(first + i) >> 3] |=
+                        (unsigned char)(1 << ((first + i) & 7));
+                } else {
+                    null_count++;
+                }
+            }
+            first += length;
+        }
+        owner = arrow_owner_create_impl_(memory);
+        arrow_array_init_impl_(array->children[j], owner, (int64_t)rows,
+            null_count, 2, null_count > 0 ? validity : NULL, values, 0);
+        arrow_owner_release_impl_(owner);
+    }
+    arrowdat_close_impl_(&file);
+    return 0;
+}
+
+#endif /* DATA_FILE_LIBRARY_ARROWDAT_IMPL_H */
@@ -0,0 +1,503 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/async_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of an executor, i.e., a pool of threads with a queue
+        of tasks, that runs imports and exports asynchronously. Each task is
+        a handle that may be polled, waited on or cancelled, and may have a
+        completion callback.
+*/
+
+#ifndef DATA_FILE_LIBRARY_ASYNC_IMPL_H
+#define DATA_FILE_LIBRARY_ASYNC_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h> /* For strlen() and memcpy() */
+#include <errno.h> /* For errno, EIO and ECANCELED */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "thread_impl_.h"
+#include "sepdat_impl_.h"
+#include "wldat_impl_.h"
+
+/* States of a task */
+#define DFL_TASK_PENDING 0
+#define DFL_TASK_RUNNING 1
+#define DFL_TASK_DONE 2
+#define DFL_TASK_CANCELLED 3
+
+/* Operations of a task */
+#define ASYNC_SEP_IMPORT_IMPL_ 0
+#define ASYNC_SEP_IMPORT_CPLX_IMPL_ 1
+#define ASYNC_SEP_EXPORT_IMPL_ 2
+#define ASYNC_SEP_EXPORT_CPLX_IMPL_ 3
+#define ASYNC_WL_IMPORT_IMPL_ 4
+#define ASYNC_WL_IMPORT_CPLX_IMPL_ 5
+#define ASYNC_WL_EXPORT_IMPL_ 6
+#define ASYNC_WL_EXPORT_CPLX_IMPL_ 7
+
+struct dfl_task;
+struct dfl_executor;
+
+/*
+    Completion callback of a task, called once with the state
+    DFL_TASK_DONE, from a thread of the executor, or DFL_TASK_CANCELLED,
+    from the thread that cancelled the task. The state and status of the
+    task are already final, but dfl_task_wait() and dfl_task_release() only
+    return once the callback has returned, so that it must not call them on
+    its own task.
+*/
+typedef void (*dfl_task_callback)(struct dfl_task *task, int state,
+    void *user_data);
+
+/*
+    Asynchronous import or export. The file path, sizes and comment are
+    copied, but the data must remain valid until the task finishes. The
+    status is 0, the errno of the failure, or ECANCELED, and finishing is
+    set while the callback of a finished task runs.
+*/
+typedef struct dfl_task {
+    struct dfl_task *next;
+    struct dfl_executor *executor;
+    int state;
+    int status;
+    int finishing;
+    int operation;
+    char sep;
+    char *file_path;
+    void *data;
+    const void *const_data;
+    int rows;
+    int columns;
+    int dimensions;
+    int size[128];
+    char *comment;
+    dfl_task_callback callback;
+    void *user_data;
+} dfl_task;
+
+/*
+    Pool of threads running the queued tasks in first-in first-out order.
+    It is freed once it was destroyed and all its tasks were released, so
+    that tasks may still be queried after their executor is destroyed.
+*/
+typedef struct dfl_executor {
+    tpmutex_impl_ mutex;
+    tpcond_impl_ cond;
+    dfl_task *head;
+    dfl_task *tail;
+    int stop;
+    int references;
+    int threads;
+    tpthread_impl_ *pool;
+} dfl_executor;
+
+/*
+    Returns a copy of a string allocated with malloc(), or NULL for NULL.
+*/
+static inline char *string_copy_impl_(const char *str) {
+    if (str == NULL) return NULL;
+    size_t len = strlen(str);
+    char *copy = (char *)dfl_allocate_impl_(NULL, len + 1);
+    memcpy(copy, str, len + 1);
+    return copy;
+}
+
+/*
+    Closes a written file, returning 0, or the errno of the failure to write
+    it.
+*/
+static inline int async_fclose_impl_(FILE *file) {
+    int failed = ferror(file);
+    if (fclose(file) != 0 || failed) return errno != 0 ? errno : EIO;
+    return 0;
+}
+
+/*
+    Runs the operation of a task through the functions that do not exit on
+    failure. Returns 0, or the errno of the failure to open or write the
+    file, or EINVAL if the dimensions of a WL file exceed 128.
+*/
+static inline int async_run_impl_(dfl_task *task) {
+    size_t size64[128];
+    ptrdiff_t stride[128];
+    int status = 0, dimensions = 0;
+    FILE *file;
+
+    switch (task->operation) {
+    case ASYNC_SEP_IMPORT_IMPL_:
+    case ASYNC_SEP_IMPORT_CPLX_IMPL_:
+        status = sepdat_get_sizes_status_impl_(task->file_path, &size64[0],
+            &size64[1], task->sep);
+        if (status != 0) break;
+        status = sepdat_read_status_impl_(task->file_path,
+            task->operation == ASYNC_SEP_IMPORT_IMPL_ ?
+            (double *)task->data : NULL, (tpdfcplx_impl_ *)task->data,
+            size64[0], size64[1], (ptrdiff_t)size64[1], 1, task->sep);
+        break;
+    case ASYNC_WL_IMPORT_IMPL_:
+    case ASYNC_WL_IMPORT_CPLX_IMPL_:
+        status = wldat_get_sizes_status_impl_(task->file_path, &dimensions,
+            size64);
+        if (status != 0) break;
+        row_major_strides_impl_(size64, dimensions, stride);
+        status = wldat_read_status_impl_(task->file_path,
+            task->operation == ASYNC_WL_IMPORT_IMPL_ ?
+            (double *)task->data : NULL, (tpdfcplx_impl_ *)task->data,
+            dimensions, stride);
+        break;
+    case ASYNC_SEP_EXPORT_IMPL_:
+    case ASYNC_SEP_EXPORT_CPLX_IMPL_:
+        errno = 0;
+        file = fopen(task->file_path, "w");
+        if (!file) {
+            status = errno != 0 ? errno : EIO;
+            break;
+        }
+        if (task->operation == ASYNC_SEP_EXPORT_IMPL_) {
+            sepdat_write_strided_impl_(file,
+                (const double *)task->const_data, (size_t)task->rows,
+                (size_t)task->columns, (ptrdiff_t)task->columns, 1,
+                task->sep);
+        } else {
+            sepdat_write_cplx_strided_impl_(file,
+                (const tpdfcplx_impl_ *)task->const_data, (size_t)task->rows,
+                (size_t)task->columns, (ptrdiff_t)task->columns, 1,
+                task->sep);
+        }
+        status = async_fclose_impl_(file);
+        break;
+    case ASYNC_WL_EXPORT_IMPL_:
+    case ASYNC_WL_EXPORT_CPLX_IMPL_:
+        if (task->dimensions > 128) {
+            status = EINVAL;
+            break;
+        }
+        errno = 0;
+        file = fopen(task->file_path, "w");
+        if (!file) {
+            status = errno != 0 ? errno : EIO;
+            break;
+        }
+        widen_sizes_impl_(task->size, task->dimensions, size64);
+        row_major_strides_impl_(size64, task->dimensions, stride);
+        if (task->operation == ASYNC_WL_EXPORT_IMPL_) {
+            wldat_write_strided64_impl_(file,
+                (const double *)task->const_data, task->dimensions, size64,
+                stride, task->comment, NULL);
+        } else {
+            wldat_write_cplx_strided64_impl_(file,
+                (const tpdfcplx_impl_ *)task->const_data, task->dimensions,
+                size64, stride, task->comment, NULL);
+        }
+        status = async_fclose_impl_(file);
+        break;
+    default:
+        break;
+    }
+    return status;
+}
+
+/*
+    Runs the callback of a task whose final state is already set, with
+    finishing set, and then wakes up the threads waiting for the task.
+*/
+static inline void async_finish_impl_(dfl_task *task, int state) {
+    dfl_executor *executor = task->executor;
+    if (task->callback != NULL) {
+        task->callback(task, state, task->user_data);
+    }
+    mutex_lock_impl_(&executor->mutex);
+    task->finishing = 0;
+    cond_broadcast_impl_(&executor->cond);
+    mutex_unlock_impl_(&executor->mutex);
+}
+
+/*
+    Thread of an executor.
+
+    Parameter:
+    - context, the dfl_executor.
+*/
+static inline void *async_worker_impl_(void *context) {
+    dfl_executor *executor = (dfl_executor *)context;
+    for (;;) {
+        mutex_lock_impl_(&executor->mutex);
+        while (executor->head == NULL && !executor->stop) {
+            cond_wait_impl_(&executor->cond, &executor->mutex);
+        }
+        dfl_task *task = executor->head;
+        if (task == NULL) {
+            /* Stopping and the queue is empty */
+            mutex_unlock_impl_(&executor->mutex);
+            break;
+        }
+        executor->head = task->next;
+        if (executor->head == NULL) executor->tail = NULL;
+        task->next = NULL;
+        task->state = DFL_TASK_RUNNING;
+        mutex_unlock_impl_(&executor->mutex);
+
+        int status = async_run_impl_(task);
+
+        mutex_lock_impl_(&executor->mutex);
+        task->status = status;
+        task->state = DFL_TASK_DONE;
+        task->finishing = 1;
+        mutex_unlock_impl_(&executor->mutex);
+        async_finish_impl_(task, DFL_TASK_DONE);
+    }
+    return NULL;
+}
+
+/*
+    Implementation for creating an executor.
+
+    Parameter:
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+static inline dfl_executor *dfl_executor_create_impl_(int threads) {
+    if (threads <= 0) threads = hardware_threads_impl_();
+    dfl_executor *executor =
+        (dfl_executor *)dfl_allocate_impl_(NULL, sizeof(dfl_executor));
+    mutex_init_impl_(&executor->mutex);
+    cond_init_impl_(&executor->cond);
+    executor->head = NULL;
+    executor->tail = NULL;
+    executor->stop = 0;
+    executor->references = 1;
+    executor->threads = threads;
+    executor->pool = (tpthread_impl_ *)dfl_allocate_impl_(NULL,
+        (size_t)threads * sizeof(tpthread_impl_));
+    for (int t = 0; t < threads; t++) {
+        thread_create_impl_(&executor->pool[t], async_worker_impl_,
+            executor);
+    }
+    return executor;
+}
+
+/*
+    Drops a reference to an executor, freeing it with the last one.
+*/
+static inline void async_executor_unref_impl_(dfl_executor *executor) {
+    mutex_lock_impl_(&executor->mutex);
+    int references = --executor->references;
+    mutex_unlock_impl_(&executor->mutex);
+    if (references == 0) {
+        free(executor->pool);
+        cond_destroy_impl_(&executor->cond);
+        mutex_destroy_impl_(&executor->mutex);
+        free(executor);
+    }
+}
+
+/*
+    Implementation for destroying an executor, after all its queued and
+    running tasks finish.
+
+    Parameter:
+    - executor, the executor.
+*/
+static inline void dfl_executor_destroy_impl_(dfl_executor *executor) {
+    mutex_lock_impl_(&executor->mutex);
+    executor->stop = 1;
+    cond_broadcast_impl_(&executor->cond);
+    mutex_unlock_impl_(&executor->mutex);
+    for (int t = 0; t < executor->threads; t++) {
+        thread_join_impl_(executor->pool[t]);
+    }
+    async_executor_unref_impl_(executor);
+}
+
+/*
+    Creates a task, to be filled and then submitted.
+*/
+static inline dfl_task *async_task_impl_(dfl_executor *executor,
+    int operation, const char *file_path, dfl_task_callback callback,
+    void *user_data) {
+
+    dfl_task *task = (dfl_task *)dfl_allocate_impl_(NULL, sizeof(dfl_task));
+    memset(task, 0, sizeof(dfl_task));
+    task->executor = executor;
+    task->state = DFL_TASK_PENDING;
+    task->operation = operation;
+    task->file_path = string_copy_impl_(file_path);
+    task->callback = callback;
+    task->user_data = user_data;
+    return task;
+}
+
+/*
+    Queues a task in its executor.
+*/
+static inline dfl_task *async_submit_impl_(dfl_task *task) {
+    dfl_executor *executor = task->executor;
+    mutex_lock_impl_(&executor->mutex);
+    executor->references++;
+    if (executor->tail == NULL) {
+        executor->head = task;
+    } else {
+        executor->tail->next = task;
+    }
+    executor->tail = task;
+    cond_broadcast_impl_(&executor->cond);
+    mutex_unlock_impl_(&executor->mutex);
+    return task;
+}
+
+/*
+    Implementation for the asynchronous import and export of
+    char-separated columns data files.
+*/
+static inline dfl_task *sepdat_import_async_impl_(dfl_executor *executor,
+    const char *file_path, void *data, int cplx, dfl_task_callback callback,
+    void *user_data, char sep) {
+
+    dfl_task *task = async_task_impl_(executor, cplx ?
+        ASYNC_SEP_IMPORT_CPLX_IMPL_ : ASYNC_SEP_IMPORT_IMPL_, file_path,
+        callback, user_data);
+    task->data = data;
+    task->sep = sep;
+    return async_submit_impl_(task);
+}
+
+static inline dfl_task *sepdat_export_async_impl_(dfl_executor *executor,
+    const char *file_path, const void *data, int rows, int columns,
+    int cplx, dfl_task_callback callback, void *user_data, char sep) {
+
+    dfl_task *task = async_task_impl_(executor, cplx ?
+        ASYNC_SEP_EXPORT_CPLX_IMPL_ : ASYNC_SEP_EXPORT_IMPL_, file_path,
+        callback, user_data);
+    task->const_data = data;
+    task->rows = rows;
+    task->columns = columns;
+    task->sep = sep;
+    return async_submit_impl_(task);
+}
+
+/*
+    Implementation for the asynchronous import and export of Wolfram
+    Language package source files.
+*/
+static inline dfl_task *wldat_import_async_impl_(dfl_executor *executor,
+    const char *file_path, void *data, int cplx, dfl_task_callback callback,
+    void *user_data) {
+
+    dfl_task *task = async_task_impl_(executor, cplx ?
+        ASYNC_WL_IMPORT_CPLX_IMPL_ : ASYNC_WL_IMPORT_IMPL_, file_path,
+        callback, user_data);
+    task->data = data;
+    return async_submit_impl_(task);
+}
+
+static inline dfl_task *wldat_export_async_impl_(dfl_executor *executor,
+    const char *file_path, const void *data, int dimensions,
+    const int *size, const char *comment, int cplx,
+    dfl_task_callback callback, void *user_data) {
+
+    dfl_task *task = async_task_impl_(executor, cplx ?
+        ASYNC_WL_EXPORT_CPLX_IMPL_ : ASYNC_WL_EXPORT_IMPL_, file_path,
+        callback, user_data);
+    task->const_data = data;
+    task->dimensions = dimensions;
+    for (int d = 0; d < dimensions && d < 128; d++) {
+        task->size[d] = size[d];
+    }
+    task->comment = string_copy_impl_(comment);
+    return async_submit_impl_(task);
+}
+
+/*
+    Implementation for returning the state of a task without blocking.
+*/
+static inline int dfl_task_state_impl_(dfl_task *task) {
+    mutex_lock_impl_(&task->executor->mutex);
+    int state = task->state;
+    mutex_unlock_impl_(&task->executor->mutex);
+    return state;
+}
+
+/*
+    Implementation for returning the status of a task without blocking.
+*/
+static inline int dfl_task_status_impl_(dfl_task *task) {
+    mutex_lock_impl_(&task->executor->mutex);
+    int status = task->status;
+    mutex_unlock_impl_(&task->executor->mutex);
+    return status;
+}
+
+/*
+    Implementation for waiting until a task is done or cancelled and its
+    callback has returned, returning its final state.
+*/
+static inline int dfl_task_wait_impl_(dfl_task *task) {
+    dfl_executor *executor = task->executor;
+    mutex_lock_impl_(&executor->mutex);
+    while ((task->state != DFL_TASK_DONE &&
+        task->state != DFL_TASK_CANCELLED) || task->finishing) {
+        cond_wait_impl_(&executor->cond, &executor->mutex);
+    }
+    int state = task->state;
+    mutex_unlock_impl_(&executor->mutex);
+    return state;
+}
+
+/*
+    Implementation for cancelling a task that has not started yet.
+    Returns 1 if the task was cancelled, or 0 if it is already running or
+    finished.
+*/
+static inline int dfl_task_cancel_impl_(dfl_task *task) {
+    dfl_executor *executor = task->executor;
+    int cancelled = 0;
+    mutex_lock_impl_(&executor->mutex);
+    if (task->state == DFL_TASK_PENDING) {
+        /* Remove from the queue */
+        dfl_task *previous = NULL;
+        dfl_task *t = executor->head;
+        while (t != NULL && t != task) {
+            previous = t;
+            t = t->next;
+        }
+        if (t != NULL) {
+            if (previous == NULL) {
+                executor->head = task->next;
+            } else {
+                previous->next = task->next;
+            }
+            if (executor->tail == task) executor->tail = previous;
+            task->next = NULL;
+        }
+        task->status = ECANCELED;
+        task->state = DFL_TASK_CANCELLED;
+        task->finishing = 1;
+        cancelled = 1;
+    }
+    mutex_unlock_impl_(&executor->mutex);
+    if (cancelled) async_finish_impl_(task, DFL_TASK_CANCELLED);
+    return cancelled;
+}
+
+/*
+    Implementation for releasing a task, waiting for it and its callback
+    first if they have not finished.
+*/
+static inline void dfl_task_release_impl_(dfl_task *task) {
+    if (task == NULL) return;
+    dfl_task_wait_impl_(task);
+    dfl_executor *executor = task->executor;
+    free(task->file_path);
+    free(task->comment);
+    free(task);
+    async_executor_unref_impl_(executor);
+}
+
+#endif /* DATA_FILE_LIBRARY_ASYNC_IMPL_H */
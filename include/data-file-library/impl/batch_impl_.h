@@ -0,0 +1,315 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/batch_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the import of many data files at once by a pool of
+        threads, with read-ahead of the files about to be parsed.
+*/
+
+#ifndef DATA_FILE_LIBRARY_BATCH_IMPL_H
+#define DATA_FILE_LIBRARY_BATCH_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h> /* For memset() */
+#include <errno.h> /* For errno */
+#include <limits.h> /* For INT_MAX */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "thread_impl_.h"
+#include "sepdat_impl_.h"
+#include "wldat_impl_.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h> /* For open() and posix_fadvise() */
+#endif
+
+/*
+    Output of the import of one file of a batch.
+    - status, 0 on success, otherwise the errno of the failure to open the
+    file, EINVAL if the dimensions of a WL file exceed 128, EOVERFLOW if a
+    size exceeds INT_MAX, or ENOMEM if the allocator fails, in which case
+    the arrays are NULL.
+    - dimensions, number N of dimensions (2 for rows and columns).
+    - size, array of size N with the size of each dimension.
+    - data, the values of real-valued imports, otherwise NULL.
+    - data_cplx, the values of complex-valued imports, otherwise NULL.
+    The arrays size, data and data_cplx are allocated with the allocator of
+    the batch, and may be released with dfl_batch_free().
+*/
+typedef struct dfl_batch_item {
+    int status;
+    int dimensions;
+    int *size;
+    double *data;
+    tpdfcplx_impl_ *data_cplx;
+} dfl_batch_item;
+
+/*
+    State shared by the threads of a batch.
+*/
+typedef struct {
+    const char *const *file_paths;
+    dfl_batch_item *items;
+    int count;
+    int next;
+    int lookahead;
+    char sep;
+    int wl;
+    int cplx;
+    const dfl_allocator *allocator;
+    tpmutex_impl_ mutex;
+} batch_context_impl_;
+
+/*
+    Allocates memory of a batch with the user allocator, or with malloc(),
+    serializing the calls so that allocators that are not thread-safe
+    (e.g., arenas) may be used. Returns NULL on failure.
+
+    Parameters:
+    - batch, the batch.
+    - size, number of bytes.
+*/
+static inline void *batch_allocate_impl_(batch_context_impl_ *batch,
+    size_t size) {
+
+    mutex_lock_impl_(&batch->mutex);
+    void *ptr = batch->allocator == NULL ? malloc(size) :
+        batch->allocator->allocate(batch->allocator->context, size);
+    mutex_unlock_impl_(&batch->mutex);
+    return ptr;
+}
+
+/*
+    Asks the operating system to start reading a file into the page cache,
+    so that it is already in memory when its parse starts. Does nothing
+    where posix_fadvise() is not available.
+
+    Parameter:
+    - file_path, path to the file.
+*/
+static inline void file_prefetch_impl_(const char *file_path) {
+#if defined(POSIX_FADV_WILLNEED)
+    int fd = open(file_path, O_RDONLY);
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        close(fd);
+    }
+#else
+    (void)file_path;
+#endif
+}
+
+/*
+    Releases memory of a batch with the user allocator, serializing the
+    calls as batch_allocate_impl_().
+
+    Parameters:
+    - batch, the batch.
+    - ptr, memory to be released, may be NULL.
+*/
+static inline void batch_release_impl_(batch_context_impl_ *batch,
+    void *ptr) {
+
+    if (ptr == NULL) return;
+    mutex_lock_impl_(&batch->mutex);
+    dfl_free_impl_(batch->allocator, ptr);
+    mutex_unlock_impl_(&batch->mutex);
+}
+
+/*
+    Imports one file of a batch, reporting failures in the status of the
+    item (see dfl_batch_item) instead of exiting.
+
+    Parameters:
+    - batch, the batch.
+    - i, index of the file.
+*/
+static inline void batch_import_one_impl_(batch_context_impl_ *batch,
+    int i) {
+
+    const char *file_path = batch->file_paths[i];
+    dfl_batch_item *item = &batch->items[i];
+    size_t size64[128];
+    ptrdiff_t stride[128];
+    int status;
+
+    /* Sizes, opening the file once for them */
+    if (batch->wl) {
+        status = wldat_get_sizes_status_impl_(file_path, &item->dimensions,
+            size64);
+    } else {
+        item->dimensions = 2;
+        status = sepdat_get_sizes_status_impl_(file_path, &size64[0],
+            &size64[1], batch->sep);
+    }
+    if (status != 0) {
+        item->status = status;
+        return;
+    }
+
+    /* Row-major strides and total size, checking the int outputs */
+    size_t element_size = batch->cplx ? sizeof(tpdfcplx_impl_) :
+        sizeof(double);
+    size_t total = 1;
+    for (int d = item->dimensions - 1; d >= 0; d--) {
+        if (size64[d] > (size_t)INT_MAX || (size64[d] != 0 &&
+            total > (size_t)-1 / element_size / size64[d])) {
+            item->status = EOVERFLOW;
+            return;
+        }
+        stride[d] = (ptrdiff_t)total;
+        total *= size64[d];
+    }
+
+    /* Arrays */
+    item->size = (int *)batch_allocate_impl_(batch,
+        item->dimensions > 0 ? (size_t)item->dimensions * sizeof(int) : 1);
+    void *values = batch_allocate_impl_(batch,
+        total > 0 ? total * element_size : 1);
+    if (item->size == NULL || values == NULL) {
+        batch_release_impl_(batch, item->size);
+        batch_release_impl_(batch, values);
+        item->size = NULL;
+        item->status = ENOMEM;
+        return;
+    }
+    for (int d = 0; d < item->dimensions; d++) {
+        item->size[d] = (int)size64[d];
+    }
+    if (batch->cplx) {
+        item->data_cplx = (tpdfcplx_impl_ *)values;
+    } else {
+        item->data = (double *)values;
+    }
+
+    /* Values, the file being opened again as it may have been removed */
+    if (batch->wl) {
+        status = wldat_read_status_impl_(file_path, item->data,
+            item->data_cplx, item->dimensions, stride);
+    } else {
+        status = sepdat_read_status_impl_(file_path, item->data,
+            item->data_cplx, size64[0], size64[1], stride[0], stride[1],
+            batch->sep);
+    }
+    if (status != 0) {
+        batch_release_impl_(batch, item->size);
+        batch_release_impl_(batch, values);
+        item->size = NULL;
+        item->data = NULL;
+        item->data_cplx = NULL;
+        item->status = status;
+    }
+}
+
+/*
+    Thread of a batch. Each thread takes the next file not yet taken, so
+    that threads that finish small files early keep taking work until all
+    files are done, and asks for the read-ahead of the file that is likely
+    to be taken once the other threads finish their current files.
+
+    Parameter:
+    - context, the batch_context_impl_.
+*/
+static inline void *batch_worker_impl_(void *context) {
+    batch_context_impl_ *batch = (batch_context_impl_ *)context;
+    for (;;) {
+        mutex_lock_impl_(&batch->mutex);
+        int i = batch->next++;
+        mutex_unlock_impl_(&batch->mutex);
+        if (i >= batch->count) break;
+
+        if (i + batch->lookahead < batch->count) {
+            file_prefetch_impl_(batch->file_paths[i + batch->lookahead]);
+        }
+        batch_import_one_impl_(batch, i);
+    }
+    return NULL;
+}
+
+/*
+    Implementation for importing many data files with a pool of threads.
+
+    Parameters:
+    - file_paths, array of count paths.
+    - count, number of files.
+    - items, array of count items to output the results.
+    - threads, number of threads, where 0 selects the number of processors.
+    - allocator, allocator of the outputs, or NULL for malloc().
+    - sep, column separator, ignored for WL files.
+    - wl, whether the files are Wolfram Language package source files.
+    - cplx, whether the values are complex numbers.
+*/
+static inline void batch_import_impl_(const char *const *file_paths,
+    int count, dfl_batch_item *items, int threads,
+    const dfl_allocator *allocator, char sep, int wl, int cplx) {
+
+    if (count <= 0) return;
+    memset(items, 0, (size_t)count * sizeof(dfl_batch_item));
+
+    if (threads <= 0) threads = hardware_threads_impl_();
+    if (threads > count) threads = count;
+
+    batch_context_impl_ batch;
+    batch.file_paths = file_paths;
+    batch.items = items;
+    batch.count = count;
+    batch.next = 0;
+    batch.lookahead = threads;
+    batch.sep = sep;
+    batch.wl = wl;
+    batch.cplx = cplx;
+    batch.allocator = allocator;
+    mutex_init_impl_(&batch.mutex);
+
+    /* Read ahead the first files */
+    for (int i = 0; i < threads; i++) {
+        file_prefetch_impl_(file_paths[i]);
+    }
+
+    /* The calling thread works as one of the threads */
+    tpthread_impl_ *pool = NULL;
+    if (threads > 1) {
+        pool = (tpthread_impl_ *)dfl_allocate_impl_(NULL,
+            (size_t)(threads - 1) * sizeof(tpthread_impl_));
+        for (int t = 0; t < threads - 1; t++) {
+            thread_create_impl_(&pool[t], batch_worker_impl_, &batch);
+        }
+    }
+    batch_worker_impl_(&batch);
+    for (int t = 0; t < threads - 1; t++) {
+        thread_join_impl_(pool[t]);
+    }
+    free(pool);
+
+    mutex_destroy_impl_(&batch.mutex);
+}
+
+/*
+    Implementation for releasing the arrays of the items of a batch.
+
+    Parameters:
+    - items, array of count items.
+    - count, number of items.
+    - allocator, the allocator given to the batch import, or NULL.
+*/
+static inline void batch_free_impl_(dfl_batch_item *items, int count,
+    const dfl_allocator *allocator) {
+
+    for (int i = 0; i < count; i++) {
+        dfl_free_impl_(allocator, items[i].size);
+        dfl_free_impl_(allocator, items[i].data);
+        dfl_free_impl_(allocator, items[i].data_cplx);
+        items[i].size = NULL;
+        items[i].data = NULL;
+        items[i].data_cplx = NULL;
+    }
+}
+
+#endif /* DATA_FILE_LIBRARY_BATCH_IMPL_H */
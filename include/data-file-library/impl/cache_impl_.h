@@ -0,0 +1,405 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/cache_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of a thread-safe cache of imported files, bounded in
+        bytes and evicting the least recently used files. Its entries are
+        keyed by the path, the kind of import, and the device, inode, size
+        and modification time of the file, so that changed files are
+        imported again. Concurrent imports of the same file share a single
+        parse, and the callers get read-only views of the shared values.
+*/
+
+#ifndef DATA_FILE_LIBRARY_CACHE_IMPL_H
+#define DATA_FILE_LIBRARY_CACHE_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h> /* For strcmp() and memset() */
+#include <errno.h> /* For errno */
+#include <sys/stat.h> /* For stat() */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "thread_impl_.h"
+#include "sepdat_impl_.h"
+#include "wldat_impl_.h"
+#include "async_impl_.h" /* For string_copy_impl_() */
+
+/* Kinds of the imports of a cache */
+#define DFL_CACHE_CSV_IMPL_ 0
+#define DFL_CACHE_TSV_IMPL_ 1
+#define DFL_CACHE_WL_IMPL_ 2
+
+/*
+    Imported file of a cache, shared by its views.
+*/
+typedef struct cache_entry_impl_ {
+    struct cache_entry_impl_ *prev;
+    struct cache_entry_impl_ *next;
+    char *path;
+    int kind;
+    int cplx;
+    unsigned long long device;
+    unsigned long long inode;
+    long long size;
+    long long mtime_sec;
+    long long mtime_nsec;
+    int ready;
+    int cached;
+    int evict;
+    int references;
+    int status;
+    int dimensions;
+    int *sizes;
+    double *data;
+    tpdfcplx_impl_ *data_cplx;
+    size_t bytes;
+} cache_entry_impl_;
+
+/*
+    Cache of imported files. The entries are in a list from the most to the
+    least recently used.
+*/
+typedef struct dfl_cache {
+    tpmutex_impl_ mutex;
+    tpcond_impl_ cond;
+    cache_entry_impl_ *head;
+    cache_entry_impl_ *tail;
+    size_t bytes;
+    size_t max_bytes;
+} dfl_cache;
+
+/*
+    Read-only view of an imported file, valid until it is released with
+    dfl_cache_release().
+    - status, 0 on success or the errno of the failure to open the file.
+    - dimensions, number N of dimensions (2 for rows and columns).
+    - size, array of size N with the size of each dimension.
+    - data, the values of real-valued imports, otherwise NULL.
+    - data_cplx, the values of complex-valued imports, otherwise NULL.
+    The other fields are internal.
+*/
+typedef struct dfl_cache_view {
+    int status;
+    int dimensions;
+    const int *size;
+    const double *data;
+    const tpdfcplx_impl_ *data_cplx;
+    void *entry;
+} dfl_cache_view;
+
+/*
+    Implementation for creating a cache.
+
+    Parameter:
+    - max_bytes, largest number of bytes of the values kept by the cache.
+*/
+static inline dfl_cache *dfl_cache_create_impl_(size_t max_bytes) {
+    dfl_cache *cache =
+        (dfl_cache *)dfl_allocate_impl_(NULL, sizeof(dfl_cache));
+    mutex_init_impl_(&cache->mutex);
+    cond_init_impl_(&cache->cond);
+    cache->head = NULL;
+    cache->tail = NULL;
+    cache->bytes = 0;
+    cache->max_bytes = max_bytes;
+    return cache;
+}
+
+/*
+    Releases the memory of an entry.
+*/
+static inline void cache_entry_free_impl_(cache_entry_impl_ *entry) {
+    free(entry->path);
+    free(entry->sizes);
+    free(entry->data);
+    free(entry->data_cplx);
+    free(entry);
+}
+
+/*
+    Removes an entry from the list of a cache, and releases it if it has no
+    views. Must be called with the mutex locked, and only for ready entries,
+    whose bytes are no longer written by their loader.
+*/
+static inline void cache_unlink_impl_(dfl_cache *cache,
+    cache_entry_impl_ *entry) {
+
+    if (!entry->cached) return;
+    if (entry->prev != NULL) {
+        entry->prev->next = entry->next;
+    } else {
+        cache->head = entry->next;
+    }
+    if (entry->next != NULL) {
+        entry->next->prev = entry->prev;
+    } else {
+        cache->tail = entry->prev;
+    }
+    entry->prev = NULL;
+    entry->next = NULL;
+    entry->cached = 0;
+    cache->bytes -= entry->bytes;
+    if (entry->references == 0) cache_entry_free_impl_(entry);
+}
+
+/*
+    Moves an entry to the start of the list of a cache, i.e., makes it the
+    most recently used. Must be called with the mutex locked.
+*/
+static inline void cache_touch_impl_(dfl_cache *cache,
+    cache_entry_impl_ *entry) {
+
+    if (cache->head == entry) return;
+    entry->prev->next = entry->next;
+    if (entry->next != NULL) {
+        entry->next->prev = entry->prev;
+    } else {
+        cache->tail = entry->prev;
+    }
+    entry->prev = NULL;
+    entry->next = cache->head;
+    cache->head->prev = entry;
+    cache->head = entry;
+}
+
+/*
+    Returns the nanoseconds of the modification time of a file, or 0 where
+    the struct stat has none. The field depends on the C library and on the
+    feature macros, e.g., glibc names it st_mtimensec in strict C99 builds.
+*/
+static inline long long file_mtime_nsec_impl_(const struct stat *info) {
+#if defined(__GLIBC__) && defined(__USE_XOPEN2K8)
+    return (long long)info->st_mtim.tv_nsec;
+#elif defined(__GLIBC__)
+    return (long long)info->st_mtimensec;
+#elif defined(__linux__)
+    return (long long)info->st_mtim.tv_nsec;
+#elif defined(__APPLE__) && \
+    (!defined(_POSIX_C_SOURCE) || defined(_DARWIN_C_SOURCE))
+    return (long long)info->st_mtimespec.tv_nsec;
+#elif defined(__APPLE__)
+    return (long long)info->st_mtimensec;
+#else
+    (void)info;
+    return 0;
+#endif
+}
+
+/*
+    Parses the file of an entry, outside the mutex of the cache.
+*/
+static inline void cache_load_impl_(cache_entry_impl_ *entry) {
+
+    /* Report a missing or unreadable file instead of exiting */
+    FILE *file = fopen(entry->path, "r");
+    if (!file) {
+        entry->status = errno != 0 ? errno : EIO;
+        return;
+    }
+    fclose(file);
+
+    if (entry->kind == DFL_CACHE_WL_IMPL_) {
+        if (entry->cplx) {
+            entry->data_cplx = wldat_import_cplx_alloc_impl_(entry->path,
+                &entry->dimensions, &entry->sizes, NULL);
+        } else {
+            entry->data = wldat_import_alloc_impl_(entry->path,
+                &entry->dimensions, &entry->sizes, NULL);
+        }
+    } else {
+        char sep = entry->kind == DFL_CACHE_TSV_IMPL_ ? '\t' : ',';
+        entry->dimensions = 2;
+        entry->sizes = (int *)dfl_allocate_impl_(NULL, 2*sizeof(int));
+        if (entry->cplx) {
+            entry->data_cplx = sepdat_import_cplx_alloc_impl_(entry->path,
+                &entry->sizes[0], &entry->sizes[1], NULL, sep);
+        } else {
+            entry->data = sepdat_import_alloc_impl_(entry->path,
+                &entry->sizes[0], &entry->sizes[1], NULL, sep);
+        }
+    }
+
+    size_t count = 1;
+    for (int d = 0; d < entry->dimensions; d++) {
+        count *= (size_t)entry->sizes[d];
+    }
+    entry->bytes = count * (entry->cplx ? sizeof(tpdfcplx_impl_) :
+        sizeof(double));
+}
+
+/*
+    Implementation for importing a file through a cache. Returns the status
+    of the view.
+
+    Parameters:
+    - cache, the cache.
+    - file_path, path to the file.
+    - view, to output the view of the values.
+    - kind, DFL_CACHE_CSV_IMPL_, DFL_CACHE_TSV_IMPL_ or DFL_CACHE_WL_IMPL_.
+    - cplx, whether the values are complex numbers.
+*/
+static inline int cache_import_impl_(dfl_cache *cache, const char *file_path,
+    dfl_cache_view *view, int kind, int cplx) {
+
+    memset(view, 0, sizeof(dfl_cache_view));
+
+    /* The key includes what tells that the file changed */
+    struct stat info;
+    if (stat(file_path, &info) != 0) {
+        view->status = errno != 0 ? errno : EIO;
+        return view->status;
+    }
+    long long mtime_nsec = file_mtime_nsec_impl_(&info);
+
+    mutex_lock_impl_(&cache->mutex);
+    cache_entry_impl_ *entry = cache->head;
+    while (entry != NULL && (entry->evict || entry->kind != kind ||
+        entry->cplx != cplx || strcmp(entry->path, file_path) != 0)) {
+        entry = entry->next;
+    }
+    if (entry != NULL && (entry->device != (unsigned long long)info.st_dev ||
+        entry->inode != (unsigned long long)info.st_ino ||
+        entry->size != (long long)info.st_size ||
+        entry->mtime_sec != (long long)info.st_mtime ||
+        entry->mtime_nsec != mtime_nsec)) {
+        /* Stale, i.e., the file changed since it was imported. An entry
+           still being parsed is evicted by its loader once ready */
+        if (entry->ready) {
+            cache_unlink_impl_(cache, entry);
+        } else {
+            entry->evict = 1;
+        }
+        entry = NULL;
+    }
+
+    if (entry != NULL) {
+        /* Wait for the parse of another caller (single-flight) */
+        entry->references++;
+        cache_touch_impl_(cache, entry);
+        while (!entry->ready) {
+            cond_wait_impl_(&cache->cond, &cache->mutex);
+        }
+    } else {
+        /* Parse the file while the others wait for it */
+        entry = (cache_entry_impl_ *)dfl_allocate_impl_(NULL,
+            sizeof(cache_entry_impl_));
+        memset(entry, 0, sizeof(cache_entry_impl_));
+        entry->path = string_copy_impl_(file_path);
+        entry->kind = kind;
+        entry->cplx = cplx;
+        entry->device = (unsigned long long)info.st_dev;
+        entry->inode = (unsigned long long)info.st_ino;
+        entry->size = (long long)info.st_size;
+        entry->mtime_sec = (long long)info.st_mtime;
+        entry->mtime_nsec = mtime_nsec;
+        entry->references = 1;
+        entry->cached = 1;
+        entry->next = cache->head;
+        if (cache->head != NULL) cache->head->prev = entry;
+        cache->head = entry;
+        if (cache->tail == NULL) cache->tail = entry;
+        mutex_unlock_impl_(&cache->mutex);
+
+        cache_load_impl_(entry);
+
+        mutex_lock_impl_(&cache->mutex);
+        entry->ready = 1;
+        cond_broadcast_impl_(&cache->cond);
+        if (entry->cached) {
+            cache->bytes += entry->bytes;
+            if (entry->status != 0 || entry->bytes > cache->max_bytes ||
+                entry->evict) {
+                /* Failures, files larger than the cache and files that
+                   changed during the parse are not kept */
+                cache_unlink_impl_(cache, entry);
+            }
+        }
+
+        /* Evict the least recently used files that are not being parsed */
+        cache_entry_impl_ *victim = cache->tail;
+        while (cache->bytes > cache->max_bytes && victim != NULL) {
+            cache_entry_impl_ *prev = victim->prev;
+            if (victim->ready && victim != entry) {
+                cache_unlink_impl_(cache, victim);
+            }
+            victim = prev;
+        }
+    }
+    mutex_unlock_impl_(&cache->mutex);
+
+    view->status = entry->status;
+    view->dimensions = entry->dimensions;
+    view->size = entry->sizes;
+    view->data = entry->data;
+    view->data_cplx = entry->data_cplx;
+    view->entry = entry;
+    return view->status;
+}
+
+/*
+    Implementation for releasing a view of a cache.
+
+    Parameters:
+    - cache, the cache.
+    - view, the view, which is reset.
+*/
+static inline void dfl_cache_release_impl_(dfl_cache *cache,
+    dfl_cache_view *view) {
+
+    cache_entry_impl_ *entry = (cache_entry_impl_ *)view->entry;
+    if (entry != NULL) {
+        mutex_lock_impl_(&cache->mutex);
+        entry->references--;
+        if (entry->references == 0 && !entry->cached) {
+            cache_entry_free_impl_(entry);
+        }
+        mutex_unlock_impl_(&cache->mutex);
+    }
+    memset(view, 0, sizeof(dfl_cache_view));
+}
+
+/*
+    Implementation for removing all files of a cache. The files that still
+    have views are released when their last view is released, and the files
+    still being parsed are removed by their loaders.
+
+    Parameter:
+    - cache, the cache.
+*/
+static inline void dfl_cache_clear_impl_(dfl_cache *cache) {
+    mutex_lock_impl_(&cache->mutex);
+    cache_entry_impl_ *entry = cache->head;
+    while (entry != NULL) {
+        cache_entry_impl_ *next = entry->next;
+        if (entry->ready) {
+            cache_unlink_impl_(cache, entry);
+        } else {
+            entry->evict = 1;
+        }
+        entry = next;
+    }
+    mutex_unlock_impl_(&cache->mutex);
+}
+
+/*
+    Implementation for destroying a cache. All its views must have been
+    released.
+
+    Parameter:
+    - cache, the cache.
+*/
+static inline void dfl_cache_destroy_impl_(dfl_cache *cache) {
+    dfl_cache_clear_impl_(cache);
+    cond_destroy_impl_(&cache->cond);
+    mutex_destroy_impl_(&cache->mutex);
+    free(cache);
+}
+
+#endif /* DATA_FILE_LIBRARY_CACHE_IMPL_H */
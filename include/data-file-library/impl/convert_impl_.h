@@ -0,0 +1,569 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/convert_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the streaming conversion between the supported
+        file formats. A reader thread parses the input into a fixed ring of
+        batches of values, while the calling thread formats and writes them,
+        so that the memory does not grow with the size of the files.
+*/
+
+#ifndef DATA_FILE_LIBRARY_CONVERT_IMPL_H
+#define DATA_FILE_LIBRARY_CONVERT_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h> /* For strlen(), strrchr() and memset() */
+#include <ctype.h> /* For isspace() and tolower() */
+#include <errno.h> /* For errno */
+#include "alloc_impl_.h"
+#include "thread_impl_.h"
+#include "parse_impl_.h"
+#include "sepdat_impl_.h"
+#include "wldat_impl_.h"
+
+/* File formats of a conversion */
+#define DFL_FILE_AUTO 0 /* from the extension of the path */
+#define DFL_FILE_CSV 1 /* Comma-Separated Values */
+#define DFL_FILE_TSV 2 /* Tab-Separated Values */
+#define DFL_FILE_WL 3 /* Wolfram Language package source format */
+#define DFL_FILE_BINARY 4 /* raw double-type values in the byte order of
+                             the machine */
+
+/*
+    Options of a conversion. A zeroed struct selects the defaults.
+    - input_format, a DFL_FILE_* format of the input.
+    - output_format, a DFL_FILE_* format of the output.
+    - columns, number of columns of binary inputs, which have no shape.
+    - wl_format, options of the numbers of WL outputs, or NULL.
+    - comment, first line of WL outputs, or NULL for the default one.
+    - batches, number of batches of the ring, where 0 selects 4.
+    - batch_values, number of values of each batch, where 0 selects 65536.
+*/
+typedef struct dfl_convert_options {
+    int input_format;
+    int output_format;
+    size_t columns;
+    const dfl_wl_format *wl_format;
+    const char *comment;
+    int batches;
+    size_t batch_values;
+} dfl_convert_options;
+
+/*
+    Batch of a conversion, i.e., a run of values and the rows that start
+    within it. A row may continue in the next batches.
+*/
+typedef struct {
+    double *values;
+    size_t count;
+    size_t *row_starts;
+    int *row_closes;
+    size_t rows;
+    int last;
+} convert_batch_impl_;
+
+/*
+    State shared by the reader and the writer of a conversion.
+*/
+typedef struct {
+    FILE *input;
+    int format;
+    size_t columns;
+    int dimensions;
+    convert_batch_impl_ *ring;
+    int batches;
+    size_t capacity;
+    unsigned long long produced;
+    unsigned long long consumed;
+    tpmutex_impl_ mutex;
+    tpcond_impl_ not_full;
+    tpcond_impl_ not_empty;
+    convert_batch_impl_ *batch;
+    size_t emitted_rows;
+    int status;
+} convert_context_impl_;
+
+/*
+    Returns the DFL_FILE_* format given by the extension of a path, or
+    DFL_FILE_AUTO if it is unknown.
+
+    Parameter:
+    - file_path, path to the file.
+*/
+static inline int convert_format_from_path_impl_(const char *file_path) {
+    const char *dot = strrchr(file_path, '.');
+    if (dot == NULL) return DFL_FILE_AUTO;
+    char ext[8];
+    size_t n = 0;
+    for (dot++; *dot != '\0' && n < sizeof(ext) - 1; dot++) {
+        ext[n++] = (char)tolower((unsigned char)*dot);
+    }
+    ext[n] = '\0';
+    if (strcmp(ext, "csv") == 0) return DFL_FILE_CSV;
+    if (strcmp(ext, "tsv") == 0) return DFL_FILE_TSV;
+    if (strcmp(ext, "wl") == 0 || strcmp(ext, "m") == 0) return DFL_FILE_WL;
+    if (strcmp(ext, "bin") == 0 || strcmp(ext, "f64") == 0 ||
+        strcmp(ext, "raw") == 0) {
+        return DFL_FILE_BINARY;
+    }
+    return DFL_FILE_AUTO;
+}
+
+/*
+    Hands the current batch to the writer, if any, and waits for an empty
+    batch of the ring to be the current one.
+
+    Parameters:
+    - c, the conversion.
+    - last, whether the current batch is the last one.
+*/
+static inline void convert_publish_impl_(convert_context_impl_ *c,
+    int last) {
+
+    mutex_lock_impl_(&c->mutex);
+    if (c->batch != NULL) {
+        c->batch->last = last;
+        c->produced++;
+        cond_broadcast_impl_(&c->not_empty);
+    }
+    c->batch = NULL;
+    if (!last) {
+        while (c->produced - c->consumed == (unsigned long long)c->batches) {
+            cond_wait_impl_(&c->not_full, &c->mutex);
+        }
+        c->batch = &c->ring[c->produced % (unsigned long long)c->batches];
+        c->batch->count = 0;
+        c->batch->rows = 0;
+        c->batch->last = 0;
+    }
+    mutex_unlock_impl_(&c->mutex);
+}
+
+/*
+    Starts a row in the current batch.
+
+    Parameters:
+    - c, the conversion.
+    - closes, number of braces closed since the start of the previous
+    row, i.e., 0 for the first row and 1 for the rows of a matrix.
+*/
+static inline void convert_emit_row_impl_(convert_context_impl_ *c,
+    int closes) {
+
+    if (c->batch->count == c->capacity || c->batch->rows == c->capacity) {
+        convert_publish_impl_(c, 0);
+    }
+    c->batch->row_starts[c->batch->rows] = c->batch->count;
+    c->batch->row_closes[c->batch->rows] = closes;
+    c->batch->rows++;
+    c->emitted_rows++;
+}
+
+/*
+    Appends a value to the current batch.
+
+    Parameters:
+    - c, the conversion.
+    - value, the value.
+*/
+static inline void convert_emit_value_impl_(convert_context_impl_ *c,
+    double value) {
+
+    if (c->batch->count == c->capacity) convert_publish_impl_(c, 0);
+    c->batch->values[c->batch->count++] = value;
+}
+
+/*
+    Reads the rows of a breakline-separated lines and char-separated
+    columns input. Blank lines are skipped. Returns 0, or EINVAL at the
+    first value that is not a real number, e.g., a complex one.
+
+    Parameters:
+    - c, the conversion.
+    - sep, column separator.
+*/
+static inline int convert_read_sepdat_impl_(convert_context_impl_ *c,
+    char sep) {
+
+    size_t capacity = 128;
+    char *buffer = (char *)dfl_allocate_impl_(NULL, capacity);
+    long long consumed;
+    int row_start = 1;
+    int status = 0;
+    for (;;) {
+        int ch = sepdat_read_token_impl_(c->input, sep, &buffer, &capacity,
+            &consumed);
+        if (row_start) {
+            if (ch != sep && buffer[0] == '\0') {
+                /* Blank line, or the end of the file */
+                if (ch == EOF) break;
+                continue;
+            }
+            convert_emit_row_impl_(c, c->emitted_rows == 0 ? 0 : 1);
+            row_start = 0;
+        }
+        int valid;
+        double value = parse_real_checked_impl_(buffer, &valid);
+        if (!valid) {
+            status = EINVAL;
+            break;
+        }
+        convert_emit_value_impl_(c, value);
+        if (ch != sep) {
+            row_start = 1;
+            if (ch == EOF) break;
+        }
+    }
+    free(buffer);
+    return status;
+}
+
+/*
+    Reads the innermost lists of a Wolfram Language package source format
+    input as rows. The number of dimensions is the number of braces that
+    open the data. The values are read into a buffer that grows as needed,
+    as sepdat_read_token_impl_() does. Returns 0, or EINVAL at the first
+    value that is not a real number, e.g., a complex one.
+
+    Parameter:
+    - c, the conversion.
+*/
+static inline int convert_read_wldat_impl_(convert_context_impl_ *c) {
+
+    int ch;
+
+    /* Skip the first line */
+    while ((ch = getc(c->input)) != EOF && ch != '\n') {}
+
+    /* Count the braces before the first value */
+    int depth = 0;
+    while ((ch = getc(c->input)) != EOF && (ch == '{' || isspace(ch))) {
+        if (ch == '{') depth++;
+    }
+    if (depth == 0) return 0;
+    if (ch != EOF) ungetc(ch, c->input);
+    c->dimensions = depth;
+    convert_emit_row_impl_(c, 0);
+
+    size_t capacity = 128;
+    char *buffer = (char *)dfl_allocate_impl_(NULL, capacity);
+    size_t length = 0;
+    int closes = 0;
+    int status = 0;
+    while (depth > 0 && (ch = getc(c->input)) != EOF) {
+        if (ch == ',' || ch == '}') {
+            if (length > 0) {
+                buffer[length] = '\0';
+                int valid;
+                double value = parse_real_checked_impl_(buffer, &valid);
+                if (!valid) {
+                    status = EINVAL;
+                    break;
+                }
+                convert_emit_value_impl_(c, value);
+                length = 0;
+            }
+            if (ch == '}') {
+                closes++;
+                depth--;
+            }
+        } else if (ch == '{') {
+            depth++;
+            if (depth == c->dimensions) {
+                convert_emit_row_impl_(c, closes);
+                closes = 0;
+            }
+        } else if (!isspace(ch)) {
+            if (length + 1 == capacity) {
+                char *grown = (char *)realloc(buffer, 2*capacity);
+                if (grown == NULL) {
+                    fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                                    " convert_read_wldat_impl_() ->"
+                                    " Error in allocating memory."
+                                    " Exiting.");
+                    exit(EXIT_FAILURE);
+                }
+                buffer = grown;
+                capacity *= 2;
+            }
+            buffer[length++] = (char)ch;
+        }
+    }
+    free(buffer);
+    return status;
+}
+
+/*
+    Reads the rows of columns values of a binary input.
+
+    Parameter:
+    - c, the conversion.
+*/
+static inline void convert_read_binary_impl_(convert_context_impl_ *c) {
+
+    double block[4096];
+    size_t column = 0;
+    size_t n;
+    while ((n = fread(block, sizeof(double), 4096, c->input)) > 0) {
+        for (size_t k = 0; k < n; k++) {
+            if (column == 0) {
+                convert_emit_row_impl_(c, c->emitted_rows == 0 ? 0 : 1);
+            }
+            convert_emit_value_impl_(c, block[k]);
+            if (++column == c->columns) column = 0;
+        }
+    }
+}
+
+/*
+    Thread of the reader of a conversion, which fills the batches of the
+    ring until the end of the input.
+
+    Parameter:
+    - context, the convert_context_impl_.
+*/
+static inline void *convert_reader_impl_(void *context) {
+    convert_context_impl_ *c = (convert_context_impl_ *)context;
+    convert_publish_impl_(c, 0);
+    if (c->format == DFL_FILE_CSV) {
+        c->status = convert_read_sepdat_impl_(c, ',');
+    } else if (c->format == DFL_FILE_TSV) {
+        c->status = convert_read_sepdat_impl_(c, '\t');
+    } else if (c->format == DFL_FILE_WL) {
+        c->status = convert_read_wldat_impl_(c);
+    } else {
+        convert_read_binary_impl_(c);
+    }
+    convert_publish_impl_(c, 1);
+    return NULL;
+}
+
+/*
+    State of the writer of a conversion, kept between the batches.
+*/
+typedef struct {
+    FILE *output;
+    int format;
+    const dfl_wl_format *wl_format;
+    int dimensions;
+    size_t rows;
+    int row_values;
+} convert_writer_impl_;
+
+/*
+    Writes the start of a row.
+
+    Parameters:
+    - w, the writer.
+    - closes, number of braces closed since the start of the previous row.
+*/
+static inline void convert_write_row_impl_(convert_writer_impl_ *w,
+    int closes) {
+
+    if (w->format == DFL_FILE_WL) {
+        if (w->rows == 0) {
+            for (int d = 0; d < w->dimensions; d++) fputc('{', w->output);
+        } else {
+            for (int d = 0; d < closes; d++) fputc('}', w->output);
+            fputs((w->wl_format != NULL && w->wl_format->no_spaces) ?
+                "," : ", ", w->output);
+            for (int d = 0; d < closes; d++) fputc('{', w->output);
+        }
+    } else if (w->format != DFL_FILE_BINARY && w->rows > 0) {
+        fputc('\n', w->output);
+    }
+    w->rows++;
+    w->row_values = 0;
+}
+
+/*
+    Writes the values of a batch, from begin to end.
+
+    Parameters:
+    - w, the writer.
+    - values, the values of the batch.
+    - begin, index of the first value.
+    - end, index after the last value.
+*/
+static inline void convert_write_values_impl_(convert_writer_impl_ *w,
+    const double *values, size_t begin, size_t end) {
+
+    if (w->format == DFL_FILE_BINARY) {
+        fwrite(values + begin, sizeof(double), end - begin, w->output);
+        return;
+    }
+    char buf[128];
+    const char *separator = w->format == DFL_FILE_TSV ? "\t" :
+        w->format == DFL_FILE_CSV ? "," :
+        (w->wl_format != NULL && w->wl_format->no_spaces) ? "," : ", ";
+    for (size_t k = begin; k < end; k++) {
+        if (w->row_values > 0) fputs(separator, w->output);
+        if (w->format == DFL_FILE_WL) {
+            wldat_format_real_impl_(buf, sizeof(buf), values[k],
+                w->wl_format);
+        } else {
+            format_real_impl_(buf, sizeof(buf), values[k]);
+        }
+        fputs(buf, w->output);
+        w->row_values = 1;
+    }
+}
+
+/*
+    Implementation for converting a file from a format to another by
+    streaming its values, with the parse and the format running on separate
+    threads. Returns 0 on success, the errno of the failure to open or
+    write a file, or EINVAL for an unknown format, a binary input without
+    columns, or an input value that is not a real number (e.g., a complex
+    one or an empty cell), in which case the output stops before it.
+
+    Parameters:
+    - input_path, path to the input, or "-" for the standard input.
+    - output_path, path to the output, or "-" for the standard output.
+    - options, options of the conversion, or NULL for the defaults.
+*/
+static inline int dfl_convert_impl_(const char *input_path,
+    const char *output_path, const dfl_convert_options *options) {
+
+    dfl_convert_options o;
+    if (options != NULL) {
+        o = *options;
+    } else {
+        memset(&o, 0, sizeof(o));
+    }
+    int stdin_input = strcmp(input_path, "-") == 0;
+    int stdout_output = strcmp(output_path, "-") == 0;
+    if (o.input_format == DFL_FILE_AUTO && !stdin_input) {
+        o.input_format = convert_format_from_path_impl_(input_path);
+    }
+    if (o.output_format == DFL_FILE_AUTO && !stdout_output) {
+        o.output_format = convert_format_from_path_impl_(output_path);
+    }
+    if (o.input_format < DFL_FILE_CSV || o.input_format > DFL_FILE_BINARY ||
+        o.output_format < DFL_FILE_CSV ||
+        o.output_format > DFL_FILE_BINARY ||
+        (o.input_format == DFL_FILE_BINARY && o.columns == 0)) {
+        return EINVAL;
+    }
+    if (o.batches <= 0) o.batches = 4;
+    if (o.batch_values == 0) o.batch_values = 65536;
+
+    /* Open files */
+    FILE *input = stdin_input ? stdin : fopen(input_path, "rb");
+    if (!input) return errno != 0 ? errno : EIO;
+    FILE *output = stdout_output ? stdout : fopen(output_path,
+        o.output_format == DFL_FILE_BINARY ? "wb" : "w");
+    if (!output) {
+        int status = errno != 0 ? errno : EIO;
+        if (!stdin_input) fclose(input);
+        return status;
+    }
+
+    /* Allocate the ring */
+    convert_context_impl_ c;
+    memset(&c, 0, sizeof(c));
+    c.input = input;
+    c.format = o.input_format;
+    c.columns = o.columns;
+    c.dimensions = 2;
+    c.batches = o.batches;
+    c.capacity = o.batch_values;
+    c.ring = (convert_batch_impl_ *)dfl_allocate_impl_(NULL,
+        (size_t)o.batches * sizeof(convert_batch_impl_));
+    for (int b = 0; b < o.batches; b++) {
+        c.ring[b].values = (double *)dfl_allocate_impl_(NULL,
+            o.batch_values * sizeof(double));
+        c.ring[b].row_starts = (size_t *)dfl_allocate_impl_(NULL,
+            o.batch_values * sizeof(size_t));
+        c.ring[b].row_closes = (int *)dfl_allocate_impl_(NULL,
+            o.batch_values * sizeof(int));
+    }
+    mutex_init_impl_(&c.mutex);
+    cond_init_impl_(&c.not_full);
+    cond_init_impl_(&c.not_empty);
+
+    /* The reader parses while the calling thread writes */
+    tpthread_impl_ reader;
+    thread_create_impl_(&reader, convert_reader_impl_, &c);
+
+    convert_writer_impl_ w;
+    memset(&w, 0, sizeof(w));
+    w.output = output;
+    w.format = o.output_format;
+    w.wl_format = o.wl_format;
+    if (w.format == DFL_FILE_WL) {
+        if (o.comment == NULL || o.comment[0] == '\0') {
+            fprintf(output, "(* Created with Data File Library:"
+                " <https://github.com/jodesarro/data-file-library> *)\n");
+        } else {
+            fprintf(output, "(* %s *)\n", o.comment);
+        }
+    }
+
+    for (;;) {
+        mutex_lock_impl_(&c.mutex);
+        while (c.consumed == c.produced) {
+            cond_wait_impl_(&c.not_empty, &c.mutex);
+        }
+        convert_batch_impl_ *batch =
+            &c.ring[c.consumed % (unsigned long long)c.batches];
+        w.dimensions = c.dimensions;
+        mutex_unlock_impl_(&c.mutex);
+
+        /* Write the values between the starts of the rows */
+        size_t begin = 0;
+        for (size_t r = 0; r < batch->rows; r++) {
+            convert_write_values_impl_(&w, batch->values, begin,
+                batch->row_starts[r]);
+            convert_write_row_impl_(&w, batch->row_closes[r]);
+            begin = batch->row_starts[r];
+        }
+        convert_write_values_impl_(&w, batch->values, begin, batch->count);
+        int last = batch->last;
+
+        mutex_lock_impl_(&c.mutex);
+        c.consumed++;
+        cond_broadcast_impl_(&c.not_full);
+        mutex_unlock_impl_(&c.mutex);
+        if (last) break;
+    }
+    thread_join_impl_(reader);
+
+    /* End the data */
+    if (w.format == DFL_FILE_WL) {
+        if (w.rows == 0) {
+            fputs("{}", output);
+        } else {
+            for (int d = 0; d < w.dimensions; d++) fputc('}', output);
+        }
+        fputc('\n', output);
+    } else if (w.format != DFL_FILE_BINARY && w.rows > 0) {
+        fputc('\n', output);
+    }
+
+    /* Close files, the reader having stopped at an invalid value */
+    int status = ferror(input) ? EIO : c.status;
+    if (fflush(output) != 0 || ferror(output)) status = EIO;
+    if (!stdin_input) fclose(input);
+    if (!stdout_output && fclose(output) != 0) status = EIO;
+
+    cond_destroy_impl_(&c.not_empty);
+    cond_destroy_impl_(&c.not_full);
+    mutex_destroy_impl_(&c.mutex);
+    for (int b = 0; b < o.batches; b++) {
+        free(c.ring[b].values);
+        free(c.ring[b].row_starts);
+        free(c.ring[b].row_closes);
+    }
+    free(c.ring);
+    return status;
+}
+
+#endif /* DATA_FILE_LIBRARY_CONVERT_IMPL_H */
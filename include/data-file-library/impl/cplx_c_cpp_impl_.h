@@ -20,10 +20,12 @@
 
 #include <complex> /* For complex numbers */
 #define I_IMPL_ std::complex<double>(0.0, 1.0)
-#define creal(z) std::real(z)
-#define cimag(z) std::imag(z)
 typedef std::complex<double> tpdfcplx_impl_;
 
+/* Real and imaginary parts, without leaking creal/cimag macros to users */
+static inline double creal_impl_(tpdfcplx_impl_ z) { return std::real(z); }
+static inline double cimag_impl_(tpdfcplx_impl_ z) { return std::imag(z); }
+
 #else
 
 /* C99 */
@@ -32,6 +34,10 @@ typedef std::complex<double> tpdfcplx_impl_;
 #define I_IMPL_ I
 typedef double complex tpdfcplx_impl_;
 
+/* Real and imaginary parts */
+static inline double creal_impl_(tpdfcplx_impl_ z) { return creal(z); }
+static inline double cimag_impl_(tpdfcplx_impl_ z) { return cimag(z); }
+
 #endif /* __cplusplus */
 
 #endif /* DATA_FILE_LIBRARY_CPLX_C_CPP_IMPL_H */
\ No newline at end of file
@@ -0,0 +1,295 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/direct_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the files of the direct exports, which write
+        large files without filling the page cache. On Linux with the GNU C
+        library (compiled with _GNU_SOURCE), the file is preallocated with
+        fallocate() and written in aligned blocks with O_DIRECT through a
+        FILE from fopencookie(), falling back to buffered writes whose pages
+        are dropped behind the writer when O_DIRECT is not supported.
+        Elsewhere, the file is written by stdio and dropped from the page
+        cache when closed, where posix_fadvise() is available. Defining
+        DATA_FILE_LIBRARY_DIRECT_IO makes the builds without O_DIRECT fail,
+        e.g., header-only ones missing _GNU_SOURCE.
+*/
+
+#ifndef DATA_FILE_LIBRARY_DIRECT_IMPL_H
+#define DATA_FILE_LIBRARY_DIRECT_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For free() */
+#include <string.h> /* For memcpy() and memset() */
+#include <errno.h> /* For errno */
+#include <stdint.h> /* For uintptr_t */
+#include "alloc_impl_.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h> /* For open(), O_DIRECT, fallocate() and posix_fadvise() */
+#include <unistd.h> /* For write(), ftruncate(), fsync() and close() */
+#endif
+
+#if defined(__GLIBC__) && defined(O_DIRECT) && defined(SYNC_FILE_RANGE_WRITE)
+#define DFL_DIRECT_IO_IMPL_ 1
+#endif
+
+#if defined(DATA_FILE_LIBRARY_DIRECT_IO) && !defined(DFL_DIRECT_IO_IMPL_)
+#error "DATA_FILE_LIBRARY_DIRECT_IO needs Linux with the GNU C library and \
+_GNU_SOURCE defined before any #include."
+#endif
+
+/* Size of the aligned blocks written to the file */
+#define DFL_DIRECT_BUFFER_IMPL_ ((size_t)8 << 20)
+
+/* Alignment of the blocks, a multiple of the sector size of the disks */
+#define DFL_DIRECT_ALIGNMENT_IMPL_ ((size_t)4096)
+
+#ifdef DFL_DIRECT_IO_IMPL_
+
+/*
+    State of a file of a direct export.
+    - fd, the file descriptor.
+    - direct, 1 while O_DIRECT is set, otherwise 0.
+    - raw, the allocated buffer.
+    - buffer, the buffer aligned to DFL_DIRECT_ALIGNMENT_IMPL_.
+    - filled, number of bytes in the buffer.
+    - written, number of bytes written to the file.
+    - dropped, number of bytes dropped from the page cache.
+    - status, 0 or the errno of the first failure.
+*/
+typedef struct {
+    int fd;
+    int direct;
+    char *raw;
+    char *buffer;
+    size_t filled;
+    long long written;
+    long long dropped;
+    int status;
+} direct_file_impl_;
+
+/*
+    Writes bytes to the file, clearing O_DIRECT and writing them again if
+    it is refused, e.g., by file systems or blocks without alignment.
+    Returns 0 or the errno of the failure.
+
+    Parameters:
+    - state, the state of the file.
+    - bytes, the bytes.
+    - size, number of bytes.
+*/
+static inline int direct_write_all_impl_(direct_file_impl_ *state,
+    const char *bytes, size_t size) {
+
+    while (size > 0) {
+        ssize_t n = write(state->fd, bytes, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EINVAL && state->direct) {
+                int flags = fcntl(state->fd, F_GETFL);
+                if (flags == -1 ||
+                    fcntl(state->fd, F_SETFL, flags & ~O_DIRECT) == -1) {
+                    return errno;
+                }
+                state->direct = 0;
+                continue;
+            }
+            return errno;
+        }
+        bytes += n;
+        size -= (size_t)n;
+        state->written += (long long)n;
+    }
+    return 0;
+}
+
+/*
+    Writes the full buffer to the file. Without O_DIRECT, starts the
+    writeback of the new bytes, then waits for that of the bytes before them
+    and drops them from the page cache, so that the page cache holds about
+    two buffers of the file. Returns 0 or the errno of the failure.
+
+    Parameters:
+    - state, the state of the file.
+*/
+static inline int direct_flush_impl_(direct_file_impl_ *state) {
+    long long start = state->written;
+    int status = direct_write_all_impl_(state, state->buffer,
+        state->filled);
+    state->filled = 0;
+    if (status != 0 || state->direct) return status;
+
+    sync_file_range(state->fd, start, state->written - start,
+        SYNC_FILE_RANGE_WRITE);
+    if (start > state->dropped) {
+        sync_file_range(state->fd, state->dropped, start - state->dropped,
+            SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+            SYNC_FILE_RANGE_WAIT_AFTER);
+        posix_fadvise(state->fd, state->dropped, start - state->dropped,
+            POSIX_FADV_DONTNEED);
+        state->dropped = start;
+    }
+    return 0;
+}
+
+/*
+    Write function of the FILE of a direct export, which copies the bytes
+    to the aligned buffer and writes it whenever it is full. Returns the
+    number of bytes, or 0 on failure.
+*/
+static inline ssize_t direct_cookie_write_impl_(void *cookie,
+    const char *bytes, size_t size) {
+
+    direct_file_impl_ *state = (direct_file_impl_ *)cookie;
+    if (state->status != 0) {
+        errno = state->status;
+        return 0;
+    }
+    size_t done = 0;
+    while (done < size) {
+        size_t n = DFL_DIRECT_BUFFER_IMPL_ - state->filled;
+        if (n > size - done) n = size - done;
+        memcpy(state->buffer + state->filled, bytes + done, n);
+        state->filled += n;
+        done += n;
+        if (state->filled == DFL_DIRECT_BUFFER_IMPL_) {
+            state->status = direct_flush_impl_(state);
+            if (state->status != 0) {
+                errno = state->status;
+                return 0;
+            }
+        }
+    }
+    return (ssize_t)size;
+}
+
+/*
+    Close function of the FILE of a direct export. The last bytes are padded
+    to an aligned block under O_DIRECT, and the file is then truncated to
+    its size, which also releases the preallocation beyond it. Without
+    O_DIRECT, the file is synchronized and dropped from the page cache.
+    Returns 0, or -1 with errno on failure.
+*/
+static inline int direct_cookie_close_impl_(void *cookie) {
+    direct_file_impl_ *state = (direct_file_impl_ *)cookie;
+    int status = state->status;
+    long long size = state->written + (long long)state->filled;
+    if (status == 0 && state->filled > 0) {
+        if (state->direct) {
+            size_t padded = (state->filled + DFL_DIRECT_ALIGNMENT_IMPL_ - 1) /
+                DFL_DIRECT_ALIGNMENT_IMPL_ * DFL_DIRECT_ALIGNMENT_IMPL_;
+            memset(state->buffer + state->filled, 0,
+                padded - state->filled);
+            state->filled = padded;
+        }
+        status = direct_write_all_impl_(state, state->buffer,
+            state->filled);
+    }
+    if (status == 0 && ftruncate(state->fd, size) != 0) status = errno;
+    if (status == 0 && !state->direct) {
+        if (fdatasync(state->fd) != 0) status = errno;
+        posix_fadvise(state->fd, 0, 0, POSIX_FADV_DONTNEED);
+    }
+    if (close(state->fd) != 0 && status == 0) status = errno;
+    free(state->raw);
+    free(state);
+    if (status != 0) {
+        errno = status;
+        return -1;
+    }
+    return 0;
+}
+
+#endif /* DFL_DIRECT_IO_IMPL_ */
+
+/*
+    Opens a file for a direct export, truncating it. Returns the file, to
+    be closed with direct_fclose_impl_(), or NULL with errno on failure.
+
+    Parameters:
+    - file_path, path to the file.
+    - estimate, estimated size of the file in bytes, which is preallocated,
+    or 0.
+*/
+static inline FILE *direct_fopen_impl_(const char *file_path,
+    long long estimate) {
+
+#ifdef DFL_DIRECT_IO_IMPL_
+    int direct = 1;
+    int fd = open(file_path, O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0666);
+    if (fd < 0 && errno == EINVAL) {
+        /* File system without O_DIRECT */
+        direct = 0;
+        fd = open(file_path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    }
+    if (fd < 0) return NULL;
+
+    /* Contiguous blocks, where supported, released beyond the size when
+       the file is closed */
+    if (estimate > 0) fallocate(fd, 0, 0, (off_t)estimate);
+
+    direct_file_impl_ *state = (direct_file_impl_ *)dfl_allocate_impl_(NULL,
+        sizeof(direct_file_impl_));
+    memset(state, 0, sizeof(direct_file_impl_));
+    state->fd = fd;
+    state->direct = direct;
+    state->raw = (char *)dfl_allocate_impl_(NULL,
+        DFL_DIRECT_BUFFER_IMPL_ + DFL_DIRECT_ALIGNMENT_IMPL_);
+    state->buffer = (char *)(((uintptr_t)state->raw +
+        DFL_DIRECT_ALIGNMENT_IMPL_ - 1) &
+        ~(uintptr_t)(DFL_DIRECT_ALIGNMENT_IMPL_ - 1));
+
+    cookie_io_functions_t functions;
+    memset(&functions, 0, sizeof(functions));
+    functions.write = direct_cookie_write_impl_;
+    functions.close = direct_cookie_close_impl_;
+    FILE *file = fopencookie(state, "w", functions);
+    if (file == NULL) {
+        int error = errno;
+        close(fd);
+        free(state->raw);
+        free(state);
+        errno = error;
+        return NULL;
+    }
+    setvbuf(file, NULL, _IOFBF, (size_t)1 << 16);
+    return file;
+#else
+    (void)estimate;
+    return fopen(file_path, "w");
+#endif
+}
+
+/*
+    Closes a file of a direct export. Returns 0, or the errno of the first
+    failure to write the file.
+
+    Parameters:
+    - file, the file from direct_fopen_impl_().
+*/
+static inline int direct_fclose_impl_(FILE *file) {
+    int status = 0;
+    if (fflush(file) != 0 || ferror(file)) {
+        status = errno != 0 ? errno : EIO;
+    }
+#if !defined(DFL_DIRECT_IO_IMPL_) && defined(__linux__) && \
+    defined(POSIX_FADV_DONTNEED)
+    /* Written pages must be clean to be dropped */
+    if (status == 0 && fsync(fileno(file)) == 0) {
+        posix_fadvise(fileno(file), 0, 0, POSIX_FADV_DONTNEED);
+    }
+#endif
+    errno = 0;
+    if (fclose(file) != 0 && status == 0) {
+        status = errno != 0 ? errno : EIO;
+    }
+    return status;
+}
+
+#endif /* DATA_FILE_LIBRARY_DIRECT_IMPL_H */
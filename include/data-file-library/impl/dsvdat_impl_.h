@@ -0,0 +1,403 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/dsvdat_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of functions for handling Delimiter-Separated Values
+        files of a given dialect, i.e., with any set of column separators,
+        comment lines, header rows, CRLF or CR line breaks, and runs of
+        separators collapsed into one, parsed without preprocessing.
+*/
+
+#ifndef DATA_FILE_LIBRARY_DSVDAT_IMPL_H
+#define DATA_FILE_LIBRARY_DSVDAT_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For realloc(), free() and EXIT_FAILURE */
+#include <string.h> /* For strerror(), memset() and memchr() */
+#include <errno.h> /* For errno */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "parse_impl_.h"
+#include "sepdat_impl_.h"
+
+/*
+    Dialect of a Delimiter-Separated Values file.
+    - separators, the characters that separate the columns, e.g., ";" or
+    " \t", or NULL for ",".
+    - comment, the character that starts a comment running to the end of
+    its line, e.g., '#', or '\0' for none. Lines left with nothing are
+    skipped.
+    - header_rows, number of lines skipped at the start of the file.
+    - collapse_separators, 1 to take a run of separators as a single one and
+    to ignore the separators at the start and at the end of the lines, as
+    in space-aligned columns, otherwise 0.
+    - cr_line_breaks, 1 to take a lone '\r' as a line break too, otherwise 0.
+    CRLF line breaks are always taken as a single line break.
+    Blank lines are always skipped.
+*/
+typedef struct dfl_dialect {
+    const char *separators;
+    char comment;
+    int header_rows;
+    int collapse_separators;
+    int cr_line_breaks;
+} dfl_dialect;
+
+/*
+    Reader of the lines of a Delimiter-Separated Values file.
+*/
+typedef struct {
+    FILE *file;
+    unsigned char is_separator[256];
+    char comment;
+    int header_rows;
+    int collapse;
+    int cr_line_breaks;
+    long long line_offset;
+    long long next_offset;
+    char *buffer;
+    size_t capacity;
+} dsvdat_reader_impl_;
+
+/*
+    Opens a reader, exiting if the file cannot be opened.
+
+    Parameters:
+    - reader, the reader.
+    - file_path, path to the file.
+    - dialect, the dialect, or NULL for comma-separated values.
+    - caller, name of the calling function for the error message.
+*/
+static inline void dsvdat_reader_open_impl_(dsvdat_reader_impl_ *reader,
+    const char *file_path, const dfl_dialect *dialect, const char *caller) {
+
+    /* Open file */
+    reader->file = fopen(file_path, "rb");
+    if (!reader->file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " %s() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", caller, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    /* Table of separators, so that each char is classified at once */
+    const char *separators = ",";
+    memset(reader->is_separator, 0, sizeof(reader->is_separator));
+    reader->comment = '\0';
+    reader->header_rows = 0;
+    reader->collapse = 0;
+    reader->cr_line_breaks = 0;
+    if (dialect != NULL) {
+        if (dialect->separators != NULL) separators = dialect->separators;
+        reader->comment = dialect->comment;
+        reader->header_rows = dialect->header_rows;
+        reader->collapse = dialect->collapse_separators;
+        reader->cr_line_breaks = dialect->cr_line_breaks;
+    }
+    for (const char *c = separators; *c != '\0'; c++) {
+        reader->is_separator[(unsigned char)*c] = 1;
+    }
+
+    reader->line_offset = 0;
+    reader->next_offset = 0;
+    reader->capacity = 256;
+    reader->buffer = (char *)dfl_allocate_impl_(NULL, reader->capacity);
+}
+
+/*
+    Closes a reader.
+
+    Parameter:
+    - reader, the reader.
+*/
+static inline void dsvdat_reader_close_impl_(dsvdat_reader_impl_ *reader) {
+    free(reader->buffer);
+    fclose(reader->file);
+}
+
+/*
+    Reads the next line holding values, skipping the header rows, the
+    comments and the blank lines. Returns the first character of the line,
+    without its line break, comment and, if the separators are collapsed,
+    its leading and trailing separators, or NULL at the end of the file.
+    The byte offset of the line is kept in reader->line_offset.
+
+    Parameter:
+    - reader, the reader.
+*/
+static inline char *dsvdat_reader_next_line_impl_(
+    dsvdat_reader_impl_ *reader) {
+
+    for (;;) {
+        size_t length = 0;
+        int ch;
+        reader->line_offset = reader->next_offset;
+        while ((ch = getc(reader->file)) != EOF) {
+            reader->next_offset++;
+            if (ch == '\n') break;
+            if (ch == '\r' && reader->cr_line_breaks) {
+                /* CR or CRLF line break */
+                int next = getc(reader->file);
+                if (next == '\n') {
+                    reader->next_offset++;
+                } else if (next != EOF) {
+                    ungetc(next, reader->file);
+                }
+                break;
+            }
+            if (length + 1 == reader->capacity) {
+                char *grown = (char *)realloc(reader->buffer,
+                    2*reader->capacity);
+                if (grown == NULL) {
+                    fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                                    " dsvdat_reader_next_line_impl_() ->"
+                                    " Error in allocating memory."
+                                    " Exiting.");
+                    exit(EXIT_FAILURE);
+                }
+                reader->buffer = grown;
+                reader->capacity *= 2;
+            }
+            reader->buffer[length++] = (char)ch;
+        }
+        if (ch == EOF && length == 0) return NULL;
+
+        /* Header rows */
+        if (reader->header_rows > 0) {
+            reader->header_rows--;
+            continue;
+        }
+
+        /* Comment, and carriage return of a CRLF line break */
+        char *line = reader->buffer;
+        if (reader->comment != '\0') {
+            char *comment = (char *)memchr(line, reader->comment, length);
+            if (comment != NULL) length = (size_t)(comment - line);
+        }
+        if (length > 0 && line[length - 1] == '\r') length--;
+
+        /* Leading and trailing separators */
+        if (reader->collapse) {
+            while (length > 0 &&
+                reader->is_separator[(unsigned char)line[length - 1]]) {
+                length--;
+            }
+            while (length > 0 &&
+                reader->is_separator[(unsigned char)*line]) {
+                line++;
+                length--;
+            }
+        }
+
+        /* Blank line */
+        size_t k = 0;
+        while (k < length && (line[k] == ' ' || line[k] == '\t')) k++;
+        if (k == length) continue;
+
+        line[length] = '\0';
+        return line;
+    }
+}
+
+/*
+    Returns the next value of a line read by dsvdat_reader_next_line_impl_()
+    and moves the cursor after its separator, or sets the cursor to NULL
+    after the last value.
+
+    Parameters:
+    - reader, the reader.
+    - cursor, position in the line, which starts at the line.
+*/
+static inline char *dsvdat_next_token_impl_(
+    const dsvdat_reader_impl_ *reader, char **cursor) {
+
+    char *token = *cursor;
+    char *p = token;
+    while (*p != '\0' && !reader->is_separator[(unsigned char)*p]) p++;
+    if (*p == '\0') {
+        *cursor = NULL;
+    } else {
+        *p++ = '\0';
+        if (reader->collapse) {
+            while (reader->is_separator[(unsigned char)*p]) p++;
+        }
+        *cursor = p;
+    }
+    return token;
+}
+
+/*
+    Implementation for getting the size in each dimension (number of rows and
+    columns) from a Delimiter-Separated Values file of a given dialect.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows holding values as size_t.
+    - &columns, to output the largest number of columns of a row as size_t.
+    - dialect, the dialect, or NULL for comma-separated values.
+*/
+static inline void dsvdat_get_sizes64_impl_(const char *file_path,
+    size_t *rows, size_t *columns, const dfl_dialect *dialect) {
+
+    dsvdat_reader_impl_ reader;
+    dsvdat_reader_open_impl_(&reader, file_path, dialect,
+        "dsvdat_get_sizes64_impl_");
+
+    *rows = 0;
+    *columns = 0;
+    char *line;
+    while ((line = dsvdat_reader_next_line_impl_(&reader)) != NULL) {
+        size_t current_cols = 0;
+        while (line != NULL) {
+            dsvdat_next_token_impl_(&reader, &line);
+            current_cols++;
+        }
+        if (current_cols > *columns) *columns = current_cols;
+        (*rows)++;
+    }
+
+    dsvdat_reader_close_impl_(&reader);
+}
+
+/*
+    Implementation for getting the size in each dimension from a
+    Delimiter-Separated Values file, as dsvdat_get_sizes64_impl_(), as int.
+*/
+static inline void dsvdat_get_sizes_impl_(const char *file_path, int *rows,
+    int *columns, const dfl_dialect *dialect) {
+
+    size_t rows64;
+    size_t columns64;
+    dsvdat_get_sizes64_impl_(file_path, &rows64, &columns64, dialect);
+    *rows = size_to_int_impl_(rows64, "dsvdat_get_sizes_impl_");
+    *columns = size_to_int_impl_(columns64, "dsvdat_get_sizes_impl_");
+}
+
+/*
+    Implementation for reading double-type or 'double complex'-type data
+    from a Delimiter-Separated Values file of a given dialect and of known
+    sizes, as given by dsvdat_get_sizes_impl_(), into an one-dimensional
+    array following the row-major order. Returns the number of cells that
+    are not numbers when a report is given, otherwise 0.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array of the size rows*columns for real values,
+    otherwise NULL.
+    - data_cplx, 'double complex'-type array of the size rows*columns for
+    complex values, otherwise NULL.
+    - rows, number of rows of the file.
+    - columns, number of columns of the file.
+    - dialect, the dialect, or NULL for comma-separated values.
+    - report, options and result of a checked import, or NULL.
+*/
+static inline int dsvdat_read_impl_(const char *file_path, double *data,
+    tpdfcplx_impl_ *data_cplx, size_t rows, size_t columns,
+    const dfl_dialect *dialect, dfl_parse_report *report) {
+
+    dsvdat_reader_impl_ reader;
+    dsvdat_reader_open_impl_(&reader, file_path, dialect,
+        "dsvdat_read_impl_");
+    if (report != NULL) report->count = 0;
+
+    /* Read file */
+    char *line;
+    int stop = 0;
+    for (size_t i = 0; i < rows && !stop &&
+        (line = dsvdat_reader_next_line_impl_(&reader)) != NULL; i++) {
+        for (size_t j = 0; j < columns && line != NULL; j++) {
+            char *token = dsvdat_next_token_impl_(&reader, &line);
+            /* Parse and store */
+            int valid;
+            if (data_cplx != NULL) {
+                data_cplx[j + columns*i] = parse_complex_checked_impl_(token,
+                    &valid);
+            } else {
+                data[j + columns*i] = parse_real_checked_impl_(token,
+                    &valid);
+            }
+            if (!valid && report != NULL &&
+                sepdat_report_cell_impl_(report, (long long)i, (long long)j,
+                reader.line_offset + (long long)(token - reader.buffer))) {
+                stop = 1;
+                break;
+            }
+        }
+    }
+
+    dsvdat_reader_close_impl_(&reader);
+    return report != NULL ? report->count : 0;
+}
+
+/*
+    Implementation for importing double-type data from a
+    Delimiter-Separated Values file of a given dialect into an
+    one-dimensional double-type array following the row-major order.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns,
+    where rows and columns may be obtained through dsvdat_get_sizes_impl_().
+    - dialect, the dialect, or NULL for comma-separated values.
+    - report, options and result of a checked import, or NULL.
+*/
+static inline int dsvdat_import_impl_(const char *file_path, double *data,
+    const dfl_dialect *dialect, dfl_parse_report *report) {
+
+    size_t rows;
+    size_t columns;
+    dsvdat_get_sizes64_impl_(file_path, &rows, &columns, dialect);
+
+    return dsvdat_read_impl_(file_path, data, NULL, rows, columns, dialect,
+        report);
+}
+
+/*
+    Implementation for importing 'double complex'-type data from a
+    Delimiter-Separated Values file of a given dialect into an
+    one-dimensional 'double complex'-type array following the row-major
+    order.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns, where rows and columns may be obtained through
+    dsvdat_get_sizes_impl_().
+    - dialect, the dialect, or NULL for comma-separated values.
+    - report, options and result of a checked import, or NULL.
+*/
+static inline int dsvdat_import_cplx_impl_(const char *file_path,
+    tpdfcplx_impl_ *data, const dfl_dialect *dialect,
+    dfl_parse_report *report) {
+
+    size_t rows;
+    size_t columns;
+    dsvdat_get_sizes64_impl_(file_path, &rows, &columns, dialect);
+
+    return dsvdat_read_impl_(file_path, NULL, data, rows, columns, dialect,
+        report);
+}
+
+/*
+    Returns the column separator written by the exports of a dialect, i.e.,
+    its first separator.
+
+    Parameter:
+    - dialect, the dialect, or NULL for comma-separated values.
+*/
+static inline char dsvdat_export_separator_impl_(const dfl_dialect *dialect) {
+    if (dialect == NULL || dialect->separators == NULL ||
+        dialect->separators[0] == '\0') {
+        return ',';
+    }
+    return dialect->separators[0];
+}
+
+#endif /* DATA_FILE_LIBRARY_DSVDAT_IMPL_H */
@@ -0,0 +1,340 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/follow_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the incremental (tail-follow) import of
+        char-separated columns data files that are still being written.
+        Each call parses only the complete lines appended since the previous
+        call, and starts over when the file is truncated or replaced.
+*/
+
+#ifndef DATA_FILE_LIBRARY_FOLLOW_IMPL_H
+#define DATA_FILE_LIBRARY_FOLLOW_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For malloc(), realloc() and free() */
+#include <string.h> /* For memset() and memchr() */
+#include <errno.h> /* For errno */
+#include <sys/types.h> /* For off_t */
+#include <sys/stat.h> /* For stat() */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "parse_impl_.h"
+
+/*
+    State of the incremental import of one file, and the values imported
+    so far.
+    - data, the rows*columns values of real-valued imports, following the
+    row-major order, otherwise NULL.
+    - data_cplx, the values of complex-valued imports, otherwise NULL.
+    - rows, number of complete rows imported so far.
+    - columns, largest number of columns of a row; shorter rows are padded
+    with zeros.
+    - restarted, 1 if the last call discarded the previous values because
+    the file was truncated or replaced, otherwise 0.
+    The other fields are internal.
+*/
+typedef struct dfl_follow {
+    double *data;
+    tpdfcplx_impl_ *data_cplx;
+    int rows;
+    int columns;
+    int restarted;
+    int capacity;
+    long long offset;
+    long long size;
+    unsigned long long device;
+    unsigned long long inode;
+} dfl_follow;
+
+/*
+    Implementation for initializing the state of an incremental import.
+*/
+static inline void dfl_follow_init_impl_(dfl_follow *follow) {
+    memset(follow, 0, sizeof(dfl_follow));
+}
+
+/*
+    Implementation for releasing the values of an incremental import and
+    resetting its state.
+*/
+static inline void dfl_follow_destroy_impl_(dfl_follow *follow) {
+    free(follow->data);
+    free(follow->data_cplx);
+    dfl_follow_init_impl_(follow);
+}
+
+/*
+    Moves the position of a file to a byte offset that may exceed the range
+    of long, through _fseeki64() on Windows and fseeko() where POSIX
+    declares it, whose off_t has 64 bits on 32-bit systems when
+    _FILE_OFFSET_BITS is 64 (as in the Makefile). Elsewhere, e.g., in strict
+    C99 builds, fseek() is used, whose long has 64 bits on 64-bit POSIX
+    systems. Returns 0 on success, or -1 with errno set to EOVERFLOW if the
+    offset does not fit.
+*/
+static inline int file_seek_impl_(FILE *file, long long offset) {
+#if defined(_WIN32) || defined(_WIN64)
+    return _fseeki64(file, offset, SEEK_SET);
+#elif (defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L) || \
+    (defined(_XOPEN_SOURCE) && _XOPEN_SOURCE >= 500) || \
+    defined(_LARGEFILE_SOURCE) || defined(__APPLE__)
+    if ((long long)(off_t)offset != offset) {
+        errno = EOVERFLOW;
+        return -1;
+    }
+    return fseeko(file, (off_t)offset, SEEK_SET);
+#else
+    if ((long long)(long)offset != offset) {
+        errno = EOVERFLOW;
+        return -1;
+    }
+    return fseek(file, (long)offset, SEEK_SET);
+#endif
+}
+
+/*
+    Outputs the size of a file by moving its position to the end, with the
+    same 64-bit offsets as file_seek_impl_(). Returns 0 on success, or -1
+    with errno set, e.g., to EOVERFLOW if the size does not fit.
+
+    Parameters:
+    - file, the file.
+    - size, to output the number of bytes.
+*/
+static inline int file_size_impl_(FILE *file, long long *size) {
+#if defined(_WIN32) || defined(_WIN64)
+    if (_fseeki64(file, 0, SEEK_END) != 0) return -1;
+    *size = (long long)_ftelli64(file);
+#elif (defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L) || \
+    (defined(_XOPEN_SOURCE) && _XOPEN_SOURCE >= 500) || \
+    defined(_LARGEFILE_SOURCE) || defined(__APPLE__)
+    if (fseeko(file, 0, SEEK_END) != 0) return -1;
+    *size = (long long)ftello(file);
+#else
+    if (fseek(file, 0, SEEK_END) != 0) return -1;
+    *size = (long long)ftell(file);
+#endif
+    return *size < 0 ? -1 : 0;
+}
+
+/*
+    Reallocates the values of an incremental import to hold capacity rows
+    of columns values, moving the existing rows when the number of columns
+    grows and padding new values with zeros.
+
+    Parameters:
+    - follow, the state.
+    - capacity, new number of rows that fit.
+    - columns, new number of columns.
+    - cplx, whether the values are complex numbers.
+*/
+static inline void follow_resize_impl_(dfl_follow *follow, int capacity,
+    int columns, int cplx) {
+
+    size_t element = cplx ? sizeof(tpdfcplx_impl_) : sizeof(double);
+    size_t old_row = (size_t)follow->columns * element;
+    size_t new_row = (size_t)columns * element;
+    char *old = cplx ? (char *)follow->data_cplx : (char *)follow->data;
+    char *values;
+
+    if (columns == follow->columns) {
+        values = (char *)realloc(old, (size_t)capacity * new_row + 1);
+    } else {
+        /* Rows must move apart, so copy them into a new array */
+        values = (char *)malloc((size_t)capacity * new_row + 1);
+        if (values != NULL) {
+            for (int i = 0; i < follow->rows; i++) {
+                if (old_row > 0) {
+                    memcpy(values + i*new_row, old + i*old_row, old_row);
+                }
+                memset(values + i*new_row + old_row, 0, new_row - old_row);
+            }
+            free(old);
+        }
+    }
+    if (values == NULL) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " follow_resize_impl_() ->"
+                        " Error in allocating memory."
+                        " Exiting.");
+        exit(EXIT_FAILURE);
+    }
+
+    if (cplx) {
+        follow->data_cplx = (tpdfcplx_impl_ *)values;
+    } else {
+        follow->data = (double *)values;
+    }
+    follow->capacity = capacity;
+    follow->columns = columns;
+}
+
+/*
+    Parses one complete line, without its line break, and appends it as a
+    row. A blank line is a row with one empty value, as in the sizes of
+    sepdat_get_sizes_impl_() and the full imports.
+
+    Parameters:
+    - follow, the state.
+    - line, the line, which is modified in place.
+    - length, number of characters of the line.
+    - sep, column separator.
+    - cplx, whether the values are complex numbers.
+*/
+static inline void follow_append_line_impl_(dfl_follow *follow, char *line,
+    size_t length, char sep, int cplx) {
+
+    /* Ignore a carriage return of CRLF line breaks */
+    if (length > 0 && line[length - 1] == '\r') length--;
+    line[length] = '\0';
+
+    /* Count the columns of the line */
+    int columns = 1;
+    for (size_t k = 0; k < length; k++) {
+        if (line[k] == sep) columns++;
+    }
+
+    /* Make room for the row */
+    if (follow->rows == follow->capacity || columns > follow->columns) {
+        int capacity = follow->capacity;
+        if (follow->rows == capacity) {
+            capacity = capacity < 16 ? 16 : 2*capacity;
+        }
+        follow_resize_impl_(follow, capacity,
+            columns > follow->columns ? columns : follow->columns, cplx);
+    }
+
+    /* Parse the values, padding the missing columns with zeros */
+    size_t base = (size_t)follow->rows * (size_t)follow->columns;
+    char *token = line;
+    for (int j = 0; j < follow->columns; j++) {
+        if (j < columns) {
+            char *end = token;
+            while (*end != '\0' && *end != sep) end++;
+            int last = (*end == '\0');
+            *end = '\0';
+            if (cplx) {
+                follow->data_cplx[base + j] = parse_complex_impl_(token);
+            } else {
+                follow->data[base + j] = parse_real_impl_(token);
+            }
+            token = last ? end : end + 1;
+        } else if (cplx) {
+            follow->data_cplx[base + j] = 0.0;
+        } else {
+            follow->data[base + j] = 0.0;
+        }
+    }
+    follow->rows++;
+}
+
+/*
+    Implementation for importing incrementally a breakline-separated lines
+    and char-separated columns data file that is still being written.
+    Returns the number of rows appended to the state by this call, or -1 if
+    the file could not be read, in which case errno tells the reason. A
+    file that was truncated or replaced since the previous call, i.e., that
+    is smaller, has another inode, or no longer has the last parsed line
+    break at the same offset, is imported again from its start.
+
+    Parameters:
+    - file_path, path to the file.
+    - follow, state initialized with dfl_follow_init_impl_(), kept between
+    the calls for the same file.
+    - sep, column separator.
+    - cplx, whether the values are complex numbers.
+*/
+static inline int sepdat_follow_impl_(const char *file_path,
+    dfl_follow *follow, char sep, int cplx) {
+
+    follow->restarted = 0;
+
+    /* Detect truncation (smaller size) and replacement (other inode) */
+    struct stat info;
+    if (stat(file_path, &info) != 0) return -1;
+    long long size = (long long)info.st_size;
+    unsigned long long device = (unsigned long long)info.st_dev;
+    unsigned long long inode = (unsigned long long)info.st_ino;
+    if (follow->offset > 0 && (size < follow->size ||
+        device != follow->device || inode != follow->inode)) {
+        dfl_follow_destroy_impl_(follow);
+        follow->restarted = 1;
+    }
+    follow->device = device;
+    follow->inode = inode;
+
+    /* Nothing was appended */
+    if (size <= follow->offset) {
+        follow->size = size;
+        return 0;
+    }
+
+    /* Open file */
+    FILE *file = fopen(file_path, "rb");
+    if (!file) return -1;
+
+    /* A file rewritten in place to a larger size no longer has the line
+       break that ended the last parsed line */
+    if (follow->offset > 0 &&
+        (file_seek_impl_(file, follow->offset - 1) != 0 ||
+        fgetc(file) != '\n')) {
+        dfl_follow_destroy_impl_(follow);
+        follow->restarted = 1;
+        follow->device = device;
+        follow->inode = inode;
+    }
+
+    /* Go to the first byte not parsed yet */
+    if (file_seek_impl_(file, follow->offset) != 0) {
+        fclose(file);
+        return -1;
+    }
+
+    /* Read the appended bytes, which may keep growing while read */
+    size_t capacity = (size_t)(size - follow->offset) + 1;
+    size_t length = 0;
+    char *buffer = (char *)dfl_allocate_impl_(NULL, capacity + 1);
+    for (;;) {
+        length += fread(buffer + length, 1, capacity - length, file);
+        if (length < capacity) break;
+        capacity *= 2;
+        char *grown = (char *)realloc(buffer, capacity + 1);
+        if (grown == NULL) {
+            fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                            " sepdat_follow_impl_() ->"
+                            " Error in allocating memory."
+                            " Exiting.");
+            exit(EXIT_FAILURE);
+        }
+        buffer = grown;
+    }
+
+    /* Close file */
+    fclose(file);
+
+    /* Parse the complete lines only; a partial last line waits */
+    int rows = follow->rows;
+    size_t start = 0;
+    for (;;) {
+        char *newline = (char *)memchr(buffer + start, '\n', length - start);
+        if (newline == NULL) break;
+        size_t end = (size_t)(newline - buffer);
+        follow_append_line_impl_(follow, buffer + start, end - start, sep,
+            cplx);
+        start = end + 1;
+    }
+    free(buffer);
+
+    follow->offset += (long long)start;
+    follow->size = follow->offset + (long long)(length - start);
+    return follow->rows - rows;
+}
+
+#endif /* DATA_FILE_LIBRARY_FOLLOW_IMPL_H */
@@ -0,0 +1,693 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/fwfdat_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the imports and exports of fixed-width files,
+        i.e., files whose columns have given widths in characters and no
+        separators, as written by the formatted output of Fortran. As the
+        fields are at known positions, no separator is scanned, the digits
+        are converted eight at a time, and the rows are split in byte ranges
+        parsed by many threads.
+*/
+
+#ifndef DATA_FILE_LIBRARY_FWFDAT_IMPL_H
+#define DATA_FILE_LIBRARY_FWFDAT_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For EXIT_FAILURE */
+#include <string.h> /* For memchr(), memcpy(), memset() and strerror() */
+#include <errno.h> /* For errno */
+#include <math.h> /* For NAN */
+#include <stdint.h> /* For uint64_t */
+#include <sys/stat.h> /* For stat() */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "parse_impl_.h"
+#include "thread_impl_.h"
+#include "follow_impl_.h" /* For file_seek_impl_() */
+#include "lines_impl_.h"
+
+/* Smallest number of bytes of rows parsed by each thread */
+#define DFL_FWF_BYTES_PER_THREAD_IMPL_ ((long long)1 << 20)
+
+/*
+    Positions of the value fields of the lines of a fixed-width file.
+    - columns, number of value fields.
+    - offsets, offset of each value field in a line.
+    - widths, width of each value field.
+    - length, length of a whole line, with the skipped fields.
+*/
+typedef struct {
+    int columns;
+    size_t *offsets;
+    size_t *widths;
+    size_t length;
+} fwf_layout_impl_;
+
+/*
+    Byte range of a fixed-width file, whose lines are counted and then
+    parsed by one thread.
+*/
+typedef struct {
+    const char *file_path;
+    const fwf_layout_impl_ *layout;
+    long long begin;
+    long long end;
+    size_t lines;
+    size_t first_row;
+    double *data;
+    tpdfcplx_impl_ *data_cplx;
+    int status;
+} fwf_part_impl_;
+
+/*
+    Computes the positions of the value fields from the widths of the
+    fields, exiting with a warning if a width is zero or there is no value
+    field.
+
+    Parameters:
+    - layout, to output the positions, released with
+    fwf_layout_free_impl_().
+    - widths, one-dimensional int-type array of size count with the width
+    of each field, where a negative width -n skips n characters.
+    - count, number of fields.
+*/
+static inline void fwf_layout_init_impl_(fwf_layout_impl_ *layout,
+    const int *widths, int count) {
+
+    layout->columns = 0;
+    layout->length = 0;
+    for (int k = 0; k < count; k++) {
+        if (widths[k] == 0) {
+            layout->columns = 0;
+            break;
+        }
+        if (widths[k] > 0) layout->columns++;
+    }
+    if (layout->columns == 0) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " fwf_layout_init_impl_() ->"
+                        " Invalid widths of the fields."
+                        " Exiting.");
+        exit(EXIT_FAILURE);
+    }
+
+    layout->offsets = (size_t *)dfl_allocate_impl_(NULL,
+        (size_t)layout->columns * sizeof(size_t));
+    layout->widths = (size_t *)dfl_allocate_impl_(NULL,
+        (size_t)layout->columns * sizeof(size_t));
+    int column = 0;
+    for (int k = 0; k < count; k++) {
+        if (widths[k] > 0) {
+            layout->offsets[column] = layout->length;
+            layout->widths[column] = (size_t)widths[k];
+            column++;
+            layout->length += (size_t)widths[k];
+        } else {
+            layout->length += (size_t)(-(long long)widths[k]);
+        }
+    }
+}
+
+/*
+    Releases the positions of the value fields.
+*/
+static inline void fwf_layout_free_impl_(fwf_layout_impl_ *layout) {
+    free(layout->offsets);
+    free(layout->widths);
+}
+
+/*
+    Converts eight ASCII digits at once, within a 64-bit integer, i.e., by
+    SIMD within a register, which is portable to any compiler. Returns 1 if
+    the eight chars are digits, otherwise 0.
+
+    Parameters:
+    - p, the eight chars.
+    - value, to output the value of the digits.
+*/
+static inline int fwf_eight_digits_impl_(const char *p, uint64_t *value) {
+    uint64_t v = 0;
+    for (int k = 7; k >= 0; k--) v = (v << 8) | (unsigned char)p[k];
+
+    /* Every byte from 0x30 to 0x39 */
+    if (((v & 0xF0F0F0F0F0F0F0F0ULL) |
+        (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) !=
+        0x3333333333333333ULL) {
+        return 0;
+    }
+
+    /* Pairs, then groups of four, then the eight digits */
+    v -= 0x3030303030303030ULL;
+    v = v * 10 + (v >> 8);
+    v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+        (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+        32;
+    *value = v;
+    return 1;
+}
+
+/*
+    Accumulates the digits of a field to a mantissa, eight at a time while
+    possible. Returns the number of digits.
+
+    Parameters:
+    - p, the position of the digits, advanced past them.
+    - end, the end of the field.
+    - mantissa, the mantissa, which is meaningful only if the total number
+    of digits does not exceed 19.
+*/
+static inline int fwf_digits_impl_(const char **p, const char *end,
+    uint64_t *mantissa) {
+
+    int digits = 0;
+    uint64_t chunk;
+    while (end - *p >= 8 && fwf_eight_digits_impl_(*p, &chunk)) {
+        *mantissa = *mantissa * 100000000ULL + chunk;
+        digits += 8;
+        *p += 8;
+    }
+    while (*p < end && **p >= '0' && **p <= '9') {
+        *mantissa = *mantissa * 10 + (uint64_t)(**p - '0');
+        digits++;
+        (*p)++;
+    }
+    return digits;
+}
+
+/*
+    Copies a field to a string in the form read by the parse_*_impl_()
+    functions, i.e., with the Fortran exponents dE, dD and the d+n and d-n
+    forms written without letter (for exponents of three digits) as de+n.
+    Returns the string, which is released with free() if it is not buffer.
+
+    Parameters:
+    - field, the field.
+    - width, the width of the field.
+    - buffer, buffer of size 128 for short fields.
+    - cplx, whether the field is a complex value a+bi, whose signs are
+    kept.
+*/
+static inline char *fwf_field_string_impl_(const char *field, size_t width,
+    char *buffer, int cplx) {
+
+    char *str = width + 2 <= 128 ? buffer :
+        (char *)dfl_allocate_impl_(NULL, width + 2);
+    size_t n = 0;
+    int exponent = 0;
+    for (size_t k = 0; k < width; k++) {
+        char ch = field[k];
+        if (ch == 'd' || ch == 'D') ch = 'e';
+        if (ch == 'e' || ch == 'E') exponent = 1;
+        if (!cplx && !exponent && (ch == '+' || ch == '-') && n > 0 &&
+            ((str[n - 1] >= '0' && str[n - 1] <= '9') ||
+            str[n - 1] == '.')) {
+            str[n++] = 'e';
+            exponent = 1;
+        }
+        str[n++] = ch;
+    }
+    str[n] = '\0';
+    return str;
+}
+
+/*
+    Parses a real field, with the digits converted eight at a time and a
+    single correctly rounded operation for numbers of up to 19 digits and
+    small exponents, as strtod_c_impl_(), and the Fortran exponents dE,
+    dD, d+n and d-n. Other numbers, infinities and not-a-numbers are parsed
+    by parse_real_checked_impl_(). Blank fields give NAN and are invalid.
+
+    Parameters:
+    - field, the field, which is not null-terminated.
+    - width, the width of the field.
+    - valid, to output 1 if the field is a number, otherwise 0.
+*/
+static inline double fwf_parse_real_impl_(const char *field, size_t width,
+    int *valid) {
+
+    const char *p = field;
+    const char *end = field + width;
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    while (end > p && (end[-1] == ' ' || end[-1] == '\t')) end--;
+    if (p == end) {
+        *valid = 0;
+        return NAN;
+    }
+
+    const char *q = p;
+    int negative = 0;
+    if (*q == '+' || *q == '-') {
+        negative = (*q == '-');
+        q++;
+    }
+    uint64_t mantissa = 0;
+    long exp10 = 0;
+    int digits = fwf_digits_impl_(&q, end, &mantissa);
+    if (q < end && *q == '.') {
+        q++;
+        int fraction = fwf_digits_impl_(&q, end, &mantissa);
+        digits += fraction;
+        exp10 -= fraction;
+    }
+
+    /* Exponent, whose letter is omitted for three digits in Fortran */
+    int fast = digits > 0;
+    if (fast && q < end) {
+        if (*q == 'e' || *q == 'E' || *q == 'd' || *q == 'D') q++;
+        int exp_negative = 0;
+        if (q < end && (*q == '+' || *q == '-')) {
+            exp_negative = (*q == '-');
+            q++;
+        }
+        long exp_value = 0;
+        const char *first = q;
+        while (q < end && *q >= '0' && *q <= '9' && exp_value < 100000) {
+            exp_value = 10*exp_value + (*q - '0');
+            q++;
+        }
+        fast = q > first;
+        exp10 += exp_negative ? -exp_value : exp_value;
+    }
+
+    if (fast && q == end && digits <= 19 &&
+        mantissa <= ((uint64_t)1 << 53) && exp10 >= -22 && exp10 <= 22) {
+        double value = (double)mantissa;
+        if (exp10 < 0) {
+            value /= exact_powers_of_ten_impl_[-exp10];
+        } else {
+            value *= exact_powers_of_ten_impl_[exp10];
+        }
+        *valid = 1;
+        return negative ? -value : value;
+    }
+
+    char buffer[128];
+    char *str = fwf_field_string_impl_(p, (size_t)(end - p), buffer, 0);
+    double value = parse_real_checked_impl_(str, valid);
+    if (str != buffer) free(str);
+    return value;
+}
+
+/*
+    Parses a complex field through parse_complex_checked_impl_(), with the
+    Fortran exponents dD. Fields not ended by an imaginary unit are parsed
+    by fwf_parse_real_impl_(). Blank fields give NAN and are invalid.
+
+    Parameters:
+    - field, the field, which is not null-terminated.
+    - width, the width of the field.
+    - valid, to output 1 if the field is a number, otherwise 0.
+*/
+static inline tpdfcplx_impl_ fwf_parse_cplx_impl_(const char *field,
+    size_t width, int *valid) {
+
+    size_t last = width;
+    while (last > 0 && (field[last - 1] == ' ' || field[last - 1] == '\t')) {
+        last--;
+    }
+    if (last == 0 || (field[last - 1] != 'i' && field[last - 1] != 'I' &&
+        field[last - 1] != 'j' && field[last - 1] != 'J')) {
+        double real = fwf_parse_real_impl_(field, width, valid);
+        return real + I_IMPL_ * 0.0;
+    }
+
+    char buffer[128];
+    char *str = fwf_field_string_impl_(field, width, buffer, 1);
+    tpdfcplx_impl_ value = parse_complex_checked_impl_(str, valid);
+    if (str != buffer) free(str);
+    return value;
+}
+
+/*
+    Thread of the first pass, which counts the lines that start in the byte
+    range of one part, i.e., the line breaks before its end that follow the
+    byte before its beginning.
+
+    Parameter:
+    - context, the fwf_part_impl_.
+*/
+static inline void *fwfdat_count_worker_impl_(void *context) {
+    fwf_part_impl_ *part = (fwf_part_impl_ *)context;
+    part->lines = part->begin == 0 ? 1 : 0;
+    long long start = part->begin > 0 ? part->begin - 1 : 0;
+    long long stop = part->end - 1;
+    if (start >= stop) return NULL;
+
+    FILE *file = fopen(part->file_path, "rb");
+    if (!file || file_seek_impl_(file, start) != 0) {
+        if (file) fclose(file);
+        part->status = errno != 0 ? errno : EIO;
+        return NULL;
+    }
+    size_t capacity = 1 << 16;
+    char *buffer = (char *)dfl_allocate_impl_(NULL, capacity);
+    while (start < stop) {
+        size_t n = stop - start < (long long)capacity ?
+            (size_t)(stop - start) : capacity;
+        n = fread(buffer, 1, n, file);
+        if (n == 0) break;
+        const char *p = buffer;
+        const char *end = buffer + n;
+        while ((p = (const char *)memchr(p, '\n', (size_t)(end - p))) !=
+            NULL) {
+            part->lines++;
+            p++;
+        }
+        start += (long long)n;
+    }
+    free(buffer);
+    fclose(file);
+    return NULL;
+}
+
+/*
+    Thread of the second pass, which parses the lines that start in the
+    byte range of one part, from the row first_row on. The fields beyond
+    the end of a line are parsed as blank ones, i.e., stored as NAN.
+
+    Parameter:
+    - context, the fwf_part_impl_.
+*/
+static inline void *fwfdat_parse_worker_impl_(void *context) {
+    fwf_part_impl_ *part = (fwf_part_impl_ *)context;
+    const fwf_layout_impl_ *layout = part->layout;
+    if (part->lines == 0) return NULL;
+
+    /* Open file, one byte before the range to find the first line */
+    long long start = part->begin > 0 ? part->begin - 1 : 0;
+    FILE *file = fopen(part->file_path, "rb");
+    if (!file || file_seek_impl_(file, start) != 0) {
+        if (file) fclose(file);
+        part->status = errno != 0 ? errno : EIO;
+        return NULL;
+    }
+    line_reader_impl_ reader;
+    line_reader_init_impl_(&reader, file, start);
+    long long offset;
+    char *line;
+    if (start < part->begin) line_reader_next_impl_(&reader, &offset);
+
+    size_t columns = (size_t)layout->columns;
+    size_t row = part->first_row;
+    for (size_t i = 0; i < part->lines &&
+        (line = line_reader_next_impl_(&reader, &offset)) != NULL; i++) {
+        size_t length = strlen(line);
+        for (size_t j = 0; j < columns; j++) {
+            size_t position = layout->offsets[j];
+            if (position > length) position = length;
+            size_t width = layout->widths[j];
+            if (width > length - position) width = length - position;
+            int valid;
+            if (part->data_cplx != NULL) {
+                part->data_cplx[row*columns + j] = fwf_parse_cplx_impl_(
+                    line + position, width, &valid);
+            } else {
+                part->data[row*columns + j] = fwf_parse_real_impl_(
+                    line + position, width, &valid);
+            }
+        }
+        row++;
+    }
+
+    free(reader.buffer);
+    fclose(file);
+    return NULL;
+}
+
+/*
+    Runs a worker for each part, the calling thread working on the first
+    part.
+
+    Parameters:
+    - parts, the parts.
+    - count, number of parts.
+    - worker, the worker.
+*/
+static inline void fwfdat_run_impl_(fwf_part_impl_ *parts, int count,
+    void *(*worker)(void *)) {
+
+    tpthread_impl_ *pool = NULL;
+    if (count > 1) {
+        pool = (tpthread_impl_ *)dfl_allocate_impl_(NULL,
+            (size_t)(count - 1) * sizeof(tpthread_impl_));
+        for (int t = 1; t < count; t++) {
+            thread_create_impl_(&pool[t - 1], worker, &parts[t]);
+        }
+    }
+    worker(&parts[0]);
+    for (int t = 1; t < count; t++) {
+        thread_join_impl_(pool[t - 1]);
+    }
+    free(pool);
+}
+
+/*
+    Exits with a warning if a part failed.
+*/
+static inline void fwfdat_check_parts_impl_(const fwf_part_impl_ *parts,
+    int count) {
+
+    for (int t = 0; t < count; t++) {
+        if (parts[t].status != 0) {
+            fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                            " fwfdat_check_parts_impl_() ->"
+                            " Error in opening file: %s."
+                            " Exiting.", strerror(parts[t].status));
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/*
+    Splits a fixed-width file in byte ranges of at least
+    DFL_FWF_BYTES_PER_THREAD_IMPL_ bytes, one per thread, and counts their
+    lines in parallel. Returns the parts, released with free(), and outputs
+    their number and the number of rows, exiting with a warning if the file
+    cannot be opened.
+
+    Parameters:
+    - file_path, path to the file.
+    - layout, positions of the value fields.
+    - threads, number of threads, where 0 selects the number of processors.
+    - count, to output the number of parts.
+    - rows, to output the number of rows.
+*/
+static inline fwf_part_impl_ *fwfdat_split_impl_(const char *file_path,
+    const fwf_layout_impl_ *layout, int threads, int *count, size_t *rows) {
+
+    struct stat info;
+    if (stat(file_path, &info) != 0) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " fwfdat_split_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    long long size = (long long)info.st_size;
+    if (threads <= 0) threads = hardware_threads_impl_();
+    if (size / DFL_FWF_BYTES_PER_THREAD_IMPL_ + 1 < threads) {
+        threads = (int)(size / DFL_FWF_BYTES_PER_THREAD_IMPL_ + 1);
+    }
+
+    fwf_part_impl_ *parts = (fwf_part_impl_ *)dfl_allocate_impl_(NULL,
+        (size_t)threads * sizeof(fwf_part_impl_));
+    memset(parts, 0, (size_t)threads * sizeof(fwf_part_impl_));
+    for (int t = 0; t < threads; t++) {
+        parts[t].file_path = file_path;
+        parts[t].layout = layout;
+        parts[t].begin = size * t / threads;
+        parts[t].end = size * (t + 1) / threads;
+    }
+    if (size > 0) {
+        fwfdat_run_impl_(parts, threads, fwfdat_count_worker_impl_);
+        fwfdat_check_parts_impl_(parts, threads);
+    } else {
+        parts[0].lines = 0;
+    }
+
+    *rows = 0;
+    for (int t = 0; t < threads; t++) {
+        parts[t].first_row = *rows;
+        *rows += parts[t].lines;
+    }
+    *count = threads;
+    return parts;
+}
+
+/*
+    Implementation for getting the number of rows and columns of a
+    fixed-width file.
+
+    Parameters:
+    - file_path, path to the file.
+    - rows, to output the number of rows.
+    - columns, to output the number of value fields.
+    - widths, one-dimensional int-type array of size count with the width
+    of each field, where a negative width skips characters.
+    - count, number of fields.
+*/
+static inline void fwfdat_get_sizes_impl_(const char *file_path, int *rows,
+    int *columns, const int *widths, int count) {
+
+    fwf_layout_impl_ layout;
+    fwf_layout_init_impl_(&layout, widths, count);
+    int parts_count;
+    size_t rows64;
+    free(fwfdat_split_impl_(file_path, &layout, 0, &parts_count, &rows64));
+    *rows = size_to_int_impl_(rows64, "fwfdat_get_sizes_impl_");
+    *columns = layout.columns;
+    fwf_layout_free_impl_(&layout);
+}
+
+/*
+    Implementation for importing a fixed-width file into an one-dimensional
+    array following the row-major order, the rows being parsed by many
+    threads. Fields that are not numbers, blank or beyond the end of a
+    line are stored as NAN.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array of size rows*columns for real values,
+    otherwise NULL.
+    - data_cplx, 'double complex'-type array of size rows*columns for
+    complex values, otherwise NULL.
+    - widths, one-dimensional int-type array of size count with the width
+    of each field, where a negative width skips characters.
+    - count, number of fields.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+static inline void fwfdat_import_impl_(const char *file_path, double *data,
+    tpdfcplx_impl_ *data_cplx, const int *widths, int count, int threads) {
+
+    fwf_layout_impl_ layout;
+    fwf_layout_init_impl_(&layout, widths, count);
+    int parts_count;
+    size_t rows;
+    fwf_part_impl_ *parts = fwfdat_split_impl_(file_path, &layout, threads,
+        &parts_count, &rows);
+    for (int t = 0; t < parts_count; t++) {
+        parts[t].data = data;
+        parts[t].data_cplx = data_cplx;
+    }
+    fwfdat_run_impl_(parts, parts_count, fwfdat_parse_worker_impl_);
+    fwfdat_check_parts_impl_(parts, parts_count);
+    free(parts);
+    fwf_layout_free_impl_(&layout);
+}
+
+/*
+    Writes a value right-aligned in a field, with as many significant
+    digits (up to 17) as fit in its width, in the shortest of the fixed and
+    exponential forms, or asterisks if it does not fit, as Fortran does.
+
+    Parameters:
+    - output, the output, of size width.
+    - width, width of the field.
+    - re, the value, or its real part.
+    - im, the imaginary part.
+    - cplx, whether the value is complex, written as a+bi.
+*/
+static inline void fwf_format_field_impl_(char *output, size_t width,
+    double re, double im, int cplx) {
+
+    char buf_re[64], buf_im[64];
+    int precision = 17;
+    size_t length;
+    for (;;) {
+        length = (size_t)format_real_g_impl_(buf_re, sizeof(buf_re), re,
+            precision);
+        if (cplx) {
+            length += (size_t)format_real_g_impl_(buf_im, sizeof(buf_im),
+                im, precision) + (buf_im[0] != '-' ? 2 : 1);
+        }
+        if (length <= width || precision == 1) break;
+
+        /* Each digit less shortens the output by about one char per part */
+        int excess = (int)(length - width);
+        if (cplx) excess = (excess + 1) / 2;
+        precision = precision > excess ? precision - excess : 1;
+    }
+
+    if (length > width) {
+        memset(output, '*', width);
+        return;
+    }
+    memset(output, ' ', width - length);
+    char *p = output + (width - length);
+    size_t n = strlen(buf_re);
+    memcpy(p, buf_re, n);
+    if (cplx) {
+        p += n;
+        if (buf_im[0] != '-') *p++ = '+';
+        n = strlen(buf_im);
+        memcpy(p, buf_im, n);
+        p[n] = 'i';
+    }
+}
+
+/*
+    Implementation for exporting an one-dimensional array, following the
+    row-major order, to a fixed-width file, each value right-aligned in its
+    field, and the skipped fields filled with blanks.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array of size rows*columns for real values,
+    otherwise NULL.
+    - data_cplx, 'double complex'-type array of size rows*columns for
+    complex values, otherwise NULL.
+    - rows, number of rows.
+    - widths, one-dimensional int-type array of size count with the width
+    of each field, where a negative width skips characters.
+    - count, number of fields, whose positive widths give the columns.
+*/
+static inline void fwfdat_export_impl_(const char *file_path,
+    const double *data, const tpdfcplx_impl_ *data_cplx, size_t rows,
+    const int *widths, int count) {
+
+    fwf_layout_impl_ layout;
+    fwf_layout_init_impl_(&layout, widths, count);
+
+    /* Open file */
+    FILE *file = fopen(file_path, "w");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " fwfdat_export_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    size_t columns = (size_t)layout.columns;
+    char *line = (char *)dfl_allocate_impl_(NULL, layout.length + 2);
+    memset(line, ' ', layout.length);
+    line[layout.length] = '\n';
+    line[layout.length + 1] = '\0';
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < columns; j++) {
+            if (data_cplx != NULL) {
+                fwf_format_field_impl_(line + layout.offsets[j],
+                    layout.widths[j], creal_impl_(data_cplx[i*columns + j]),
+                    cimag_impl_(data_cplx[i*columns + j]), 1);
+            } else {
+                fwf_format_field_impl_(line + layout.offsets[j],
+                    layout.widths[j], data[i*columns + j], 0.0, 0);
+            }
+        }
+        fwrite(line, 1, layout.length + 1, file);
+    }
+    free(line);
+
+    /* Close file */
+    fclose(file);
+    fwf_layout_free_impl_(&layout);
+}
+
+#endif /* DATA_FILE_LIBRARY_FWFDAT_IMPL_H */
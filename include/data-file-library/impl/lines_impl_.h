@@ -0,0 +1,105 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/lines_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of a reader of the lines of a file through a buffer
+        that grows as needed, which also gives the byte offset of each line,
+        so that byte ranges of a file may be parsed line by line.
+*/
+
+#ifndef DATA_FILE_LIBRARY_LINES_IMPL_H
+#define DATA_FILE_LIBRARY_LINES_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For free() */
+#include <string.h> /* For memchr(), memcpy() and memmove() */
+#include "alloc_impl_.h"
+
+/*
+    Reader of the lines of a file through a buffer.
+*/
+typedef struct {
+    FILE *file;
+    char *buffer;
+    size_t capacity;
+    size_t filled;
+    size_t pos;
+    long long base;
+    int eof;
+} line_reader_impl_;
+
+/*
+    Starts a reader at an offset of a file.
+
+    Parameters:
+    - reader, the reader.
+    - file, the file, positioned at offset.
+    - offset, byte offset of the file.
+*/
+static inline void line_reader_init_impl_(line_reader_impl_ *reader,
+    FILE *file, long long offset) {
+
+    reader->file = file;
+    reader->capacity = 1 << 16;
+    reader->buffer = (char *)dfl_allocate_impl_(NULL, reader->capacity + 1);
+    reader->filled = 0;
+    reader->pos = 0;
+    reader->base = offset;
+    reader->eof = 0;
+}
+
+/*
+    Returns the next line of a reader, without its line break, or NULL at
+    the end of the file. The line remains valid until the next call.
+
+    Parameters:
+    - reader, the reader.
+    - offset, to output the byte offset of the start of the line.
+*/
+static inline char *line_reader_next_impl_(line_reader_impl_ *reader,
+    long long *offset) {
+
+    for (;;) {
+        char *start = reader->buffer + reader->pos;
+        size_t available = reader->filled - reader->pos;
+        char *nl = (char *)memchr(start, '\n', available);
+        if (nl != NULL || (reader->eof && available > 0)) {
+            size_t next = nl != NULL ? (size_t)(nl - reader->buffer) + 1 :
+                reader->filled;
+            if (nl == NULL) nl = reader->buffer + reader->filled;
+            *nl = '\0';
+            if (nl > start && nl[-1] == '\r') nl[-1] = '\0';
+            *offset = reader->base + (long long)reader->pos;
+            reader->pos = next;
+            return start;
+        }
+        if (reader->eof) return NULL;
+
+        /* Keep the partial line, growing the buffer if it fills it */
+        if (reader->pos > 0) {
+            memmove(reader->buffer, start, available);
+            reader->base += (long long)reader->pos;
+            reader->pos = 0;
+            reader->filled = available;
+        } else if (reader->filled == reader->capacity) {
+            char *grown = (char *)dfl_allocate_impl_(NULL,
+                2*reader->capacity + 1);
+            memcpy(grown, reader->buffer, reader->filled);
+            free(reader->buffer);
+            reader->buffer = grown;
+            reader->capacity *= 2;
+        }
+        size_t n = fread(reader->buffer + reader->filled, 1,
+            reader->capacity - reader->filled, reader->file);
+        if (n == 0) reader->eof = 1;
+        reader->filled += n;
+    }
+}
+
+#endif /* DATA_FILE_LIBRARY_LINES_IMPL_H */
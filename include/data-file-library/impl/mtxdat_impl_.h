@@ -0,0 +1,748 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/mtxdat_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the imports and exports of Matrix Market files
+        (.mtx), in the coordinate and array layouts, of real, integer,
+        complex and pattern values, with general, symmetric,
+        skew-symmetric and Hermitian symmetry. The entries of the
+        coordinate layout are split in byte ranges aligned to the lines,
+        each parsed by a thread, and then stored in the order of the file.
+*/
+
+#ifndef DATA_FILE_LIBRARY_MTXDAT_IMPL_H
+#define DATA_FILE_LIBRARY_MTXDAT_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For strtoll() and EXIT_FAILURE */
+#include <string.h> /* For memchr(), memmove(), memset() and strerror() */
+#include <errno.h> /* For errno */
+#include <limits.h> /* For INT_MAX */
+#include <sys/stat.h> /* For stat() */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "parse_impl_.h"
+#include "thread_impl_.h"
+#include "follow_impl_.h" /* For file_seek_impl_() */
+#include "lines_impl_.h"
+#include "sparse_impl_.h"
+
+/* Fields of the values of a Matrix Market file */
+#define DFL_MTX_REAL_IMPL_ 0
+#define DFL_MTX_INTEGER_IMPL_ 1
+#define DFL_MTX_COMPLEX_IMPL_ 2
+#define DFL_MTX_PATTERN_IMPL_ 3
+
+/* Symmetries of a Matrix Market file */
+#define DFL_MTX_GENERAL_IMPL_ 0
+#define DFL_MTX_SYMMETRIC_IMPL_ 1
+#define DFL_MTX_SKEW_IMPL_ 2
+#define DFL_MTX_HERMITIAN_IMPL_ 3
+
+/* Smallest number of bytes of entries parsed by each thread */
+#define DFL_MTX_BYTES_PER_THREAD_IMPL_ ((long long)1 << 20)
+
+/*
+    Header of a Matrix Market file.
+    - coordinate, 1 for the coordinate layout, 0 for the array layout.
+    - field, one of the DFL_MTX_*_IMPL_ fields.
+    - symmetry, one of the DFL_MTX_*_IMPL_ symmetries.
+    - rows, columns, sizes of the matrix.
+    - count, number of entries of the coordinate layout.
+    - offset, byte offset of the first entry.
+    - size, size of the file in bytes.
+*/
+typedef struct {
+    int coordinate;
+    int field;
+    int symmetry;
+    long long rows;
+    long long columns;
+    long long count;
+    long long offset;
+    long long size;
+} mtx_header_impl_;
+
+/*
+    Entries of a byte range of a coordinate layout, parsed by one thread.
+*/
+typedef struct {
+    const char *file_path;
+    const mtx_header_impl_ *header;
+    long long begin;
+    long long end;
+    long long count;
+    long long capacity;
+    int *indices;
+    double *values;
+    int status;
+} mtx_part_impl_;
+
+/*
+    Returns 1 if a word equals a lowercase word, ignoring the ASCII case,
+    and advances it past the word, otherwise 0.
+*/
+static inline int mtx_word_impl_(char **p, const char *word) {
+    while (**p == ' ' || **p == '\t') (*p)++;
+    int n = ascii_prefix_ci_impl_(*p, word);
+    if (n == 0 || ((*p)[n] != '\0' && (*p)[n] != ' ' && (*p)[n] != '\t')) {
+        return 0;
+    }
+    *p += n;
+    return 1;
+}
+
+/*
+    Reads the header of a Matrix Market file, i.e., the banner, the
+    comments and the sizes. Returns 0, or EINVAL if it is not a supported
+    Matrix Market file.
+
+    Parameters:
+    - reader, a reader at the start of the file.
+    - header, to output the header.
+*/
+static inline int mtxdat_read_header_impl_(line_reader_impl_ *reader,
+    mtx_header_impl_ *header) {
+
+    long long offset;
+    char *line = line_reader_next_impl_(reader, &offset);
+    if (line == NULL || strncmp(line, "%%MatrixMarket", 14) != 0) {
+        return EINVAL;
+    }
+    char *p = line + 14;
+    if (!mtx_word_impl_(&p, "matrix")) return EINVAL;
+    if (mtx_word_impl_(&p, "coordinate")) {
+        header->coordinate = 1;
+    } else if (mtx_word_impl_(&p, "array")) {
+        header->coordinate = 0;
+    } else {
+        return EINVAL;
+    }
+    if (mtx_word_impl_(&p, "real") || mtx_word_impl_(&p, "double")) {
+        header->field = DFL_MTX_REAL_IMPL_;
+    } else if (mtx_word_impl_(&p, "integer")) {
+        header->field = DFL_MTX_INTEGER_IMPL_;
+    } else if (mtx_word_impl_(&p, "complex")) {
+        header->field = DFL_MTX_COMPLEX_IMPL_;
+    } else if (header->coordinate && mtx_word_impl_(&p, "pattern")) {
+        header->field = DFL_MTX_PATTERN_IMPL_;
+    } else {
+        return EINVAL;
+    }
+    if (mtx_word_impl_(&p, "general")) {
+        header->symmetry = DFL_MTX_GENERAL_IMPL_;
+    } else if (mtx_word_impl_(&p, "symmetric")) {
+        header->symmetry = DFL_MTX_SYMMETRIC_IMPL_;
+    } else if (mtx_word_impl_(&p, "skew-symmetric")) {
+        header->symmetry = DFL_MTX_SKEW_IMPL_;
+    } else if (header->field == DFL_MTX_COMPLEX_IMPL_ &&
+        mtx_word_impl_(&p, "hermitian")) {
+        header->symmetry = DFL_MTX_HERMITIAN_IMPL_;
+    } else {
+        return EINVAL;
+    }
+
+    /* Comments and blank lines, then the sizes */
+    do {
+        line = line_reader_next_impl_(reader, &offset);
+        if (line == NULL) return EINVAL;
+        p = line;
+        while (*p == ' ' || *p == '\t') p++;
+    } while (*p == '%' || *p == '\0');
+    char *end;
+    header->rows = strtoll(p, &end, 10);
+    if (end == p) return EINVAL;
+    p = end;
+    header->columns = strtoll(p, &end, 10);
+    if (end == p) return EINVAL;
+    p = end;
+    header->count = header->coordinate ? strtoll(p, &end, 10) :
+        header->rows * header->columns;
+    if ((header->coordinate && end == p) || header->rows < 0 ||
+        header->columns < 0 || header->count < 0 ||
+        header->rows > INT_MAX || header->columns > INT_MAX ||
+        (header->symmetry != DFL_MTX_GENERAL_IMPL_ &&
+        header->rows != header->columns)) {
+        return EINVAL;
+    }
+    header->offset = reader->base + (long long)reader->pos;
+    return 0;
+}
+
+/*
+    Implementation for reading the header of a Matrix Market file, exiting
+    with a warning if the file cannot be opened or is not a supported
+    Matrix Market file. Returns the status, if exiting is not requested.
+
+    Parameters:
+    - file_path, path to the file.
+    - header, to output the header.
+    - exit_on_error, whether to exit on failure.
+*/
+static inline int mtxdat_open_impl_(const char *file_path,
+    mtx_header_impl_ *header, int exit_on_error) {
+
+    memset(header, 0, sizeof(mtx_header_impl_));
+    struct stat info;
+    FILE *file = stat(file_path, &info) == 0 ? fopen(file_path, "rb") : NULL;
+    int status = file ? 0 : (errno != 0 ? errno : EIO);
+    if (file) {
+        header->size = (long long)info.st_size;
+        line_reader_impl_ reader;
+        line_reader_init_impl_(&reader, file, 0);
+        status = mtxdat_read_header_impl_(&reader, header);
+        free(reader.buffer);
+        fclose(file);
+    }
+    if (status != 0 && exit_on_error) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " mtxdat_open_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", status == EINVAL ?
+                        "Not a supported Matrix Market file" :
+                        strerror(status));
+        exit(EXIT_FAILURE);
+    }
+    return status;
+}
+
+/*
+    Parses the values of an entry, i.e., 1 for pattern entries, otherwise
+    the real value or the real and imaginary parts. Returns the position
+    after them, or NULL if they are invalid.
+
+    Parameters:
+    - p, the text of the values.
+    - field, the field of the file.
+    - value, array of 2 doubles to output the value.
+*/
+static inline char *mtx_parse_value_impl_(char *p, int field,
+    double *value) {
+
+    char *end;
+    value[0] = 1.0;
+    value[1] = 0.0;
+    if (field == DFL_MTX_PATTERN_IMPL_) return p;
+    value[0] = strtod_c_impl_(p, &end);
+    if (end == p) return NULL;
+    if (field != DFL_MTX_COMPLEX_IMPL_) return end;
+    p = end;
+    value[1] = strtod_c_impl_(p, &end);
+    return end == p ? NULL : end;
+}
+
+/*
+    Thread of a parallel parse, which parses the entries of the lines that
+    start in the byte range of one part.
+
+    Parameter:
+    - context, the mtx_part_impl_.
+*/
+static inline void *mtxdat_part_worker_impl_(void *context) {
+    mtx_part_impl_ *part = (mtx_part_impl_ *)context;
+    const mtx_header_impl_ *header = part->header;
+    if (part->begin >= part->end) return NULL;
+
+    /* Open file, one byte before the range to find the first line */
+    long long start = part->begin > header->offset ? part->begin - 1 :
+        part->begin;
+    FILE *file = fopen(part->file_path, "rb");
+    if (!file || file_seek_impl_(file, start) != 0) {
+        if (file) fclose(file);
+        part->status = errno != 0 ? errno : EIO;
+        return NULL;
+    }
+    line_reader_impl_ reader;
+    line_reader_init_impl_(&reader, file, start);
+    long long offset;
+    char *line;
+    if (start < part->begin) line_reader_next_impl_(&reader, &offset);
+
+    while ((line = line_reader_next_impl_(&reader, &offset)) != NULL &&
+        offset < part->end) {
+        char *p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '\0' || *p == '%') continue;
+
+        char *end;
+        double value[2];
+        long long i = strtoll(p, &end, 10);
+        long long j = end != p ? strtoll(end, &p, 10) : 0;
+        if (end == p || i < 1 || i > header->rows || j < 1 ||
+            j > header->columns ||
+            mtx_parse_value_impl_(p, header->field, value) == NULL) {
+            part->status = EINVAL;
+            break;
+        }
+
+        if (part->count == part->capacity) {
+            long long capacity = part->capacity > 0 ?
+                2*part->capacity : 4096;
+            int *indices = (int *)dfl_allocate_impl_(NULL,
+                (size_t)capacity * 2 * sizeof(int));
+            double *values = (double *)dfl_allocate_impl_(NULL,
+                (size_t)capacity * 2 * sizeof(double));
+            if (part->count > 0) {
+                memcpy(indices, part->indices,
+                    (size_t)part->count * 2 * sizeof(int));
+                memcpy(values, part->values,
+                    (size_t)part->count * 2 * sizeof(double));
+            }
+            free(part->indices);
+            free(part->values);
+            part->indices = indices;
+            part->values = values;
+            part->capacity = capacity;
+        }
+        part->indices[2*part->count] = (int)(i - 1);
+        part->indices[2*part->count + 1] = (int)(j - 1);
+        part->values[2*part->count] = value[0];
+        part->values[2*part->count + 1] = value[1];
+        part->count++;
+    }
+
+    free(reader.buffer);
+    fclose(file);
+    return NULL;
+}
+
+/*
+    Parses the entries of a coordinate layout with a pool of threads, one
+    per byte range of at least DFL_MTX_BYTES_PER_THREAD_IMPL_ bytes.
+    Returns the parts, in the order of the file, to be released with
+    mtxdat_free_parts_impl_(), and outputs their number.
+
+    Parameters:
+    - file_path, path to the file.
+    - header, the header of the file.
+    - count, to output the number of parts.
+*/
+static inline mtx_part_impl_ *mtxdat_parse_parts_impl_(
+    const char *file_path, const mtx_header_impl_ *header, int *count) {
+
+    long long bytes = header->size - header->offset;
+    int threads = hardware_threads_impl_();
+    if (bytes / DFL_MTX_BYTES_PER_THREAD_IMPL_ + 1 < threads) {
+        threads = (int)(bytes / DFL_MTX_BYTES_PER_THREAD_IMPL_ + 1);
+    }
+    if (threads < 1) threads = 1;
+
+    mtx_part_impl_ *parts = (mtx_part_impl_ *)dfl_allocate_impl_(NULL,
+        (size_t)threads * sizeof(mtx_part_impl_));
+    memset(parts, 0, (size_t)threads * sizeof(mtx_part_impl_));
+    for (int t = 0; t < threads; t++) {
+        parts[t].file_path = file_path;
+        parts[t].header = header;
+        parts[t].begin = header->offset + bytes * t / threads;
+        parts[t].end = header->offset + bytes * (t + 1) / threads;
+    }
+
+    /* The calling thread parses the first part */
+    tpthread_impl_ *pool = NULL;
+    if (threads > 1) {
+        pool = (tpthread_impl_ *)dfl_allocate_impl_(NULL,
+            (size_t)(threads - 1) * sizeof(tpthread_impl_));
+        for (int t = 1; t < threads; t++) {
+            thread_create_impl_(&pool[t - 1], mtxdat_part_worker_impl_,
+                &parts[t]);
+        }
+    }
+    mtxdat_part_worker_impl_(&parts[0]);
+    for (int t = 1; t < threads; t++) {
+        thread_join_impl_(pool[t - 1]);
+    }
+    free(pool);
+
+    *count = threads;
+    return parts;
+}
+
+/*
+    Releases the parts of a parallel parse.
+*/
+static inline void mtxdat_free_parts_impl_(mtx_part_impl_ *parts,
+    int count) {
+
+    for (int t = 0; t < count; t++) {
+        free(parts[t].indices);
+        free(parts[t].values);
+    }
+    free(parts);
+}
+
+/*
+    Returns the status of the parts of a parallel parse, i.e., that of the
+    first part that failed, or EINVAL if the number of entries differs from
+    the header.
+*/
+static inline int mtxdat_parts_status_impl_(const mtx_part_impl_ *parts,
+    int count, const mtx_header_impl_ *header) {
+
+    long long entries = 0;
+    for (int t = 0; t < count; t++) {
+        if (parts[t].status != 0) return parts[t].status;
+        entries += parts[t].count;
+    }
+    return entries == header->count ? 0 : EINVAL;
+}
+
+/*
+    Returns the value of the mirror of an entry of a symmetric,
+    skew-symmetric or Hermitian matrix, as two doubles.
+*/
+static inline void mtx_mirror_impl_(int symmetry, const double *value,
+    double *mirror) {
+
+    mirror[0] = symmetry == DFL_MTX_SKEW_IMPL_ ? -value[0] : value[0];
+    mirror[1] = symmetry == DFL_MTX_SKEW_IMPL_ ? -value[1] :
+        symmetry == DFL_MTX_HERMITIAN_IMPL_ ? -value[1] : value[1];
+}
+
+/*
+    Implementation for importing a Matrix Market file into an
+    one-dimensional array following the row-major order. The entries of
+    the coordinate layout are parsed in parallel, and repeated entries are
+    summed. The mirrored entries of symmetric, skew-symmetric and Hermitian
+    matrices are stored too. Exits with a warning if the file cannot be
+    opened or is not a valid Matrix Market file.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array of size rows*columns for real values (the
+    real parts of complex files), otherwise NULL.
+    - data_cplx, 'double complex'-type array of size rows*columns for
+    complex values, otherwise NULL.
+*/
+static inline void mtxdat_import_impl_(const char *file_path, double *data,
+    tpdfcplx_impl_ *data_cplx) {
+
+    mtx_header_impl_ header;
+    mtxdat_open_impl_(file_path, &header, 1);
+    size_t columns = (size_t)header.columns;
+    size_t total = (size_t)header.rows * columns;
+    int status = 0;
+
+    if (header.coordinate) {
+        int count;
+        mtx_part_impl_ *parts = mtxdat_parse_parts_impl_(file_path, &header,
+            &count);
+        status = mtxdat_parts_status_impl_(parts, count, &header);
+        if (status == 0) {
+            for (size_t k = 0; k < total; k++) {
+                if (data_cplx != NULL) {
+                    data_cplx[k] = 0.0;
+                } else {
+                    data[k] = 0.0;
+                }
+            }
+        }
+
+        /* Store the entries in the order of the file */
+        for (int t = 0; status == 0 && t < count; t++) {
+            for (long long e = 0; e < parts[t].count; e++) {
+                size_t i = (size_t)parts[t].indices[2*e];
+                size_t j = (size_t)parts[t].indices[2*e + 1];
+                const double *value = parts[t].values + 2*e;
+                double mirror[2];
+                mtx_mirror_impl_(header.symmetry, value, mirror);
+                int mirrored = header.symmetry != DFL_MTX_GENERAL_IMPL_ &&
+                    i != j;
+                if (data_cplx != NULL) {
+                    data_cplx[i*columns + j] += value[0] +
+                        I_IMPL_ * value[1];
+                    if (mirrored) {
+                        data_cplx[j*columns + i] += mirror[0] +
+                            I_IMPL_ * mirror[1];
+                    }
+                } else {
+                    data[i*columns + j] += value[0];
+                    if (mirrored) data[j*columns + i] += mirror[0];
+                }
+            }
+        }
+        mtxdat_free_parts_impl_(parts, count);
+    } else {
+        /* Array layout, following the column-major order, of the lower
+           triangle for symmetric matrices, without the diagonal for
+           skew-symmetric ones */
+        FILE *file = fopen(file_path, "rb");
+        if (!file || file_seek_impl_(file, header.offset) != 0) {
+            fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                            " mtxdat_import_impl_() ->"
+                            " Error in opening file: %s."
+                            " Exiting.", strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+        line_reader_impl_ reader;
+        line_reader_init_impl_(&reader, file, header.offset);
+        size_t rows = (size_t)header.rows;
+        size_t i = 0;
+        size_t j = 0;
+        if (header.symmetry == DFL_MTX_SKEW_IMPL_) {
+            for (size_t d = 0; d < rows; d++) {
+                if (data_cplx != NULL) {
+                    data_cplx[d*columns + d] = 0.0;
+                } else {
+                    data[d*columns + d] = 0.0;
+                }
+            }
+            i = 1;
+        }
+        if (i >= rows) j = columns;
+        long long offset;
+        char *line;
+        while (j < columns && (line = line_reader_next_impl_(&reader,
+            &offset)) != NULL) {
+            char *p = line;
+            while (*p == ' ' || *p == '\t') p++;
+            if (*p == '\0' || *p == '%') continue;
+            double value[2];
+            if (i >= rows ||
+                mtx_parse_value_impl_(p, header.field, value) == NULL) {
+                status = EINVAL;
+                break;
+            }
+            double mirror[2];
+            mtx_mirror_impl_(header.symmetry, value, mirror);
+            int mirrored = header.symmetry != DFL_MTX_GENERAL_IMPL_ &&
+                i != j;
+            if (data_cplx != NULL) {
+                data_cplx[i*columns + j] = value[0] + I_IMPL_ * value[1];
+                if (mirrored) {
+                    data_cplx[j*columns + i] = mirror[0] +
+                        I_IMPL_ * mirror[1];
+                }
+            } else {
+                data[i*columns + j] = value[0];
+                if (mirrored) data[j*columns + i] = mirror[0];
+            }
+            if (++i == rows) {
+                j++;
+                i = header.symmetry == DFL_MTX_GENERAL_IMPL_ ? 0 :
+                    header.symmetry == DFL_MTX_SKEW_IMPL_ ? j + 1 : j;
+                if (i >= rows && header.symmetry != DFL_MTX_GENERAL_IMPL_) {
+                    j = columns;
+                }
+            }
+        }
+        if (status == 0 && j < columns) status = EINVAL;
+        free(reader.buffer);
+        fclose(file);
+    }
+
+    if (status != 0) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " mtxdat_import_impl_() ->"
+                        " Error in reading file: %s."
+                        " Exiting.", status == EINVAL ?
+                        "Invalid Matrix Market entries" : strerror(status));
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*
+    Implementation for importing a Matrix Market file in the coordinate
+    layout into a sparse array in the coordinate form, without storing the
+    dense matrix. The entries are parsed in parallel and kept in the order
+    of the file, each followed by its mirror for symmetric, skew-symmetric
+    and Hermitian matrices. Returns 0 on success, the errno of the failure
+    to open the file, or EINVAL if it is not a valid Matrix Market file in
+    the coordinate layout.
+
+    Parameters:
+    - file_path, path to the file.
+    - sparse, to output the sparse array, whose arrays are allocated by the
+    library and released with dfl_sparse_free().
+    - allocator, allocator of the arrays, or NULL for malloc().
+    - cplx, whether the values are complex numbers.
+*/
+static inline int mtxdat_import_sparse_impl_(const char *file_path,
+    dfl_sparse *sparse, const dfl_allocator *allocator, int cplx) {
+
+    memset(sparse, 0, sizeof(dfl_sparse));
+    mtx_header_impl_ header;
+    int status = mtxdat_open_impl_(file_path, &header, 0);
+    if (status != 0) return status;
+    if (!header.coordinate) return EINVAL;
+
+    int count;
+    mtx_part_impl_ *parts = mtxdat_parse_parts_impl_(file_path, &header,
+        &count);
+    status = mtxdat_parts_status_impl_(parts, count, &header);
+    if (status != 0) {
+        mtxdat_free_parts_impl_(parts, count);
+        return status;
+    }
+
+    /* Number of values, with the mirrors */
+    size_t entries = 0;
+    for (int t = 0; t < count; t++) {
+        for (long long e = 0; e < parts[t].count; e++) {
+            entries += header.symmetry != DFL_MTX_GENERAL_IMPL_ &&
+                parts[t].indices[2*e] != parts[t].indices[2*e + 1] ? 2 : 1;
+        }
+    }
+
+    sparse->dimensions = 2;
+    sparse->count = (long long)entries;
+    sparse->size = (int *)dfl_allocate_impl_(allocator, 2*sizeof(int));
+    sparse->size[0] = (int)header.rows;
+    sparse->size[1] = (int)header.columns;
+    sparse->indices = (int *)dfl_allocate_impl_(allocator,
+        entries * 2 * sizeof(int));
+    if (cplx) {
+        sparse->values_cplx = (tpdfcplx_impl_ *)dfl_allocate_impl_(allocator,
+            entries * sizeof(tpdfcplx_impl_));
+    } else {
+        sparse->values = (double *)dfl_allocate_impl_(allocator,
+            entries * sizeof(double));
+    }
+
+    size_t k = 0;
+    for (int t = 0; t < count; t++) {
+        for (long long e = 0; e < parts[t].count; e++) {
+            int i = parts[t].indices[2*e];
+            int j = parts[t].indices[2*e + 1];
+            const double *value = parts[t].values + 2*e;
+            double mirror[2];
+            mtx_mirror_impl_(header.symmetry, value, mirror);
+            for (int m = 0; m < 2; m++) {
+                if (m == 1 && (header.symmetry == DFL_MTX_GENERAL_IMPL_ ||
+                    i == j)) {
+                    break;
+                }
+                const double *v = m == 0 ? value : mirror;
+                sparse->indices[2*k] = m == 0 ? i : j;
+                sparse->indices[2*k + 1] = m == 0 ? j : i;
+                if (cplx) {
+                    sparse->values_cplx[k] = v[0] + I_IMPL_ * v[1];
+                } else {
+                    sparse->values[k] = v[0];
+                }
+                k++;
+            }
+        }
+    }
+    mtxdat_free_parts_impl_(parts, count);
+    return 0;
+}
+
+/*
+    Implementation for exporting an one-dimensional array, following the
+    row-major order, to a Matrix Market file in the array layout with
+    general symmetry.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array of size rows*columns for real values,
+    otherwise NULL.
+    - data_cplx, 'double complex'-type array of size rows*columns for
+    complex values, otherwise NULL.
+    - rows, number of rows.
+    - columns, number of columns.
+*/
+static inline void mtxdat_export_impl_(const char *file_path,
+    const double *data, const tpdfcplx_impl_ *data_cplx, size_t rows,
+    size_t columns) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "w");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " mtxdat_export_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(file, "%%%%MatrixMarket matrix array %s general\n",
+        data_cplx != NULL ? "complex" : "real");
+    fprintf(file, "%llu %llu\n", (unsigned long long)rows,
+        (unsigned long long)columns);
+
+    /* Column-major order */
+    char buf_re[64], buf_im[64];
+    for (size_t j = 0; j < columns; j++) {
+        for (size_t i = 0; i < rows; i++) {
+            if (data_cplx != NULL) {
+                format_real_impl_(buf_re, sizeof(buf_re),
+                    creal_impl_(data_cplx[i*columns + j]));
+                format_real_impl_(buf_im, sizeof(buf_im),
+                    cimag_impl_(data_cplx[i*columns + j]));
+                fprintf(file, "%s %s\n", buf_re, buf_im);
+            } else {
+                format_real_impl_(buf_re, sizeof(buf_re),
+                    data[i*columns + j]);
+                fprintf(file, "%s\n", buf_re);
+            }
+        }
+    }
+
+    /* Close file */
+    fclose(file);
+}
+
+/*
+    Implementation for exporting a two-dimensional sparse array in the
+    coordinate form to a Matrix Market file in the coordinate layout with
+    general symmetry, in the order of its values. Exits with a warning if
+    the array is not two-dimensional.
+
+    Parameters:
+    - file_path, path to the file.
+    - sparse, the sparse array, whose values or values_cplx are written.
+    - cplx, whether the values are complex numbers.
+*/
+static inline void mtxdat_export_sparse_impl_(const char *file_path,
+    const dfl_sparse *sparse, int cplx) {
+
+    if (sparse->dimensions != 2) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " mtxdat_export_sparse_impl_() ->"
+                        " Not a two-dimensional sparse array."
+                        " Exiting.");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Open file */
+    FILE *file = fopen(file_path, "w");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " mtxdat_export_sparse_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(file, "%%%%MatrixMarket matrix coordinate %s general\n",
+        cplx ? "complex" : "real");
+    fprintf(file, "%d %d %lld\n", sparse->size[0], sparse->size[1],
+        sparse->count);
+
+    char buf_re[64], buf_im[64];
+    for (long long k = 0; k < sparse->count; k++) {
+        int i = sparse->indices[2*k] + 1;
+        int j = sparse->indices[2*k + 1] + 1;
+        if (cplx) {
+            format_real_impl_(buf_re, sizeof(buf_re),
+                creal_impl_(sparse->values_cplx[k]));
+            format_real_impl_(buf_im, sizeof(buf_im),
+                cimag_impl_(sparse->values_cplx[k]));
+            fprintf(file, "%d %d %s %s\n", i, j, buf_re, buf_im);
+        } else {
+            format_real_impl_(buf_re, sizeof(buf_re), sparse->values[k]);
+            fprintf(file, "%d %d %s\n", i, j, buf_re);
+        }
+    }
+
+    /* Close file */
+    fclose(file);
+}
+
+#endif /* DATA_FILE_LIBRARY_MTXDAT_IMPL_H */
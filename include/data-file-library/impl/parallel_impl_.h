@@ -0,0 +1,269 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/parallel_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the import of one Wolfram Language package source
+        file by many threads. A scan of the braces finds the sizes and the
+        byte offsets of the top-level sub-lists, each of which is a
+        contiguous block of the row-major output, and each thread parses a
+        range of sub-lists directly into its block.
+*/
+
+#ifndef DATA_FILE_LIBRARY_PARALLEL_IMPL_H
+#define DATA_FILE_LIBRARY_PARALLEL_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h> /* For strerror() */
+#include <errno.h> /* For errno */
+#include <stddef.h> /* For size_t and ptrdiff_t */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "thread_impl_.h"
+#include "follow_impl_.h" /* For file_seek_impl_() */
+#include "wldat_impl_.h"
+
+/*
+    Byte offsets of the top-level sub-lists found by a scan. Only the
+    offsets of the sub-lists whose index is a multiple of step are kept,
+    and step doubles whenever the array is full, so that the memory does
+    not grow with the number of sub-lists.
+*/
+typedef struct {
+    long long offsets[1024];
+    int count;
+    size_t step;
+} wl_sublists_impl_;
+
+/*
+    Part of a parallel import, i.e., a range of top-level sub-lists parsed
+    by one thread.
+*/
+typedef struct {
+    const char *file_path;
+    long long offset;
+    size_t first;
+    size_t last;
+    int dimensions;
+    const ptrdiff_t *stride;
+    double *data;
+    tpdfcplx_impl_ *data_cplx;
+} wl_parallel_part_impl_;
+
+/*
+    Implementation for scanning the braces of a Wolfram Language package
+    source format, to output the size of each dimension and the byte
+    offsets of the top-level sub-lists in a single pass.
+
+    Parameters:
+    - file_path, path to the data file.
+    - dimensions, number N of dimensions of the data, at least 2.
+    - size, array of size N to output the size of each dimension.
+    - sublists, to output the offsets of the top-level sub-lists.
+*/
+static inline void wldat_scan_sublists_impl_(const char *file_path,
+    int dimensions, size_t *size, wl_sublists_impl_ *sublists) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "rb");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_scan_sublists_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    size[0] = 0;
+    for (int d = 1; d < dimensions; d++) {
+        size[d] = 1;
+    }
+    sublists->count = 0;
+    sublists->step = 1;
+
+    /* Scan the file by blocks, skipping the first line */
+    char block[65536];
+    int skip_line = 1;
+    int depth = 0;
+    int done = 0;
+    /* Commas are counted only until one is found at a lower depth, i.e.,
+       within the first element of each level */
+    int min_comma_depth = dimensions + 1;
+    long long position = 0;
+    size_t n;
+
+    while (!done && (n = fread(block, 1, sizeof(block), file)) > 0) {
+        for (size_t k = 0; k < n; k++) {
+            char ch = block[k];
+            if (skip_line) {
+                if (ch == '\n') skip_line = 0;
+            } else if (ch == '{') {
+                depth++;
+                if (depth == 2) {
+                    /* Start of a top-level sub-list */
+                    if (size[0] % sublists->step == 0) {
+                        if (sublists->count == 1024) {
+                            for (int s = 0; s < 512; s++) {
+                                sublists->offsets[s] = sublists->offsets[2*s];
+                            }
+                            sublists->count = 512;
+                            sublists->step *= 2;
+                        }
+                        if (size[0] % sublists->step == 0) {
+                            sublists->offsets[sublists->count++] =
+                                position + (long long)k;
+                        }
+                    }
+                    size[0]++;
+                }
+            } else if (ch == '}') {
+                depth--;
+                if (depth == 0) {
+                    done = 1;
+                    break;
+                }
+            } else if (ch == ',' && depth <= min_comma_depth) {
+                if (depth >= 2 && depth <= dimensions) size[depth - 1]++;
+                min_comma_depth = depth;
+            }
+        }
+        position += (long long)n;
+    }
+
+    /* Close file */
+    fclose(file);
+}
+
+/*
+    Thread of a parallel import, which parses the sub-lists of one part.
+
+    Parameter:
+    - context, the wl_parallel_part_impl_.
+*/
+static inline void *wldat_parallel_worker_impl_(void *context) {
+    wl_parallel_part_impl_ *part = (wl_parallel_part_impl_ *)context;
+    if (part->first >= part->last) return NULL;
+
+    /* Open file */
+    FILE *file = fopen(part->file_path, "rb");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_parallel_worker_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    /* Seek to the part, with 64-bit offsets (see file_seek_impl_()) */
+    if (file_seek_impl_(file, part->offset) != 0) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_parallel_worker_impl_() ->"
+                        " Error in seeking file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    ptrdiff_t indices[128];
+    for (size_t i = part->first; i < part->last; i++) {
+        /* Skip the comma and the blanks before the sub-list */
+        int ch;
+        do { ch = fgetc(file); } while (ch != EOF && ch != '{');
+        if (ch == EOF) break;
+        ungetc(ch, file);
+
+        indices[0] = (ptrdiff_t)i;
+        if (part->data_cplx != NULL) {
+            read_nested_braces_cplx_impl_(file, 1, part->dimensions,
+                part->stride, indices, part->data_cplx);
+        } else {
+            read_nested_braces_impl_(file, 1, part->dimensions,
+                part->stride, indices, part->data);
+        }
+    }
+
+    /* Close file */
+    fclose(file);
+    return NULL;
+}
+
+/*
+    Implementation for importing data from a Wolfram Language package source
+    format with many threads, storing the values in an one-dimensional
+    array following the row-major order. Data of one dimension is imported
+    by the calling thread only.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, double-type array of size S1*S2*...*SN for real values,
+    otherwise NULL.
+    - data_cplx, 'double complex'-type array of size S1*S2*...*SN for
+    complex values, otherwise NULL.
+    - threads, number of threads, where 0 selects the number of processors.
+*/
+static inline void wldat_import_parallel_impl_(const char *file_path,
+    double *data, tpdfcplx_impl_ *data_cplx, int threads) {
+
+    int dimensions = wldat_get_dimensions_impl_(file_path);
+    if (threads <= 0) threads = hardware_threads_impl_();
+    if (dimensions < 2) {
+        if (data_cplx != NULL) {
+            wldat_import_cplx_impl_(file_path, data_cplx);
+        } else {
+            wldat_import_impl_(file_path, data);
+        }
+        return;
+    }
+
+    /* Find the sizes and where the sub-lists start */
+    size_t size[128];
+    wl_sublists_impl_ sublists;
+    wldat_scan_sublists_impl_(file_path, dimensions, size, &sublists);
+    if (sublists.count == 0) return;
+    if (threads > sublists.count) threads = sublists.count;
+
+    ptrdiff_t stride[128];
+    row_major_strides_impl_(size, dimensions, stride);
+
+    /* Split the kept offsets evenly among the threads */
+    wl_parallel_part_impl_ *parts = (wl_parallel_part_impl_ *)
+        dfl_allocate_impl_(NULL,
+        (size_t)threads * sizeof(wl_parallel_part_impl_));
+    for (int t = 0; t < threads; t++) {
+        int begin = (int)((long long)t * sublists.count / threads);
+        int end = (int)((long long)(t + 1) * sublists.count / threads);
+        parts[t].file_path = file_path;
+        parts[t].offset = sublists.offsets[begin];
+        parts[t].first = (size_t)begin * sublists.step;
+        parts[t].last = (t == threads - 1) ? size[0] :
+            (size_t)end * sublists.step;
+        parts[t].dimensions = dimensions;
+        parts[t].stride = stride;
+        parts[t].data = data;
+        parts[t].data_cplx = data_cplx;
+    }
+
+    /* The calling thread parses the first part */
+    tpthread_impl_ *pool = NULL;
+    if (threads > 1) {
+        pool = (tpthread_impl_ *)dfl_allocate_impl_(NULL,
+            (size_t)(threads - 1) * sizeof(tpthread_impl_));
+        for (int t = 1; t < threads; t++) {
+            thread_create_impl_(&pool[t - 1], wldat_parallel_worker_impl_,
+                &parts[t]);
+        }
+    }
+    wldat_parallel_worker_impl_(&parts[0]);
+    for (int t = 1; t < threads; t++) {
+        thread_join_impl_(pool[t - 1]);
+    }
+    free(pool);
+    free(parts);
+}
+
+#endif /* DATA_FILE_LIBRARY_PARALLEL_IMPL_H */
@@ -20,9 +20,301 @@
 #define DATA_FILE_LIBRARY_PARSE_IMPL_H
 
 #include <math.h> /* For NAN and INFINITY */
+#include <stdio.h> /* For snprintf() */
+#include <stdlib.h> /* For strtod() */
 #include <string.h>
+#include <stdint.h> /* For uint64_t */
 #include "cplx_c_cpp_impl_.h"
 
+/*
+    Powers of ten that are exactly representable by a double.
+*/
+static const double exact_powers_of_ten_impl_[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+    1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+    Returns the length of prefix if str starts with it, ignoring the ASCII
+    case, or 0 otherwise.
+
+    Parameters:
+    - str, the input string.
+    - prefix, lowercase prefix.
+*/
+static inline int ascii_prefix_ci_impl_(const char *str, const char *prefix) {
+    int n = 0;
+    while (prefix[n] != '\0') {
+        if ((str[n] | 0x20) != prefix[n]) return 0;
+        n++;
+    }
+    return n;
+}
+
+/*
+    Locale-independent replacement of strtod() for decimal numbers of the
+    form [sign]digits[.digits][(e|E)[sign]digits], hexadecimal numbers of
+    the form [sign](0x|0X)hexdigits[.hexdigits][(p|P)[sign]digits], inf,
+    infinity and nan (ASCII case ignored). The decimal point is always '.',
+    whatever the LC_NUMERIC of the process, and no global state is touched,
+    so it may be called from many threads at the same time. Numbers with up
+    to 19 significant digits and a small exponent are computed exactly with
+    a single multiplication or division (Clinger's fast path). The others
+    are rewritten as an integer of digits with an exponent, which has no
+    decimal point and so is read the same in every locale, and delegated to
+    the strtod() of the C library for correct rounding. This slow path thus
+    still goes through the C library, which may consult the locale of the
+    process, but never depends on its decimal point.
+
+    Parameters:
+    - str, the input string. Leading blanks are skipped.
+    - end, if not NULL, outputs the position after the number, or str if no
+    number could be read.
+*/
+static inline double strtod_c_impl_(const char *str, char **end) {
+
+    const char *p = str;
+    int negative = 0;
+    double value;
+
+    while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' ||
+        *p == '\v' || *p == '\f') {
+        p++;
+    }
+    if (*p == '+' || *p == '-') {
+        negative = (*p == '-');
+        p++;
+    }
+
+    /* Infinity and not-a-number */
+    int n;
+    if ((n = ascii_prefix_ci_impl_(p, "infinity")) ||
+        (n = ascii_prefix_ci_impl_(p, "inf"))) {
+        if (end) *end = (char *)(p + n);
+        return negative ? -INFINITY : INFINITY;
+    }
+    if ((n = ascii_prefix_ci_impl_(p, "nan"))) {
+        if (end) *end = (char *)(p + n);
+        return negative ? -NAN : NAN;
+    }
+
+    /* Hexadecimal, with at most 15 significant digits + 1 sticky bit */
+    if (p[0] == '0' && (p[1] | 0x20) == 'x') {
+        const char *q = p + 2;
+        uint64_t mantissa = 0;
+        long exp2 = 0;
+        int any_hex = 0, point = 0, nhex = 0, hex_sticky = 0;
+        for (;; q++) {
+            int h;
+            if (*q >= '0' && *q <= '9') {
+                h = *q - '0';
+            } else if ((*q | 0x20) >= 'a' && (*q | 0x20) <= 'f') {
+                h = (*q | 0x20) - 'a' + 10;
+            } else if (*q == '.' && !point) {
+                point = 1;
+                continue;
+            } else {
+                break;
+            }
+            any_hex = 1;
+            if (nhex < 15) {
+                mantissa = 16*mantissa + (uint64_t)h;
+                if (mantissa != 0) nhex++;
+                if (point) exp2 -= 4;
+            } else {
+                if (h != 0) hex_sticky = 1;
+                if (!point) exp2 += 4;
+            }
+        }
+        if (any_hex) {
+            if ((*q | 0x20) == 'p') {
+                const char *r = q + 1;
+                int exp_negative = 0;
+                long exp_value = 0;
+                if (*r == '+' || *r == '-') {
+                    exp_negative = (*r == '-');
+                    r++;
+                }
+                if (*r >= '0' && *r <= '9') {
+                    while (*r >= '0' && *r <= '9') {
+                        if (exp_value < 100000) {
+                            exp_value = 10*exp_value + (*r - '0');
+                        }
+                        r++;
+                    }
+                    exp2 += exp_negative ? -exp_value : exp_value;
+                    q = r;
+                }
+            }
+            if (end) *end = (char *)q;
+            /* At most 61 bits, rounded once unless the result is subnormal */
+            mantissa = (mantissa << 1) | (uint64_t)hex_sticky;
+            value = ldexp((double)mantissa, (int)(exp2 - 1));
+            return negative ? -value : value;
+        }
+        /* "0x" without digits is the number 0 followed by "x" */
+    }
+
+    /* Significant digits, at most 767 + 1 sticky digit are ever needed */
+    char digits[800];
+    int ndigits = 0, sticky = 0, any_digit = 0;
+    long exp10 = 0;
+
+    /* Integer part */
+    while (*p >= '0' && *p <= '9') {
+        any_digit = 1;
+        if (ndigits == 0 && *p == '0') {
+            /* Leading zero */
+        } else if (ndigits < 767) {
+            digits[ndigits++] = *p;
+        } else {
+            exp10++;
+            if (*p != '0') sticky = 1;
+        }
+        p++;
+    }
+
+    /* Fractional part */
+    if (*p == '.') {
+        const char *q = p + 1;
+        while (*q >= '0' && *q <= '9') {
+            any_digit = 1;
+            if (ndigits == 0 && *q == '0') {
+                exp10--;
+            } else if (ndigits < 767) {
+                digits[ndigits++] = *q;
+                exp10--;
+            } else if (*q != '0') {
+                sticky = 1;
+            }
+            q++;
+        }
+        if (any_digit) p = q;
+    }
+
+    if (!any_digit) {
+        if (end) *end = (char *)str;
+        return 0.0;
+    }
+
+    /* Exponent */
+    if (*p == 'e' || *p == 'E') {
+        const char *q = p + 1;
+        int exp_negative = 0;
+        long exp_value = 0;
+        if (*q == '+' || *q == '-') {
+            exp_negative = (*q == '-');
+            q++;
+        }
+        if (*q >= '0' && *q <= '9') {
+            while (*q >= '0' && *q <= '9') {
+                if (exp_value < 100000) exp_value = 10*exp_value + (*q - '0');
+                q++;
+            }
+            exp10 += exp_negative ? -exp_value : exp_value;
+            p = q;
+        }
+    }
+
+    if (end) *end = (char *)p;
+
+    if (ndigits == 0) {
+        value = 0.0;
+    } else if (ndigits <= 19 && !sticky && exp10 >= -22 && exp10 <= 22) {
+        uint64_t mantissa = 0;
+        for (int i = 0; i < ndigits; i++) {
+            mantissa = 10*mantissa + (uint64_t)(digits[i] - '0');
+        }
+        if (mantissa <= ((uint64_t)1 << 53)) {
+            /* Exact operands, a single correctly rounded operation */
+            value = (double)mantissa;
+            if (exp10 < 0) {
+                value /= exact_powers_of_ten_impl_[-exp10];
+            } else {
+                value *= exact_powers_of_ten_impl_[exp10];
+            }
+        } else {
+            snprintf(digits + ndigits, sizeof(digits) - ndigits, "e%ld",
+                exp10);
+            value = strtod(digits, NULL);
+        }
+    } else {
+        if (sticky) {
+            digits[ndigits++] = '1';
+            exp10--;
+        }
+        snprintf(digits + ndigits, sizeof(digits) - ndigits, "e%ld", exp10);
+        value = strtod(digits, NULL);
+    }
+
+    return negative ? -value : value;
+}
+
+/*
+    Writes a double in the form [-]d.dddddddddddddddde(+|-)dd, as the
+    "%.16e" format of printf(), but always with '.' as the decimal point,
+    whatever the LC_NUMERIC of the process. Returns the length of the
+    output.
+
+    Parameters:
+    - output, the output string.
+    - output_size, is the sizeof(output).
+    - input, the input number.
+*/
+static inline int format_real_impl_(char *output, size_t output_size,
+    double input) {
+
+    int len = snprintf(output, output_size, "%.16e", input);
+    if (len < 0 || (size_t)len >= output_size) return len;
+
+    /* Replace the locale decimal point, which may have several bytes */
+    char *p = output;
+    if (*p == '-') p++;
+    if (*p >= '0' && *p <= '9' && p[1] != '.' && p[1] != 'e' &&
+        p[1] != '\0') {
+        char *q = p + 1;
+        char *r = q;
+        while (*r != '\0' && !(*r >= '0' && *r <= '9')) r++;
+        *q = '.';
+        memmove(q + 1, r, strlen(r) + 1);
+        len -= (int)(r - q - 1);
+    }
+    return len;
+}
+
+/*
+    Writes a double with a given number of significant digits in the
+    shortest of the fixed and exponential forms, as the "%.*g" format of
+    printf(), but always with '.' as the decimal point, whatever the
+    LC_NUMERIC of the process. Returns the length of the output.
+
+    Parameters:
+    - output, the output string.
+    - output_size, is the sizeof(output).
+    - input, the input number.
+    - precision, number of significant digits.
+*/
+static inline int format_real_g_impl_(char *output, size_t output_size,
+    double input, int precision) {
+
+    int len = snprintf(output, output_size, "%.*g", precision, input);
+    if (len < 0 || (size_t)len >= output_size) return len;
+
+    /* Replace the locale decimal point, which may have several bytes */
+    char *digits = output;
+    if (*digits == '-') digits++;
+    char *q = digits;
+    while (*q >= '0' && *q <= '9') q++;
+    if (q != digits && *q != '\0' && *q != 'e' && *q != '.') {
+        char *r = q;
+        while (*r != '\0' && !(*r >= '0' && *r <= '9') && *r != 'e') r++;
+        *q = '.';
+        memmove(q + 1, r, strlen(r) + 1);
+        len -= (int)(r - q - 1);
+    }
+    return len;
+}
+
 /*
     Removes spaces char ' ' from a string in place.
     
@@ -129,7 +421,7 @@ static inline void e_to_star_caret_impl_(char *output, size_t output_size,
     double input) {
 
     char tmp[128];
-    snprintf(tmp, sizeof(tmp), "%.16e", input);
+    format_real_impl_(tmp, sizeof(tmp), input);
 
     char *p = strchr(tmp, 'e');
     if (p) {
@@ -158,39 +450,61 @@ static inline void complexinfinity_to_infinity_impl_(char *str) {
 }
 
 /*
-    Returns a real double-type value from a string. The values may also be
-    in the base 10 exponential form eN or *^N, where N is an integer.
-    
+    Returns a real double-type value from a string, and whether the whole
+    string is a number. The values may also be in the base 10 exponential
+    form eN or *^N, where N is an integer. A string that does not start
+    with a number gives NAN, and one with other characters after the
+    number gives the number, both being invalid.
+
     Parameters:
     - str, the input numeric value.
+    - valid, to output 1 if the whole string is a number, otherwise 0.
 */
-static inline double parse_real_impl_(char *str) {
-    
+static inline double parse_real_checked_impl_(char *str, int *valid) {
+
     complexinfinity_to_infinity_impl_(str);
     remove_spaces_impl_(str);
     remove_quotes_impl_(str);
     star_caret_to_e_impl_(str);
 
-    double real;
+    char *end;
+    double real = strtod_c_impl_(str, &end);
 
-    if (sscanf(str, "%lf", &real) == 1) {
+    *valid = (end != str && *end == '\0');
+    if (end != str) {
         return real;
     } else {
         return NAN;
     }
 }
 
+/*
+    Returns a real double-type value from a string. The values may also be
+    in the base 10 exponential form eN or *^N, where N is an integer.
+    
+    Parameters:
+    - str, the input numeric value.
+*/
+static inline double parse_real_impl_(char *str) {
+
+    int valid;
+    return parse_real_checked_impl_(str, &valid);
+}
+
 /*
     Returns a real 'double complex'-type value from a string considering C,
     Wolfram Language (WL), and Matlab conventions. The complex values
     may be of the type a, a+bi, bi, i, and -i, where i may also be j, *i, *j,
     or *I, and where a and b may also be in the base 10 exponential form eN
-    or *^N, where N is an integer.
-    
+    or *^N, where N is an integer. Also outputs whether the whole string is
+    a number.
+
     Parameters:
     - str, the input numeric complex value.
+    - valid, to output 1 if the whole string is a number, otherwise 0.
 */
-static inline tpdfcplx_impl_ parse_complex_impl_(char *str) {
+static inline tpdfcplx_impl_ parse_complex_checked_impl_(char *str,
+    int *valid) {
     
     complexinfinity_to_infinity_impl_(str);
     remove_spaces_impl_(str);
@@ -201,21 +515,29 @@ static inline tpdfcplx_impl_ parse_complex_impl_(char *str) {
     star_i_to_i_impl_(str);
 
     double real, imag;
+    char *end;
     size_t len = strlen(str);
+    *valid = 1;
 
     if (len > 0 && str[len-1] == 'i') {
         
         /* Complex number */
-        if (sscanf(str, "%lf+%lfi", &real, &imag) == 2) {
-            /* Complex of the type a+bi */
-            return real + I_IMPL_ * imag;
-        } else if (sscanf(str, "%lf-%lfi", &real, &imag) == 2) {
-            /* Complex of the type a-bi */
-            return real - I_IMPL_ * imag;
-        } else if (sscanf(str, "%lfi", &imag) == 1) {
+        char *last = str + len - 1;
+        real = strtod_c_impl_(str, &end);
+        if (end != str && end == last) {
             /* Complex of the type bi */
-            real = 0.0;
-            return real + I_IMPL_ * imag;
+            return 0.0 + I_IMPL_ * real;
+        } else if (end != str && (*end == '+' || *end == '-')) {
+            char *sign = end;
+            imag = strtod_c_impl_(sign, &end);
+            if (end != sign && end == last) {
+                /* Complex of the type a+bi or a-bi */
+                return real + I_IMPL_ * imag;
+            } else if (sign + 1 == last) {
+                /* Complex of the type a+i or a-i */
+                imag = (*sign == '-') ? -1.0 : 1.0;
+                return real + I_IMPL_ * imag;
+            }
         } else if (strcmp(str, "i") == 0 || strcmp(str, "+i") == 0) {
             /* Complex of the type i */
             real = 0.0; imag = 1.0;
@@ -224,15 +546,17 @@ static inline tpdfcplx_impl_ parse_complex_impl_(char *str) {
             /* Complex of the type -i */
             real = 0.0; imag = -1.0;
             return real + I_IMPL_ * imag;
-        } else {
-            /* Invalid complex number type */
-            real = NAN; imag = NAN;
-            return real + I_IMPL_ * imag;
         }
+        /* Invalid complex number type */
+        *valid = 0;
+        real = NAN; imag = NAN;
+        return real + I_IMPL_ * imag;
     } else {
         /* Real number */
         imag = 0.0;
-        if (sscanf(str, "%lf", &real) == 1) {
+        real = strtod_c_impl_(str, &end);
+        *valid = (end != str && *end == '\0');
+        if (end != str) {
             /* Real number of the type +a */
             return real + I_IMPL_ * imag;
         } else {
@@ -243,4 +567,18 @@ static inline tpdfcplx_impl_ parse_complex_impl_(char *str) {
     }
 }
 
+/*
+    Returns a real 'double complex'-type value from a string considering C,
+    Wolfram Language (WL), and Matlab conventions, as
+    parse_complex_checked_impl_().
+
+    Parameters:
+    - str, the input numeric complex value.
+*/
+static inline tpdfcplx_impl_ parse_complex_impl_(char *str) {
+
+    int valid;
+    return parse_complex_checked_impl_(str, &valid);
+}
+
 #endif /* DATA_FILE_LIBRARY_PARSE_IMPL_H */
\ No newline at end of file
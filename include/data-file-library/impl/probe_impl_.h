@@ -0,0 +1,231 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/probe_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the probe of char-separated columns data files,
+        which finds in one scan their shape, the number of columns of the
+        rows, whether any value is complex, and the number formats used,
+        so that the import function and the memory may be chosen upfront.
+*/
+
+#ifndef DATA_FILE_LIBRARY_PROBE_IMPL_H
+#define DATA_FILE_LIBRARY_PROBE_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For EXIT_FAILURE */
+#include <string.h> /* For strerror(), strstr() and memset() */
+#include <errno.h> /* For errno */
+#include "alloc_impl_.h"
+#include "parse_impl_.h"
+#include "follow_impl_.h" /* For file_size_impl_() */
+
+/* Number formats found by a probe, combined with | */
+#define DFL_FORMAT_INTEGER 1 /* e.g., 42 */
+#define DFL_FORMAT_DECIMAL 2 /* e.g., 4.2 */
+#define DFL_FORMAT_EXPONENT 4 /* e.g., 4.2e1 */
+#define DFL_FORMAT_WL_EXPONENT 8 /* e.g., 4.2*^1 */
+#define DFL_FORMAT_INF_NAN 16 /* e.g., inf, NaN, Infinity */
+#define DFL_FORMAT_COMPLEX 32 /* e.g., 1+2i, 3.5*I */
+#define DFL_FORMAT_EMPTY 64 /* nothing between two separators */
+#define DFL_FORMAT_INVALID 128 /* anything else */
+
+/*
+    Result of a probe.
+    - rows, number of rows, or an estimate if sampled is 1.
+    - columns, largest number of columns of a row.
+    - min_columns, smallest number of columns of a row.
+    - ragged_rows, number of rows with less than columns columns, whose
+    missing values are not written by the import functions.
+    - is_complex, 1 if any value is complex, otherwise 0.
+    - formats, the DFL_FORMAT_* flags of the values found.
+    - sampled, 1 if only the first bytes of the file were scanned, otherwise
+    0.
+    - bytes, number of bytes scanned.
+*/
+typedef struct dfl_probe {
+    long long rows;
+    int columns;
+    int min_columns;
+    long long ragged_rows;
+    int is_complex;
+    int formats;
+    int sampled;
+    long long bytes;
+} dfl_probe;
+
+/*
+    Returns the DFL_FORMAT_* flag of one value. Values with an imaginary
+    unit are complex only if they parse as such, otherwise invalid.
+
+    Parameters:
+    - token, the characters of the value, with room for one more char,
+    which are modified.
+    - length, number of characters.
+*/
+static inline int probe_token_format_impl_(char *token, size_t length) {
+
+    char *buf = token;
+    buf[length] = '\0';
+
+    int wl_exponent = strstr(buf, "*^") != NULL;
+    remove_spaces_impl_(buf);
+    remove_quotes_impl_(buf);
+    if (buf[0] == '\0') return DFL_FORMAT_EMPTY;
+    star_caret_to_e_impl_(buf);
+
+    /* Real values are consumed entirely by the parser */
+    char *end;
+    strtod_c_impl_(buf, &end);
+    if (end != buf && *end == '\0') {
+        int format = DFL_FORMAT_INTEGER;
+        for (const char *c = buf; *c != '\0'; c++) {
+            if (*c == 'n' || *c == 'N') {
+                /* Letters of "inf", "infinity" and "nan" */
+                return DFL_FORMAT_INF_NAN;
+            } else if (*c == 'e' || *c == 'E') {
+                format = DFL_FORMAT_EXPONENT;
+            } else if (*c == '.' && format == DFL_FORMAT_INTEGER) {
+                format = DFL_FORMAT_DECIMAL;
+            }
+        }
+        return (format == DFL_FORMAT_EXPONENT && wl_exponent) ?
+            DFL_FORMAT_WL_EXPONENT : format;
+    }
+
+    /* Complex values are consumed entirely by the complex parser */
+    int valid;
+    parse_complex_checked_impl_(buf, &valid);
+    return valid ? DFL_FORMAT_COMPLEX : DFL_FORMAT_INVALID;
+}
+
+/*
+    Accounts a row of a probe.
+
+    Parameters:
+    - probe, the probe.
+    - columns, number of columns of the row.
+*/
+static inline void probe_end_row_impl_(dfl_probe *probe, int columns) {
+    if (probe->rows == 0 || columns < probe->min_columns) {
+        probe->min_columns = columns;
+    }
+    if (columns > probe->columns) {
+        /* All the previous rows are shorter */
+        probe->ragged_rows = probe->rows;
+        probe->columns = columns;
+    } else if (columns < probe->columns) {
+        probe->ragged_rows++;
+    }
+    probe->rows++;
+}
+
+/*
+    Implementation for probing a breakline-separated lines and
+    char-separated columns data file.
+
+    Parameters:
+    - file_path, path to the file.
+    - probe, to output the result.
+    - sample_bytes, number of bytes to be scanned, where 0 scans the whole
+    file. When the file is larger, the number of rows is estimated from the
+    complete lines of the sample.
+    - sep, column separator.
+*/
+static inline void sepdat_probe_impl_(const char *file_path,
+    dfl_probe *probe, long long sample_bytes, char sep) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "rb");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " sepdat_probe_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    memset(probe, 0, sizeof(dfl_probe));
+
+    /* Scan the file by blocks, keeping the current value in token, which
+       grows as needed */
+    char block[65536];
+    size_t token_capacity = 128;
+    char *token = (char *)dfl_allocate_impl_(NULL, token_capacity);
+    size_t token_length = 0;
+    int current_cols = 0;
+    int in_row = 0;
+    int eof = 0;
+    long long total = 0;
+    long long complete_bytes = 0;
+    size_t n;
+
+    while (!eof) {
+        size_t want = sizeof(block);
+        if (sample_bytes > 0 && total + (long long)want > sample_bytes) {
+            want = (size_t)(sample_bytes - total);
+        }
+        if (want == 0) break;
+        n = fread(block, 1, want, file);
+        if (n < want) eof = 1;
+        for (size_t k = 0; k < n; k++) {
+            char ch = block[k];
+            if (ch != sep && ch != '\n') {
+                if (ch != '\r') {
+                    if (token_length + 1 == token_capacity) {
+                        buffer_grow_impl_(&token, &token_capacity,
+                            "sepdat_probe_impl_");
+                    }
+                    token[token_length++] = ch;
+                }
+                in_row = 1;
+                continue;
+            }
+
+            /* End of a value */
+            probe->formats |= probe_token_format_impl_(token, token_length);
+            token_length = 0;
+            current_cols++;
+            if (ch == '\n') {
+                probe_end_row_impl_(probe, current_cols);
+                current_cols = 0;
+                in_row = 0;
+                complete_bytes = total + (long long)k + 1;
+            }
+        }
+        total += (long long)n;
+    }
+
+    /* Estimate the rows from the sample, or count the last row */
+    long long size = total;
+    if (!eof && file_size_impl_(file, &size) != 0) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " sepdat_probe_impl_() ->"
+                        " Error in seeking file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    if (size > total) {
+        probe->sampled = 1;
+        if (complete_bytes > 0) {
+            probe->rows = (long long)((double)probe->rows * (double)size /
+                (double)complete_bytes);
+        }
+    } else if (in_row || current_cols > 0) {
+        probe->formats |= probe_token_format_impl_(token, token_length);
+        probe_end_row_impl_(probe, current_cols + 1);
+    }
+    probe->bytes = total;
+    probe->is_complex = (probe->formats & DFL_FORMAT_COMPLEX) != 0;
+    free(token);
+
+    /* Close file */
+    fclose(file);
+}
+
+#endif /* DATA_FILE_LIBRARY_PROBE_IMPL_H */
@@ -0,0 +1,135 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/scan_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the kernels scanning the lines of char-separated
+        columns data files, i.e., finding the next line break and counting
+        the separators before it. On x86 with GCC or Clang, the kernel is
+        chosen when the scan starts, through cpuid, among the scalar, AVX2
+        and AVX-512 ones, so that the precompiled library runs on any CPU.
+        Defining DATA_FILE_LIBRARY_NO_SIMD keeps the scalar kernel.
+*/
+
+#ifndef DATA_FILE_LIBRARY_SCAN_IMPL_H
+#define DATA_FILE_LIBRARY_SCAN_IMPL_H
+
+#include <stddef.h> /* For size_t */
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)) && \
+    !defined(DATA_FILE_LIBRARY_NO_SIMD)
+#define DFL_SCAN_X86_IMPL_ 1
+#include <immintrin.h>
+#endif
+
+/*
+    Kernel scanning a line, which returns the address of the first line break
+    in [p, end), or end, and adds to *seps the number of separators before
+    it.
+*/
+typedef const char *(*scan_line_fn_impl_)(const char *p, const char *end,
+    char sep, size_t *seps);
+
+/*
+    Scalar kernel scanning a line. See scan_line_fn_impl_.
+
+    Parameters:
+    - p, start of the bytes.
+    - end, end of the bytes.
+    - sep, column separator.
+    - seps, to add the number of separators.
+*/
+static inline const char *scan_line_scalar_impl_(const char *p,
+    const char *end, char sep, size_t *seps) {
+
+    size_t n = 0;
+    for (; p < end && *p != '\n'; p++) {
+        if (*p == sep) n++;
+    }
+    *seps += n;
+    return p;
+}
+
+#ifdef DFL_SCAN_X86_IMPL_
+
+/*
+    AVX2 kernel scanning a line, 32 bytes at a time. See
+    scan_line_scalar_impl_().
+*/
+__attribute__((target("avx2")))
+static inline const char *scan_line_avx2_impl_(const char *p,
+    const char *end, char sep, size_t *seps) {
+
+    const __m256i separators = _mm256_set1_epi8(sep);
+    const __m256i breaks = _mm256_set1_epi8('\n');
+    size_t n = 0;
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p);
+        unsigned s = (unsigned)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(v, separators));
+        unsigned b = (unsigned)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(v, breaks));
+        if (b != 0) {
+            unsigned first = (unsigned)__builtin_ctz(b);
+            n += (size_t)__builtin_popcount(s & ((1u << first) - 1u));
+            *seps += n;
+            return p + first;
+        }
+        n += (size_t)__builtin_popcount(s);
+        p += 32;
+    }
+    *seps += n;
+    return scan_line_scalar_impl_(p, end, sep, seps);
+}
+
+/*
+    AVX-512 (BW) kernel scanning a line, 64 bytes at a time. See
+    scan_line_scalar_impl_().
+*/
+__attribute__((target("avx512f,avx512bw")))
+static inline const char *scan_line_avx512_impl_(const char *p,
+    const char *end, char sep, size_t *seps) {
+
+    const __m512i separators = _mm512_set1_epi8(sep);
+    const __m512i breaks = _mm512_set1_epi8('\n');
+    size_t n = 0;
+    while (end - p >= 64) {
+        __m512i v = _mm512_loadu_si512((const void *)p);
+        unsigned long long s = (unsigned long long)_mm512_cmpeq_epi8_mask(v,
+            separators);
+        unsigned long long b = (unsigned long long)_mm512_cmpeq_epi8_mask(v,
+            breaks);
+        if (b != 0) {
+            unsigned first = (unsigned)__builtin_ctzll(b);
+            n += (size_t)__builtin_popcountll(s & ((1ull << first) - 1ull));
+            *seps += n;
+            return p + first;
+        }
+        n += (size_t)__builtin_popcountll(s);
+        p += 64;
+    }
+    *seps += n;
+    return scan_line_scalar_impl_(p, end, sep, seps);
+}
+
+#endif /* DFL_SCAN_X86_IMPL_ */
+
+/*
+    Returns the fastest kernel scanning a line supported by the CPU.
+*/
+static inline scan_line_fn_impl_ scan_line_select_impl_(void) {
+#ifdef DFL_SCAN_X86_IMPL_
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512bw")) return scan_line_avx512_impl_;
+    if (__builtin_cpu_supports("avx2")) return scan_line_avx2_impl_;
+#endif
+    return scan_line_scalar_impl_;
+}
+
+#endif /* DATA_FILE_LIBRARY_SCAN_IMPL_H */
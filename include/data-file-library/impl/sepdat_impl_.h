@@ -17,53 +17,160 @@
 #define DATA_FILE_LIBRARY_SEPDAT_IMPL_H
 
 #include <stdio.h>
-#include <stdlib.h> /* For EXIT_FAILURE */
+#include <stdlib.h> /* For realloc(), free() and EXIT_FAILURE */
+#include <string.h> /* For strerror() */
+#include <errno.h> /* For errno */
+#include <stddef.h> /* For size_t and ptrdiff_t */
 #include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
 #include "parse_impl_.h"
+#include "scan_impl_.h"
+#include "direct_impl_.h"
+
+/* Parse modes of the checked imports */
+#define DFL_PARSE_LENIENT 0 /* keep going, recording the bad cells */
+#define DFL_PARSE_STRICT 1 /* stop at the first bad cell */
 
 /*
-    Implementation for getting the size in each dimension (number of rows and
-    columns) from a data file with a given column separator.
+    Position of a cell that is not a number.
+    - row, index of the row.
+    - column, index of the column.
+    - offset, byte offset of the cell from the start of the file.
+*/
+typedef struct dfl_cell_error {
+    long long row;
+    long long column;
+    long long offset;
+} dfl_cell_error;
+
+/*
+    Options and result of a checked import.
+    - mode, DFL_PARSE_STRICT or DFL_PARSE_LENIENT.
+    - errors, array of max_errors positions to output the first bad cells,
+    or NULL.
+    - max_errors, size of the array errors.
+    - count, outputs the number of bad cells found, which may exceed
+    max_errors in the lenient mode, and is at most 1 in the strict mode.
+*/
+typedef struct dfl_parse_report {
+    int mode;
+    dfl_cell_error *errors;
+    int max_errors;
+    int count;
+} dfl_parse_report;
+
+/*
+    Reads the next value of a breakline-separated lines and char-separated
+    columns data file into a buffer that grows as needed, so that long
+    values (e.g., with many digits) are never split into two values. The
+    trailing blanks and the carriage return of CRLF line breaks are not
+    kept. Returns the char that ended the value, i.e., sep, '\n' or EOF.
 
     Parameters:
-    - file_path, path to the data file.
-    - &rows, to output the number of rows.
-    - &columns, to output the number of columns.
+    - file, the file.
     - sep, column separator.
+    - buffer, the buffer, allocated with malloc() and grown with realloc().
+    - capacity, size of the buffer.
+    - consumed, to output the number of bytes read, including the char
+    that ended the value.
 */
-static inline void sepdat_get_sizes_impl_(const char *file_path, int *rows,
-    int *columns, char sep) {
+static inline int sepdat_read_token_impl_(FILE *file, char sep,
+    char **buffer, size_t *capacity, long long *consumed) {
 
-    /* Open file */
-    FILE *file = fopen(file_path, "r");
-    if (!file) {
-        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " sepdat_get_sizes_impl_() ->"
-                        " Error in opening file: %s."
-                        " Exiting.", strerror(errno));
-        exit(EXIT_FAILURE);
+    size_t length = 0;
+    long long bytes = 0;
+    int ch;
+    while ((ch = getc(file)) != EOF) {
+        bytes++;
+        if (ch == sep || ch == '\n') break;
+        if (length + 1 == *capacity) {
+            char *grown = (char *)realloc(*buffer, 2*(*capacity));
+            if (grown == NULL) {
+                fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                                " sepdat_read_token_impl_() ->"
+                                " Error in allocating memory."
+                                " Exiting.");
+                exit(EXIT_FAILURE);
+            }
+            *buffer = grown;
+            *capacity *= 2;
+        }
+        (*buffer)[length++] = (char)ch;
+    }
+    while (length > 0 && ((*buffer)[length - 1] == '\r' ||
+        (*buffer)[length - 1] == ' ' || (*buffer)[length - 1] == '\t')) {
+        length--;
     }
+    (*buffer)[length] = '\0';
+    *consumed = bytes;
+    return ch;
+}
 
-    /* Read file */
-    int ch;
-    int current_cols = 0;
-    int max_cols = 0;
+/*
+    Records a bad cell of a checked import. Returns 1 if the import must
+    stop, i.e., in the strict mode, otherwise 0.
+
+    Parameters:
+    - report, the report.
+    - row, index of the row.
+    - column, index of the column.
+    - offset, byte offset of the cell.
+*/
+static inline int sepdat_report_cell_impl_(dfl_parse_report *report,
+    long long row, long long column, long long offset) {
+
+    if (report->errors != NULL && report->count < report->max_errors) {
+        report->errors[report->count].row = row;
+        report->errors[report->count].column = column;
+        report->errors[report->count].offset = offset;
+    }
+    report->count++;
+    return report->mode == DFL_PARSE_STRICT;
+}
+
+/*
+    Scans an opened data file with a given column separator for the size in
+    each dimension (number of rows and columns), as size_t.
+
+    Parameters:
+    - file, the file, at its start.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - sep, column separator.
+*/
+static inline void sepdat_scan_sizes_impl_(FILE *file, size_t *rows,
+    size_t *columns, char sep) {
+
+    /* Read file by blocks, each line scanned by the kernel of the CPU */
+    scan_line_fn_impl_ scan_line = scan_line_select_impl_();
+    char block[65536];
+    size_t n;
+    size_t current_cols = 0;
+    size_t max_cols = 0;
+    int in_row = 0;
     *rows = 0;
-    while ((ch = fgetc(file)) != EOF) {
-        if (ch == sep) {
-            current_cols++;
-        } else if (ch == '\n') {
+    while ((n = fread(block, 1, sizeof(block), file)) > 0) {
+        const char *p = block;
+        const char *end = block + n;
+        while (p < end) {
+            const char *q = scan_line(p, end, sep, &current_cols);
+            if (q == end) {
+                in_row = 1;
+                break;
+            }
             current_cols++;
             if (current_cols > max_cols) {
                 max_cols = current_cols;
             }
             current_cols = 0;
+            in_row = 0;
             (*rows)++;
+            p = q + 1;
         }
     }
 
     /* Handle last row if file does not end with newline */
-    if (current_cols > 0) {
+    if (in_row) {
         current_cols++;
         if (current_cols > max_cols) {
             max_cols = current_cols;
@@ -71,9 +178,187 @@ static inline void sepdat_get_sizes_impl_(const char *file_path, int *rows,
         (*rows)++;
     }
     *columns = max_cols;
+}
+
+/*
+    Implementation for getting the size in each dimension (number of rows and
+    columns) from a data file with a given column separator, as size_t, so
+    that files with more than 2^31 rows or values may be handled.
+
+    Parameters:
+    - file_path, path to the data file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - sep, column separator.
+*/
+static inline void sepdat_get_sizes64_impl_(const char *file_path,
+    size_t *rows, size_t *columns, char sep) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "r");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " sepdat_get_sizes64_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    sepdat_scan_sizes_impl_(file, rows, columns, sep);
+
+    /* Close file */
+    fclose(file);
+}
+
+/*
+    Implementation for getting the size in each dimension (number of rows and
+    columns) from a data file with a given column separator, as size_t,
+    without exiting on failure. Returns 0, or the errno of the failure to
+    open the file.
+
+    Parameters:
+    - file_path, path to the data file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - sep, column separator.
+*/
+static inline int sepdat_get_sizes_status_impl_(const char *file_path,
+    size_t *rows, size_t *columns, char sep) {
+
+    FILE *file = fopen(file_path, "r");
+    if (!file) return errno != 0 ? errno : EIO;
+    sepdat_scan_sizes_impl_(file, rows, columns, sep);
+    fclose(file);
+    return 0;
+}
+
+/*
+    Implementation for getting the size in each dimension (number of rows and
+    columns) from a data file with a given column separator, as int.
+
+    Parameters:
+    - file_path, path to the data file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - sep, column separator.
+*/
+static inline void sepdat_get_sizes_impl_(const char *file_path, int *rows,
+    int *columns, char sep) {
+
+    size_t rows64, columns64;
+    sepdat_get_sizes64_impl_(file_path, &rows64, &columns64, sep);
+    *rows = size_to_int_impl_(rows64, "sepdat_get_sizes_impl_");
+    *columns = size_to_int_impl_(columns64, "sepdat_get_sizes_impl_");
+}
+
+/*
+    Reads double-type data from an opened breakline-separated lines and
+    char-separated columns data file of known sizes into a double-type array
+    with arbitrary strides. See sepdat_read_strided_impl_().
+*/
+static inline int sepdat_read_file_strided_impl_(FILE *file,
+    double *data, size_t rows, size_t columns, ptrdiff_t row_stride,
+    ptrdiff_t column_stride, char sep, dfl_parse_report *report) {
+
+    size_t i = 0, j = 0;
+    int ch;
+    long long offset = 0, consumed;
+    size_t capacity = 128;
+    char *buffer = (char *)dfl_allocate_impl_(NULL, capacity);
+    if (report != NULL) report->count = 0;
+
+    /* Read file */
+    while (i < rows) {
+        ch = sepdat_read_token_impl_(file, sep, &buffer, &capacity,
+            &consumed);
+        if (ch == EOF && consumed == 0 && j == 0) break;
+        if (j < columns) {
+            /* Parse and store */
+            int valid;
+            data[(ptrdiff_t)i*row_stride + (ptrdiff_t)j*column_stride] =
+                parse_real_checked_impl_(buffer, &valid);
+            if (!valid && report != NULL &&
+                sepdat_report_cell_impl_(report, (long long)i, (long long)j,
+                offset)) {
+                break;
+            }
+        }
+        offset += consumed;
+        /* Next column or row */
+        if (ch == sep) {
+            j++;
+        } else {
+            i++;
+            j = 0;
+            if (ch == EOF) break;
+        }
+    }
+    free(buffer);
+    return report != NULL ? report->count : 0;
+}
+
+/*
+    Implementation for reading double-type data from a breakline-separated
+    lines and char-separated columns data file of known sizes, as given by
+    sepdat_get_sizes_impl_(), into a double-type array with arbitrary
+    strides, i.e., the value of row i and column j is stored at
+    data[i*row_stride + j*column_stride]. The row-major order has
+    row_stride = columns and column_stride = 1, and the column-major order
+    has row_stride = 1 and column_stride = rows (or a larger leading
+    dimension). Returns the number of cells that are not numbers when a
+    report is given, which are stored as NAN (or as the number they start
+    with), otherwise 0.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array to output the data.
+    - rows, number of rows of the file.
+    - columns, number of columns of the file.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+    - sep, column separator.
+    - report, options and result of a checked import, or NULL.
+*/
+static inline int sepdat_read_strided_impl_(const char *file_path,
+    double *data, size_t rows, size_t columns, ptrdiff_t row_stride,
+    ptrdiff_t column_stride, char sep, dfl_parse_report *report) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "rb");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " sepdat_read_strided_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    int count = sepdat_read_file_strided_impl_(file, data, rows, columns,
+        row_stride, column_stride, sep, report);
 
     /* Close file */
     fclose(file);
+    return count;
+}
+
+/*
+    Implementation for reading double-type data from a breakline-separated
+    lines and char-separated columns data file of known sizes, as given by
+    sepdat_get_sizes_impl_(), into an one-dimensional double-type array
+    following the row-major order.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns.
+    - rows, number of rows of the file.
+    - columns, number of columns of the file.
+    - sep, column separator.
+*/
+static inline void sepdat_read_impl_(const char *file_path,
+    double *data, size_t rows, size_t columns, char sep) {
+
+    sepdat_read_strided_impl_(file_path, data, rows, columns,
+        (ptrdiff_t)columns, 1, sep, NULL);
 }
 
 /*
@@ -96,41 +381,221 @@ static inline void sepdat_import_impl_(const char *file_path,
     double *data, char sep) {
 
     /* Count rows and columns */
-    int rows;
-    int columns;
-    sepdat_get_sizes_impl_(file_path, &rows, &columns, sep);
+    size_t rows;
+    size_t columns;
+    sepdat_get_sizes64_impl_(file_path, &rows, &columns, sep);
 
-    /* Open file */
-    FILE *file = fopen(file_path, "r");
-    if (!file) {
-        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " sepdat_import_impl_() ->"
-                        " Error in opening file: %s."
-                        " Exiting.", strerror(errno));
-        exit(EXIT_FAILURE);
-    }
-   
-    int i = 0, j = 0;
-    char buffer[128], fmt[32];
-    snprintf(fmt, sizeof(fmt), "%%127[^%c\n]", sep); /* "%127[^<sep>\n]" */
+    sepdat_read_impl_(file_path, data, rows, columns, sep);
+}
+
+/*
+    Implementation for importing double-type data from a breakline-separated
+    lines and char-separated columns data file into an one-dimensional
+    double-type array allocated by the library, following the row-major
+    order. The file is scanned once for its sizes and once for its values.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - allocator, allocator of the returned array, or NULL for malloc().
+    - sep, column separator.
+*/
+static inline double *sepdat_import_alloc_impl_(const char *file_path,
+    int *rows, int *columns, const dfl_allocator *allocator, char sep) {
+
+    size_t rows64, columns64;
+    sepdat_get_sizes64_impl_(file_path, &rows64, &columns64, sep);
+    *rows = size_to_int_impl_(rows64, "sepdat_import_alloc_impl_");
+    *columns = size_to_int_impl_(columns64, "sepdat_import_alloc_impl_");
+    double *data = (double *)dfl_allocate_impl_(allocator,
+        rows64 * columns64 * sizeof(double));
+    sepdat_read_impl_(file_path, data, rows64, columns64, sep);
+    return data;
+}
+
+/*
+    Implementation for importing double-type data from a breakline-separated
+    lines and char-separated columns data file into a double-type array with
+    arbitrary strides, e.g., following the column-major order or into a
+    sub-block of a larger array, without an intermediate copy.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array to output the value of row i and column j at
+    data[i*row_stride + j*column_stride], where the sizes may be obtained
+    through sepdat_get_sizes_impl_().
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+    - sep, column separator.
+*/
+static inline void sepdat_import_strided_impl_(const char *file_path,
+    double *data, ptrdiff_t row_stride, ptrdiff_t column_stride, char sep) {
+
+    size_t rows;
+    size_t columns;
+    sepdat_get_sizes64_impl_(file_path, &rows, &columns, sep);
+
+    sepdat_read_strided_impl_(file_path, data, rows, columns, row_stride,
+        column_stride, sep, NULL);
+}
+
+/*
+    Reads 'double complex'-type data from an opened breakline-separated
+    lines and char-separated columns data file of known sizes into a
+    'double complex'-type array, or into two double-type arrays of the real
+    and imaginary parts, with arbitrary strides. See
+    sepdat_read_cplx_strided_impl_().
+*/
+static inline int sepdat_read_file_cplx_strided_impl_(FILE *file,
+    tpdfcplx_impl_ *data, double *re, double *im, size_t rows,
+    size_t columns, ptrdiff_t row_stride, ptrdiff_t column_stride, char sep,
+    dfl_parse_report *report) {
+
+    size_t i = 0, j = 0;
+    int ch;
+    long long offset = 0, consumed;
+    size_t capacity = 128;
+    char *buffer = (char *)dfl_allocate_impl_(NULL, capacity);
+    if (report != NULL) report->count = 0;
 
     /* Read file */
-    while (fscanf(file, fmt, buffer) == 1) {
-        /* Parse and store */
-        data[j + columns*i] = parse_real_impl_(buffer);
-        /* Look ahead for separator */
-        int ch = fgetc(file);
+    while (i < rows) {
+        ch = sepdat_read_token_impl_(file, sep, &buffer, &capacity,
+            &consumed);
+        if (ch == EOF && consumed == 0 && j == 0) break;
+        if (j < columns) {
+            /* Parse and store, in one array or each part in its own */
+            int valid;
+            tpdfcplx_impl_ value = parse_complex_checked_impl_(buffer,
+                &valid);
+            ptrdiff_t k = (ptrdiff_t)i*row_stride + (ptrdiff_t)j*column_stride;
+            if (data != NULL) {
+                data[k] = value;
+            } else {
+                re[k] = creal_impl_(value);
+                im[k] = cimag_impl_(value);
+            }
+            if (!valid && report != NULL &&
+                sepdat_report_cell_impl_(report, (long long)i, (long long)j,
+                offset)) {
+                break;
+            }
+        }
+        offset += consumed;
+        /* Next column or row */
         if (ch == sep) {
             j++;
-        } else if (ch == '\n' || ch == EOF) {
+        } else {
             i++;
             j = 0;
+            if (ch == EOF) break;
         }
-        if (i == rows && j == columns ) break;
     }
+    free(buffer);
+    return report != NULL ? report->count : 0;
+}
+
+/*
+    Implementation for reading 'double complex'-type data from a
+    breakline-separated lines and char-separated columns data file of known
+    sizes, as given by sepdat_get_sizes_impl_(), into a
+    'double complex'-type array, or into two double-type arrays of the real
+    and imaginary parts, with arbitrary strides, i.e., the value of row i
+    and column j is stored at data[i*row_stride + j*column_stride]. Returns
+    the number of cells that are not numbers when a report is given,
+    otherwise 0.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, 'double complex'-type array to output the data, or NULL.
+    - re, double-type array to output the real parts, used if data is NULL.
+    - im, double-type array to output the imaginary parts, used if data is
+    NULL.
+    - rows, number of rows of the file.
+    - columns, number of columns of the file.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+    - sep, column separator.
+    - report, options and result of a checked import, or NULL.
+*/
+static inline int sepdat_read_cplx_strided_impl_(const char *file_path,
+    tpdfcplx_impl_ *data, double *re, double *im, size_t rows,
+    size_t columns, ptrdiff_t row_stride, ptrdiff_t column_stride, char sep,
+    dfl_parse_report *report) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "rb");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " sepdat_read_cplx_strided_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    int count = sepdat_read_file_cplx_strided_impl_(file, data, re, im, rows,
+        columns, row_stride, column_stride, sep, report);
 
     /* Close file */
     fclose(file);
+    return count;
+}
+
+/*
+    Implementation for reading double-type or 'double complex'-type data
+    from a breakline-separated lines and char-separated columns data file of
+    known sizes into an array with arbitrary strides, as
+    sepdat_read_strided_impl_(), without exiting on failure. Returns 0, or
+    the errno of the failure to open the file.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array to output the data, or NULL.
+    - data_cplx, 'double complex'-type array to output the data, used if
+    data is NULL.
+    - rows, number of rows of the file.
+    - columns, number of columns of the file.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+    - sep, column separator.
+*/
+static inline int sepdat_read_status_impl_(const char *file_path,
+    double *data, tpdfcplx_impl_ *data_cplx, size_t rows, size_t columns,
+    ptrdiff_t row_stride, ptrdiff_t column_stride, char sep) {
+
+    FILE *file = fopen(file_path, "rb");
+    if (!file) return errno != 0 ? errno : EIO;
+    if (data != NULL) {
+        sepdat_read_file_strided_impl_(file, data, rows, columns,
+            row_stride, column_stride, sep, NULL);
+    } else {
+        sepdat_read_file_cplx_strided_impl_(file, data_cplx, NULL, NULL,
+            rows, columns, row_stride, column_stride, sep, NULL);
+    }
+    fclose(file);
+    return 0;
+}
+
+/*
+    Implementation for reading 'double complex'-type data from a
+    breakline-separated lines and char-separated columns data file of known
+    sizes, as given by sepdat_get_sizes_impl_(), into an one-dimensional
+    'double complex'-type array following the row-major order.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns.
+    - rows, number of rows of the file.
+    - columns, number of columns of the file.
+    - sep, column separator.
+*/
+static inline void sepdat_read_cplx_impl_(const char *file_path,
+    tpdfcplx_impl_ *data, size_t rows, size_t columns, char sep) {
+
+    sepdat_read_cplx_strided_impl_(file_path, data, NULL, NULL, rows,
+        columns, (ptrdiff_t)columns, 1, sep, NULL);
 }
 
 /*
@@ -153,40 +618,210 @@ static inline void sepdat_import_impl_(const char *file_path,
 */
 static inline void sepdat_import_cplx_impl_(const char *file_path,
     tpdfcplx_impl_ *data, char sep) {
-    
+
     /* Count rows and columns */
-    int rows;
-    int columns;
-    sepdat_get_sizes_impl_(file_path, &rows, &columns, sep);
+    size_t rows;
+    size_t columns;
+    sepdat_get_sizes64_impl_(file_path, &rows, &columns, sep);
+
+    sepdat_read_cplx_impl_(file_path, data, rows, columns, sep);
+}
+
+/*
+    Implementation for importing double-type data from a breakline-separated
+    lines and char-separated columns data file, as sepdat_import_impl_(),
+    while recording the cells that are not numbers. The check is made as the
+    values are parsed, so that no second pass over the data is needed.
+    Returns the number of bad cells found.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    to output the data following the row-major order. In the strict mode,
+    the cells after the first bad cell are not written.
+    - report, options and result of the check.
+    - sep, column separator.
+*/
+static inline int sepdat_import_checked_impl_(const char *file_path,
+    double *data, dfl_parse_report *report, char sep) {
+
+    size_t rows;
+    size_t columns;
+    sepdat_get_sizes64_impl_(file_path, &rows, &columns, sep);
+
+    return sepdat_read_strided_impl_(file_path, data, rows, columns,
+        (ptrdiff_t)columns, 1, sep, report);
+}
+
+/*
+    Implementation for importing 'double complex'-type data from a
+    breakline-separated lines and char-separated columns data file, as
+    sepdat_import_cplx_impl_(), while recording the cells that are not
+    numbers. Returns the number of bad cells found.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional 'double complex'-type array of the size
+    rows*columns to output the data following the row-major order. In the
+    strict mode, the cells after the first bad cell are not written.
+    - report, options and result of the check.
+    - sep, column separator.
+*/
+static inline int sepdat_import_cplx_checked_impl_(const char *file_path,
+    tpdfcplx_impl_ *data, dfl_parse_report *report, char sep) {
+
+    size_t rows;
+    size_t columns;
+    sepdat_get_sizes64_impl_(file_path, &rows, &columns, sep);
+
+    return sepdat_read_cplx_strided_impl_(file_path, data, NULL, NULL, rows,
+        columns, (ptrdiff_t)columns, 1, sep, report);
+}
+
+/*
+    Implementation for importing 'double complex'-type data from a
+    breakline-separated lines and char-separated columns data file into an
+    one-dimensional 'double complex'-type array allocated by the library,
+    following the row-major order. The file is scanned once for its sizes
+    and once for its values.
+
+    Parameters:
+    - file_path, path to the file.
+    - &rows, to output the number of rows.
+    - &columns, to output the number of columns.
+    - allocator, allocator of the returned array, or NULL for malloc().
+    - sep, column separator.
+*/
+static inline tpdfcplx_impl_ *sepdat_import_cplx_alloc_impl_(
+    const char *file_path, int *rows, int *columns,
+    const dfl_allocator *allocator, char sep) {
+
+    size_t rows64, columns64;
+    sepdat_get_sizes64_impl_(file_path, &rows64, &columns64, sep);
+    *rows = size_to_int_impl_(rows64, "sepdat_import_cplx_alloc_impl_");
+    *columns = size_to_int_impl_(columns64, "sepdat_import_cplx_alloc_impl_");
+    tpdfcplx_impl_ *data = (tpdfcplx_impl_ *)dfl_allocate_impl_(allocator,
+        rows64 * columns64 * sizeof(tpdfcplx_impl_));
+    sepdat_read_cplx_impl_(file_path, data, rows64, columns64, sep);
+    return data;
+}
+
+/*
+    Implementation for importing 'double complex'-type data from a
+    breakline-separated lines and char-separated columns data file into a
+    'double complex'-type array with arbitrary strides.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, 'double complex'-type array to output the value of row i and
+    column j at data[i*row_stride + j*column_stride], where the sizes may be
+    obtained through sepdat_get_sizes_impl_().
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+    - sep, column separator.
+*/
+static inline void sepdat_import_cplx_strided_impl_(const char *file_path,
+    tpdfcplx_impl_ *data, ptrdiff_t row_stride, ptrdiff_t column_stride,
+    char sep) {
+
+    size_t rows;
+    size_t columns;
+    sepdat_get_sizes64_impl_(file_path, &rows, &columns, sep);
+
+    sepdat_read_cplx_strided_impl_(file_path, data, NULL, NULL, rows,
+        columns, row_stride, column_stride, sep, NULL);
+}
+
+/*
+    Implementation for importing 'double complex'-type data from a
+    breakline-separated lines and char-separated columns data file into two
+    double-type arrays, one with the real parts and one with the imaginary
+    parts, without an interleaved intermediate array.
+
+    Parameters:
+    - file_path, path to the file.
+    - re, one-dimensional double-type array of the size rows*columns to
+    output the real parts following the row-major order, where rows and
+    columns may be obtained through sepdat_get_sizes_impl_().
+    - im, one-dimensional double-type array of the size rows*columns to
+    output the imaginary parts following the row-major order.
+    - sep, column separator.
+*/
+static inline void sepdat_import_cplx_split_impl_(const char *file_path,
+    double *re, double *im, char sep) {
+
+    size_t rows;
+    size_t columns;
+    sepdat_get_sizes64_impl_(file_path, &rows, &columns, sep);
+
+    sepdat_read_cplx_strided_impl_(file_path, NULL, re, im, rows, columns,
+        (ptrdiff_t)columns, 1, sep, NULL);
+}
+
+/*
+    Writes double-type data of a double-type array with arbitrary strides to
+    an opened file, as breakline-separated lines and char-separated columns.
+
+    Parameters:
+    - file, the file.
+    - data, double-type array containing the value of row i and column j at
+    data[i*row_stride + j*column_stride].
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+    - sep, column separator.
+*/
+static inline void sepdat_write_strided_impl_(FILE *file,
+    const double *data, size_t rows, size_t columns, ptrdiff_t row_stride,
+    ptrdiff_t column_stride, char sep) {
+
+    char buf[128];
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < columns; j++) {
+            format_real_impl_(buf, sizeof(buf),
+                data[(ptrdiff_t)i*row_stride + (ptrdiff_t)j*column_stride]);
+            fputs(buf, file);
+            if (j + 1 < columns) {
+                fputc(sep, file);  /* Tab between columns */
+            }
+        }
+        fputc('\n', file);  /* Newline at end of row */
+    }
+}
+
+/*
+    Implementation for exporting double-type data of a double-type array
+    with arbitrary strides, e.g., following the column-major order or a
+    sub-block of a larger array, to a breakline-separated lines and
+    char-separated columns data file.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, double-type array containing the value of row i and column j at
+    data[i*row_stride + j*column_stride].
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+    - sep, column separator.
+*/
+static inline void sepdat_export_strided_impl_(const char *file_path,
+    const double *data, size_t rows, size_t columns, ptrdiff_t row_stride,
+    ptrdiff_t column_stride, char sep) {
 
     /* Open file */
-    FILE *file = fopen(file_path, "r");
+    FILE *file = fopen(file_path, "w");
     if (!file) {
         fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " sepdat_import_cplx_impl_() ->"
+                        " sepdat_export_strided_impl_() ->"
                         " Error in opening file: %s."
                         " Exiting.", strerror(errno));
         exit(EXIT_FAILURE);
     }
 
-    int i = 0, j = 0;
-    char buffer[128], fmt[32];
-    snprintf(fmt, sizeof(fmt), "%%127[^%c\n]", sep); /* "%127[^<sep>\n]" */
-    
-    /* Read file */
-    while (fscanf(file, fmt, buffer) == 1 ) {
-        /* Parse and store */
-        data[j + columns*i] = parse_complex_impl_(buffer);
-        /* Look ahead for separator */
-        int ch = fgetc(file);
-        if (ch == sep) {
-            j++;
-        } else if (ch == '\n' || ch == EOF) {
-            i++;
-            j = 0;
-        }
-        if (i == rows && j == columns ) break;
-    }
+    sepdat_write_strided_impl_(file, data, rows, columns, row_stride,
+        column_stride, sep);
 
     /* Close file */
     fclose(file);
@@ -208,27 +843,95 @@ static inline void sepdat_import_cplx_impl_(const char *file_path,
     - sep, column separator.
 */
 static inline void sepdat_export_impl_(const char *file_path,
-    const double *data, int rows, int columns, char sep) {
+    const double *data, size_t rows, size_t columns, char sep) {
+
+    sepdat_export_strided_impl_(file_path, data, rows, columns,
+        (ptrdiff_t)columns, 1, sep);
+}
+
+/*
+    Writes a complex value of the type a+bi to a file.
+
+    Parameters:
+    - file, the file.
+    - re, real part.
+    - im, imaginary part.
+*/
+static inline void sepdat_write_cplx_impl_(FILE *file, double re,
+    double im) {
+
+    char buf_re[128], buf_im[128];
+    format_real_impl_(buf_re, sizeof(buf_re), re);
+    format_real_impl_(buf_im, sizeof(buf_im), im);
+    /* Type a+bi, with explicit sign as in "%+.16e" */
+    fprintf(file, "%s%s%si", buf_re, buf_im[0] == '-' ? "" : "+", buf_im);
+}
+
+/*
+    Writes 'double complex'-type data of a 'double complex'-type array with
+    arbitrary strides to an opened file, as breakline-separated lines and
+    char-separated columns, with complex values of the type a+bi.
+
+    Parameters:
+    - file, the file.
+    - data, 'double complex'-type array containing the value of row i and
+    column j at data[i*row_stride + j*column_stride].
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+    - sep, column separator.
+*/
+static inline void sepdat_write_cplx_strided_impl_(FILE *file,
+    const tpdfcplx_impl_ *data, size_t rows, size_t columns,
+    ptrdiff_t row_stride, ptrdiff_t column_stride, char sep) {
+
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < columns; j++) {
+            tpdfcplx_impl_ value =
+                data[(ptrdiff_t)i*row_stride + (ptrdiff_t)j*column_stride];
+            sepdat_write_cplx_impl_(file, creal_impl_(value),
+                cimag_impl_(value));
+            if (j + 1 < columns) {
+                fputc(sep, file);  /* Tab between columns */
+            }
+        }
+        fputc('\n', file);  /* Newline at end of row */
+    }
+}
+
+/*
+    Implementation for exporting 'double complex'-type data of a
+    'double complex'-type array with arbitrary strides to a
+    breakline-separated lines and char-separated columns data file. The
+    exported complex values are of the type a+bi.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, 'double complex'-type array containing the value of row i and
+    column j at data[i*row_stride + j*column_stride].
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - row_stride, distance in elements between two consecutive rows.
+    - column_stride, distance in elements between two consecutive columns.
+    - sep, column separator.
+*/
+static inline void sepdat_export_cplx_strided_impl_(const char *file_path,
+    const tpdfcplx_impl_ *data, size_t rows, size_t columns,
+    ptrdiff_t row_stride, ptrdiff_t column_stride, char sep) {
 
     /* Open file */
     FILE *file = fopen(file_path, "w");
     if (!file) {
         fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " sepdat_export_impl_() ->"
+                        " sepdat_export_cplx_strided_impl_() ->"
                         " Error in opening file: %s."
                         " Exiting.", strerror(errno));
         exit(EXIT_FAILURE);
     }
 
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < columns; j++) {
-            fprintf(file, "%.16e", data[j + columns*i]);
-            if (j < columns - 1) {
-                fputc(sep, file);  /* Tab between columns */
-            }
-        }
-        fputc('\n', file);  /* Newline at end of row */
-    }
+    sepdat_write_cplx_strided_impl_(file, data, rows, columns, row_stride,
+        column_stride, sep);
 
     /* Close file */
     fclose(file);
@@ -251,24 +954,49 @@ static inline void sepdat_export_impl_(const char *file_path,
     - sep, column separator.
 */
 static inline void sepdat_export_cplx_impl_(const char *file_path,
-    const tpdfcplx_impl_ *data, int rows, int columns, char sep) {
+    const tpdfcplx_impl_ *data, size_t rows, size_t columns, char sep) {
+
+    sepdat_export_cplx_strided_impl_(file_path, data, rows, columns,
+        (ptrdiff_t)columns, 1, sep);
+}
+
+/*
+    Implementation for exporting 'double complex'-type data given by two
+    double-type arrays, one with the real parts and one with the imaginary
+    parts, following the row-major order, to a breakline-separated lines and
+    char-separated columns data file, without an interleaved intermediate
+    array. The exported complex values are of the type a+bi.
+
+    Parameters:
+    - file_path, path to the file.
+    - re, one-dimensional double-type array of the size rows*columns
+    containing the real parts, accessed through re[j + columns*i].
+    - im, one-dimensional double-type array of the size rows*columns
+    containing the imaginary parts, accessed through im[j + columns*i].
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - sep, column separator.
+*/
+static inline void sepdat_export_cplx_split_impl_(const char *file_path,
+    const double *re, const double *im, size_t rows, size_t columns,
+    char sep) {
 
     /* Open file */
     FILE *file = fopen(file_path, "w");
     if (!file) {
         fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " sepdat_export_cplx_impl_() ->"
+                        " sepdat_export_cplx_split_impl_() ->"
                         " Error in opening file: %s."
                         " Exiting.", strerror(errno));
         exit(EXIT_FAILURE);
     }
 
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < columns; j++) {
-            fprintf(file, "%.16e%+.16ei", creal(data[j + columns*i]),
-                    cimag(data[j + columns*i]));
-            if (j < columns - 1) {
-                fputc(sep, file);  /* Tab between columns */
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < columns; j++) {
+            sepdat_write_cplx_impl_(file, re[j + columns*i],
+                im[j + columns*i]);
+            if (j + 1 < columns) {
+                fputc(sep, file);
             }
         }
         fputc('\n', file);  /* Newline at end of row */
@@ -278,4 +1006,43 @@ static inline void sepdat_export_cplx_impl_(const char *file_path,
     fclose(file);
 }
 
+/*
+    Implementation for exporting double-type or 'double complex'-type data
+    of an one-dimensional array, following the row-major order, to a
+    breakline-separated lines and char-separated columns data file through a
+    file of the direct exports (see direct_impl_.h), preallocated with an
+    upper bound of its size, i.e., 25 bytes per real value and 50 bytes per
+    complex value. Returns 0, or the errno of the failure to open or write
+    the file.
+
+    Parameters:
+    - file_path, path to the file.
+    - data, one-dimensional double-type array of the size rows*columns
+    containing the data, or NULL.
+    - data_cplx, one-dimensional 'double complex'-type array of the size
+    rows*columns containing the data, used if data is NULL.
+    - rows, number of rows of the data.
+    - columns, number of columns of the data.
+    - sep, column separator.
+*/
+static inline int sepdat_export_direct_impl_(const char *file_path,
+    const double *data, const tpdfcplx_impl_ *data_cplx, size_t rows,
+    size_t columns, char sep) {
+
+    /* At most 24 chars per "%.16e" number, plus a separator */
+    long long estimate = (long long)(rows*columns) *
+        (data != NULL ? 25 : 50);
+    FILE *file = direct_fopen_impl_(file_path, estimate);
+    if (!file) return errno != 0 ? errno : EIO;
+
+    if (data != NULL) {
+        sepdat_write_strided_impl_(file, data, rows, columns,
+            (ptrdiff_t)columns, 1, sep);
+    } else {
+        sepdat_write_cplx_strided_impl_(file, data_cplx, rows, columns,
+            (ptrdiff_t)columns, 1, sep);
+    }
+    return direct_fclose_impl_(file);
+}
+
 #endif /* DATA_FILE_LIBRARY_SEPDAT_IMPL_H */
\ No newline at end of file
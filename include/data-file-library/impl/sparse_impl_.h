@@ -0,0 +1,799 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/sparse_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of sparse arrays in the coordinate (COO) form, of
+        their conversion to the compressed sparse row (CSR) form, and of
+        the imports and exports of the Wolfram Language SparseArray
+        expressions, which never store the dense array. The imports read
+        both the rule form, SparseArray[{{i1, ..., iN} -> v, ...}, dims],
+        and the form written by Put[] and InputForm, SparseArray[Automatic,
+        dims, background, {1, {offsets, indices}, values}].
+*/
+
+#ifndef DATA_FILE_LIBRARY_SPARSE_IMPL_H
+#define DATA_FILE_LIBRARY_SPARSE_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For strtoll() and EXIT_FAILURE */
+#include <string.h> /* For memcpy(), memset(), strcmp() and strerror() */
+#include <errno.h> /* For errno */
+#include <ctype.h> /* For isspace() */
+#include <limits.h> /* For INT_MAX */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "parse_impl_.h"
+#include "wldat_impl_.h"
+
+/*
+    Sparse array of N dimensions in the coordinate (COO) form.
+    - dimensions, number N of dimensions.
+    - size, array of size N with the size of each dimension.
+    - count, number of explicit values.
+    - indices, array of count*N zero-based indices, where those of the k-th
+    value are indices[k*N], ..., indices[k*N + N - 1].
+    - values, array of the count real values, or NULL.
+    - values_cplx, array of the count complex values, or NULL.
+    - background, value of the other elements, usually 0.
+*/
+typedef struct dfl_sparse {
+    int dimensions;
+    int *size;
+    long long count;
+    int *indices;
+    double *values;
+    tpdfcplx_impl_ *values_cplx;
+    double background;
+} dfl_sparse;
+
+/* Tokens of the Wolfram Language expressions, besides {}[], */
+#define DFL_WL_TOKEN_END_IMPL_ 0
+#define DFL_WL_TOKEN_RULE_IMPL_ 'R'
+#define DFL_WL_TOKEN_TEXT_IMPL_ 'T'
+
+/*
+    Reader of the tokens of a Wolfram Language expression, whose text
+    buffer, allocated with malloc() of size capacity, grows as needed.
+*/
+typedef struct {
+    FILE *file;
+    int rule;
+    char *text;
+    size_t capacity;
+} wl_lexer_impl_;
+
+/*
+    Values of a sparse array while they are read.
+*/
+typedef struct {
+    int cplx;
+    int dimensions;
+    long long count;
+    long long capacity;
+    int *indices;
+    double *values;
+} sparse_builder_impl_;
+
+/*
+    Reads the next token of a Wolfram Language expression, skipping the
+    blanks and comments. Returns one of the characters {}[], for
+    themselves, DFL_WL_TOKEN_RULE_IMPL_ for ->, DFL_WL_TOKEN_TEXT_IMPL_ for
+    a number or a symbol, whose text is stored in the lexer, or
+    DFL_WL_TOKEN_END_IMPL_ at the end of the file.
+
+    Parameter:
+    - lexer, the lexer.
+*/
+static inline int wl_next_token_impl_(wl_lexer_impl_ *lexer) {
+    if (lexer->rule) {
+        lexer->rule = 0;
+        return DFL_WL_TOKEN_RULE_IMPL_;
+    }
+
+    int ch;
+    int next;
+    for (;;) {
+        do { ch = getc(lexer->file); } while (ch != EOF && isspace(ch));
+        if (ch != '(') break;
+        next = getc(lexer->file);
+        if (next != '*') {
+            if (next != EOF) ungetc(next, lexer->file);
+            break;
+        }
+        /* Skip a comment */
+        int prev = 0;
+        while ((ch = getc(lexer->file)) != EOF &&
+            !(prev == '*' && ch == ')')) {
+            prev = ch;
+        }
+        if (ch == EOF) return DFL_WL_TOKEN_END_IMPL_;
+    }
+    if (ch == EOF) return DFL_WL_TOKEN_END_IMPL_;
+    if (ch == '{' || ch == '}' || ch == '[' || ch == ']' || ch == ',') {
+        return ch;
+    }
+
+    /* Text, until a delimiter or a rule */
+    size_t n = 0;
+    while (ch != EOF) {
+        if (ch == '{' || ch == '}' || ch == '[' || ch == ']' || ch == ',') {
+            ungetc(ch, lexer->file);
+            break;
+        }
+        if (ch == '-') {
+            next = getc(lexer->file);
+            if (next == '>') {
+                lexer->rule = 1;
+                break;
+            }
+            if (next != EOF) ungetc(next, lexer->file);
+        }
+        if (n + 1 == lexer->capacity) {
+            buffer_grow_impl_(&lexer->text, &lexer->capacity,
+                "wl_next_token_impl_");
+        }
+        lexer->text[n++] = (char)ch;
+        ch = getc(lexer->file);
+    }
+    while (n > 0 && isspace((unsigned char)lexer->text[n - 1])) n--;
+    lexer->text[n] = '\0';
+    if (n == 0) return wl_next_token_impl_(lexer);
+    return DFL_WL_TOKEN_TEXT_IMPL_;
+}
+
+/*
+    Parses the text of the last token as an integer. Returns 1 if it is an
+    integer, otherwise 0.
+
+    Parameters:
+    - lexer, the lexer.
+    - value, to output the integer.
+*/
+static inline int wl_text_integer_impl_(const wl_lexer_impl_ *lexer,
+    long long *value) {
+
+    char *end;
+    *value = strtoll(lexer->text, &end, 10);
+    return end != lexer->text && *end == '\0';
+}
+
+/*
+    Reads a list of at most max integers after its opening brace. Returns
+    their number, or -1 if it is not such a list.
+
+    Parameters:
+    - lexer, the lexer.
+    - values, array of size max to output the integers.
+    - max, size of values.
+*/
+static inline int wl_read_integers_impl_(wl_lexer_impl_ *lexer,
+    long long *values, int max) {
+
+    int count = 0;
+    int token = wl_next_token_impl_(lexer);
+    if (token == '}') return 0;
+    for (;;) {
+        if (token != DFL_WL_TOKEN_TEXT_IMPL_ || count == max ||
+            !wl_text_integer_impl_(lexer, &values[count])) {
+            return -1;
+        }
+        count++;
+        token = wl_next_token_impl_(lexer);
+        if (token == '}') return count;
+        if (token != ',') return -1;
+        token = wl_next_token_impl_(lexer);
+    }
+}
+
+/*
+    Reads a list of any number of integers after its opening brace into an
+    array allocated here, to be released with free(). Returns their number,
+    or -1 if it is not such a list.
+
+    Parameters:
+    - lexer, the lexer.
+    - values, to output the array.
+*/
+static inline long long wl_read_integer_list_impl_(wl_lexer_impl_ *lexer,
+    long long **values) {
+
+    long long count = 0;
+    long long capacity = 1024;
+    *values = (long long *)dfl_allocate_impl_(NULL,
+        (size_t)capacity * sizeof(long long));
+    int token = wl_next_token_impl_(lexer);
+    if (token == '}') return 0;
+    for (;;) {
+        if (count == capacity) {
+            long long *grown = (long long *)dfl_allocate_impl_(NULL,
+                (size_t)(2*capacity) * sizeof(long long));
+            memcpy(grown, *values, (size_t)count * sizeof(long long));
+            free(*values);
+            *values = grown;
+            capacity *= 2;
+        }
+        if (token != DFL_WL_TOKEN_TEXT_IMPL_ ||
+            !wl_text_integer_impl_(lexer, &(*values)[count])) {
+            return -1;
+        }
+        count++;
+        token = wl_next_token_impl_(lexer);
+        if (token == '}') return count;
+        if (token != ',') return -1;
+        token = wl_next_token_impl_(lexer);
+    }
+}
+
+/*
+    Appends a value to a builder, with its indices and a zero value.
+    Returns 0, or EINVAL if the number of indices differs from the previous
+    values or an index is not a positive int.
+
+    Parameters:
+    - builder, the builder.
+    - position, array of the one-based indices.
+    - n, number of indices.
+    - offset, index of the builder where the indices start.
+*/
+static inline int sparse_builder_add_impl_(sparse_builder_impl_ *builder,
+    const long long *position, int n, int offset) {
+
+    if (builder->dimensions < 0) builder->dimensions = n + offset;
+    if (n + offset != builder->dimensions) return EINVAL;
+    if (builder->count == builder->capacity) {
+        long long capacity = builder->capacity > 0 ?
+            2*builder->capacity : 1024;
+        size_t per_value = builder->cplx ? 2 : 1;
+        int *indices = (int *)dfl_allocate_impl_(NULL,
+            (size_t)capacity * (size_t)builder->dimensions * sizeof(int));
+        double *values = (double *)dfl_allocate_impl_(NULL,
+            (size_t)capacity * per_value * sizeof(double));
+        if (builder->count > 0) {
+            memcpy(indices, builder->indices, (size_t)builder->count *
+                (size_t)builder->dimensions * sizeof(int));
+            memcpy(values, builder->values, (size_t)builder->count *
+                per_value * sizeof(double));
+        }
+        free(builder->indices);
+        free(builder->values);
+        builder->indices = indices;
+        builder->values = values;
+        builder->capacity = capacity;
+    }
+
+    int *indices = builder->indices +
+        (size_t)builder->count * (size_t)builder->dimensions;
+    for (int d = 0; d < n; d++) {
+        if (position[d] < 1 || position[d] > INT_MAX) return EINVAL;
+        indices[offset + d] = (int)(position[d] - 1);
+    }
+    for (int d = 0; d < offset; d++) {
+        indices[d] = 0;
+    }
+    if (builder->cplx) {
+        builder->values[2*builder->count] = 0.0;
+        builder->values[2*builder->count + 1] = 0.0;
+    } else {
+        builder->values[builder->count] = 0.0;
+    }
+    builder->count++;
+    return 0;
+}
+
+/*
+    Parses the text of the last token as a value. Returns 1 if it is a
+    number, otherwise 0.
+
+    Parameters:
+    - lexer, the lexer.
+    - cplx, whether the value is complex.
+    - value, array of 1 or 2 (if complex) doubles to output the value.
+*/
+static inline int wl_text_value_impl_(wl_lexer_impl_ *lexer, int cplx,
+    double *value) {
+
+    int valid;
+    if (cplx) {
+        tpdfcplx_impl_ z = parse_complex_checked_impl_(lexer->text, &valid);
+        value[0] = creal_impl_(z);
+        value[1] = cimag_impl_(z);
+    } else {
+        value[0] = parse_real_checked_impl_(lexer->text, &valid);
+    }
+    return valid;
+}
+
+/*
+    Reads the next token as the k-th value of a builder. Returns 0, or
+    EINVAL if it is not a number.
+
+    Parameters:
+    - lexer, the lexer.
+    - builder, the builder.
+    - k, index of the value.
+*/
+static inline int sparse_builder_value_impl_(wl_lexer_impl_ *lexer,
+    sparse_builder_impl_ *builder, long long k) {
+
+    if (wl_next_token_impl_(lexer) != DFL_WL_TOKEN_TEXT_IMPL_ ||
+        !wl_text_value_impl_(lexer, builder->cplx,
+        builder->values + (builder->cplx ? 2*k : k))) {
+        return EINVAL;
+    }
+    return 0;
+}
+
+/*
+    Reads the rules of the rule form of a SparseArray, after the opening
+    brace of its first argument, i.e., {{i1, ...} -> v, ...} or
+    {{i1, ...}, ...} -> {v, ...}. Returns 0, or EINVAL on a syntax error.
+
+    Parameters:
+    - lexer, the lexer.
+    - builder, the builder.
+*/
+static inline int wldat_read_sparse_rules_impl_(wl_lexer_impl_ *lexer,
+    sparse_builder_impl_ *builder) {
+
+    long long position[128];
+    int token = wl_next_token_impl_(lexer);
+    if (token == '}') return 0;
+    if (token != '{') return EINVAL;
+    int n = wl_read_integers_impl_(lexer, position, 128);
+    if (n < 1 || sparse_builder_add_impl_(builder, position, n, 0) != 0) {
+        return EINVAL;
+    }
+
+    token = wl_next_token_impl_(lexer);
+    if (token == DFL_WL_TOKEN_RULE_IMPL_) {
+        /* List of rules, {i1, ...} -> v */
+        for (;;) {
+            if (sparse_builder_value_impl_(lexer, builder,
+                builder->count - 1) != 0) {
+                return EINVAL;
+            }
+            token = wl_next_token_impl_(lexer);
+            if (token == '}') return 0;
+            if (token != ',' || wl_next_token_impl_(lexer) != '{') {
+                return EINVAL;
+            }
+            n = wl_read_integers_impl_(lexer, position, 128);
+            if (n < 1 ||
+                sparse_builder_add_impl_(builder, position, n, 0) != 0 ||
+                wl_next_token_impl_(lexer) != DFL_WL_TOKEN_RULE_IMPL_) {
+                return EINVAL;
+            }
+        }
+    }
+
+    /* List of positions, followed by a list of values or a single value */
+    while (token == ',') {
+        if (wl_next_token_impl_(lexer) != '{') return EINVAL;
+        n = wl_read_integers_impl_(lexer, position, 128);
+        if (n < 1 || sparse_builder_add_impl_(builder, position, n, 0) != 0) {
+            return EINVAL;
+        }
+        token = wl_next_token_impl_(lexer);
+    }
+    if (token != '}' ||
+        wl_next_token_impl_(lexer) != DFL_WL_TOKEN_RULE_IMPL_) {
+        return EINVAL;
+    }
+    token = wl_next_token_impl_(lexer);
+    if (token == DFL_WL_TOKEN_TEXT_IMPL_) {
+        double value[2];
+        if (!wl_text_value_impl_(lexer, builder->cplx, value)) return EINVAL;
+        for (long long k = 0; k < builder->count; k++) {
+            if (builder->cplx) {
+                builder->values[2*k] = value[0];
+                builder->values[2*k + 1] = value[1];
+            } else {
+                builder->values[k] = value[0];
+            }
+        }
+        return 0;
+    }
+    if (token != '{') return EINVAL;
+    for (long long k = 0; k < builder->count; k++) {
+        if (sparse_builder_value_impl_(lexer, builder, k) != 0) return EINVAL;
+        token = wl_next_token_impl_(lexer);
+        if (token != (k + 1 < builder->count ? ',' : '}')) return EINVAL;
+    }
+    return 0;
+}
+
+/*
+    Reads the Automatic form of a SparseArray after its first comma, i.e.,
+    dims, background, {1, {offsets, indices}, values}], where the k-th
+    value lies on the row r of the first dimension for offsets[r] <= k <
+    offsets[r + 1], and indices lists the other indices of each value (all
+    of them for one-dimensional arrays). Returns 0, or EINVAL on a syntax
+    error.
+
+    Parameters:
+    - lexer, the lexer.
+    - builder, the builder.
+    - size, array of 128 to output the size of each dimension.
+    - background, array of 1 or 2 (if complex) doubles to output the
+    background.
+*/
+static inline int wldat_read_sparse_automatic_impl_(wl_lexer_impl_ *lexer,
+    sparse_builder_impl_ *builder, long long *size, double *background) {
+
+    if (wl_next_token_impl_(lexer) != '{') return EINVAL;
+    int dimensions = wl_read_integers_impl_(lexer, size, 128);
+    if (dimensions < 1 || wl_next_token_impl_(lexer) != ',' ||
+        wl_next_token_impl_(lexer) != DFL_WL_TOKEN_TEXT_IMPL_ ||
+        !wl_text_value_impl_(lexer, builder->cplx, background) ||
+        wl_next_token_impl_(lexer) != ',' ||
+        wl_next_token_impl_(lexer) != '{' ||
+        wl_next_token_impl_(lexer) != DFL_WL_TOKEN_TEXT_IMPL_ ||
+        wl_next_token_impl_(lexer) != ',' ||
+        wl_next_token_impl_(lexer) != '{' ||
+        wl_next_token_impl_(lexer) != '{') {
+        return EINVAL;
+    }
+    builder->dimensions = dimensions;
+
+    /* Row offsets */
+    long long *offsets;
+    long long rows = wl_read_integer_list_impl_(lexer, &offsets);
+    int status = rows < 2 || wl_next_token_impl_(lexer) != ',' ||
+        wl_next_token_impl_(lexer) != '{' ? EINVAL : 0;
+
+    /* Other indices of each value */
+    int n = dimensions > 1 ? dimensions - 1 : 1;
+    int token = status == 0 ? wl_next_token_impl_(lexer) : 0;
+    if (status == 0 && token != '}') {
+        long long position[128];
+        for (;;) {
+            if (token != '{' ||
+                wl_read_integers_impl_(lexer, position, 128) != n ||
+                sparse_builder_add_impl_(builder, position, n,
+                dimensions - n) != 0) {
+                status = EINVAL;
+                break;
+            }
+            token = wl_next_token_impl_(lexer);
+            if (token == '}') break;
+            if (token != ',') {
+                status = EINVAL;
+                break;
+            }
+            token = wl_next_token_impl_(lexer);
+        }
+    }
+
+    /* Rows of the values, from the offsets */
+    if (status == 0 && (offsets[0] != 0 || offsets[rows - 1] !=
+        builder->count || (dimensions > 1 && rows - 1 != size[0]))) {
+        status = EINVAL;
+    }
+    for (long long r = 0; status == 0 && r + 1 < rows; r++) {
+        if (offsets[r + 1] < offsets[r]) {
+            status = EINVAL;
+            break;
+        }
+        for (long long k = offsets[r]; dimensions > 1 && k < offsets[r + 1];
+            k++) {
+            builder->indices[k*dimensions] = (int)r;
+        }
+    }
+    free(offsets);
+    if (status != 0) return status;
+
+    /* Values */
+    if (wl_next_token_impl_(lexer) != '}' ||
+        wl_next_token_impl_(lexer) != ',' ||
+        wl_next_token_impl_(lexer) != '{') {
+        return EINVAL;
+    }
+    if (builder->count == 0) {
+        if (wl_next_token_impl_(lexer) != '}') return EINVAL;
+    }
+    for (long long k = 0; k < builder->count; k++) {
+        if (sparse_builder_value_impl_(lexer, builder, k) != 0) return EINVAL;
+        token = wl_next_token_impl_(lexer);
+        if (token != (k + 1 < builder->count ? ',' : '}')) return EINVAL;
+    }
+    if (wl_next_token_impl_(lexer) != '}' ||
+        wl_next_token_impl_(lexer) != ']') {
+        return EINVAL;
+    }
+    return 0;
+}
+
+/*
+    Implementation for importing a SparseArray of a Wolfram Language
+    package source format into a sparse array in the coordinate form,
+    without storing the dense array. Returns 0 on success, the errno of the
+    failure to open the file, or EINVAL if it is not a SparseArray of
+    numbers.
+
+    Parameters:
+    - file_path, path to the data file.
+    - sparse, to output the sparse array, whose arrays are allocated by the
+    library and released with dfl_sparse_free().
+    - allocator, allocator of the arrays, or NULL for malloc().
+    - cplx, whether the values are complex numbers.
+*/
+static inline int wldat_import_sparse_impl_(const char *file_path,
+    dfl_sparse *sparse, const dfl_allocator *allocator, int cplx) {
+
+    memset(sparse, 0, sizeof(dfl_sparse));
+
+    /* Open file */
+    FILE *file = fopen(file_path, "r");
+    if (!file) return errno != 0 ? errno : EIO;
+
+    wl_lexer_impl_ lexer;
+    lexer.file = file;
+    lexer.rule = 0;
+    lexer.capacity = 128;
+    lexer.text = (char *)dfl_allocate_impl_(NULL, lexer.capacity);
+    lexer.text[0] = '\0';
+    sparse_builder_impl_ builder;
+    memset(&builder, 0, sizeof(builder));
+    builder.cplx = cplx;
+    builder.dimensions = -1;
+    long long size[128];
+    double background[2] = {0.0, 0.0};
+    int has_size = 0;
+    int status = EINVAL;
+
+    if (wl_next_token_impl_(&lexer) == DFL_WL_TOKEN_TEXT_IMPL_ &&
+        strcmp(lexer.text, "SparseArray") == 0 &&
+        wl_next_token_impl_(&lexer) == '[') {
+        int token = wl_next_token_impl_(&lexer);
+        if (token == DFL_WL_TOKEN_TEXT_IMPL_ &&
+            strcmp(lexer.text, "Automatic") == 0) {
+            if (wl_next_token_impl_(&lexer) == ',') {
+                status = wldat_read_sparse_automatic_impl_(&lexer, &builder,
+                    size, background);
+                has_size = 1;
+            }
+        } else if (token == '{') {
+            /* Rule form, with optional dims and background */
+            status = wldat_read_sparse_rules_impl_(&lexer, &builder);
+            token = status == 0 ? wl_next_token_impl_(&lexer) : 0;
+            if (token == ',') {
+                int n = wl_next_token_impl_(&lexer) == '{' ?
+                    wl_read_integers_impl_(&lexer, size, 128) : -1;
+                if (builder.dimensions < 0) builder.dimensions = n;
+                has_size = 1;
+                token = n >= 1 && n == builder.dimensions ?
+                    wl_next_token_impl_(&lexer) : 0;
+                if (token == ',') {
+                    token = wl_next_token_impl_(&lexer) ==
+                        DFL_WL_TOKEN_TEXT_IMPL_ &&
+                        wl_text_value_impl_(&lexer, cplx, background) ?
+                        wl_next_token_impl_(&lexer) : 0;
+                }
+            }
+            if (token != ']') status = EINVAL;
+        }
+    }
+    free(lexer.text);
+
+    /* Close file */
+    fclose(file);
+
+    /* Sizes, from the largest indices if not given */
+    if (status == 0 && builder.dimensions < 1) status = EINVAL;
+    for (int d = 0; status == 0 && d < builder.dimensions; d++) {
+        if (!has_size) size[d] = 0;
+        for (long long k = 0; k < builder.count; k++) {
+            long long index = builder.indices[k*builder.dimensions + d];
+            if (!has_size && index + 1 > size[d]) size[d] = index + 1;
+            if (index >= size[d]) status = EINVAL;
+        }
+        if (size[d] < 0 || size[d] > INT_MAX) status = EINVAL;
+    }
+    if (status == 0 && cplx && background[1] != 0.0) status = EINVAL;
+
+    if (status == 0) {
+        size_t count = (size_t)builder.count;
+        size_t dimensions = (size_t)builder.dimensions;
+        sparse->dimensions = builder.dimensions;
+        sparse->count = builder.count;
+        sparse->background = background[0];
+        sparse->size = (int *)dfl_allocate_impl_(allocator,
+            dimensions * sizeof(int));
+        for (int d = 0; d < builder.dimensions; d++) {
+            sparse->size[d] = (int)size[d];
+        }
+        sparse->indices = (int *)dfl_allocate_impl_(allocator,
+            count * dimensions * sizeof(int));
+        if (count > 0) {
+            memcpy(sparse->indices, builder.indices,
+                count * dimensions * sizeof(int));
+        }
+        if (cplx) {
+            sparse->values_cplx = (tpdfcplx_impl_ *)dfl_allocate_impl_(
+                allocator, count * sizeof(tpdfcplx_impl_));
+            for (size_t k = 0; k < count; k++) {
+                sparse->values_cplx[k] = builder.values[2*k] +
+                    I_IMPL_ * builder.values[2*k + 1];
+            }
+        } else {
+            sparse->values = (double *)dfl_allocate_impl_(allocator,
+                count * sizeof(double));
+            if (count > 0) {
+                memcpy(sparse->values, builder.values,
+                    count * sizeof(double));
+            }
+        }
+    }
+    free(builder.indices);
+    free(builder.values);
+    return status;
+}
+
+/*
+    Implementation for exporting a sparse array in the coordinate form to
+    a Wolfram Language package source format, as the rule form of a
+    SparseArray, SparseArray[{{i1, ..., iN} -> v, ...}, dims], with the
+    background as a third argument when it is not 0.
+
+    Parameters:
+    - file_path, path to the data file.
+    - sparse, the sparse array, whose values or values_cplx are written.
+    - comment, text to be stored at the very first line of the file.
+    - cplx, whether the values are complex numbers.
+*/
+static inline void wldat_export_sparse_impl_(const char *file_path,
+    const dfl_sparse *sparse, const char *comment, int cplx) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "w");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_export_sparse_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    if (comment == NULL || comment[0] == '\0' ) {
+        fprintf(file, "(* Created with Data File Library:"
+            " <https://github.com/jodesarro/data-file-library> *)\n");
+    } else {
+        fprintf(file, "(* %s *)\n", comment);
+    }
+
+    int n = sparse->dimensions;
+    char buf[128];
+    fprintf(file, "SparseArray[{");
+    for (long long k = 0; k < sparse->count; k++) {
+        fputs(k > 0 ? ", {" : "{", file);
+        for (int d = 0; d < n; d++) {
+            fprintf(file, d > 0 ? ", %d" : "%d",
+                sparse->indices[k*n + d] + 1);
+        }
+        fputs("} -> ", file);
+        if (cplx) {
+            wldat_write_cplx_impl_(file, creal_impl_(sparse->values_cplx[k]),
+                cimag_impl_(sparse->values_cplx[k]), NULL);
+        } else {
+            wldat_format_real_impl_(buf, sizeof(buf), sparse->values[k],
+                NULL);
+            fputs(buf, file);
+        }
+    }
+    fprintf(file, "}, {");
+    for (int d = 0; d < n; d++) {
+        fprintf(file, d > 0 ? ", %d" : "%d", sparse->size[d]);
+    }
+    fprintf(file, "}");
+    if (sparse->background != 0.0) {
+        wldat_format_real_impl_(buf, sizeof(buf), sparse->background, NULL);
+        fprintf(file, ", %s", buf);
+    }
+    fprintf(file, "]\n");
+
+    /* Close file */
+    fclose(file);
+}
+
+/*
+    Implementation for converting a two-dimensional sparse array in the
+    coordinate form to the compressed sparse row (CSR) form, by two stable
+    counting sorts, so that the values of each row are sorted by column and
+    repeated positions stay in their order. Returns 0, or EINVAL if the
+    array is not two-dimensional or lacks the values of the given type.
+
+    Parameters:
+    - sparse, the sparse array.
+    - row_offsets, array of size[0] + 1 to output the offsets of the rows,
+    where the values of the row r are those from row_offsets[r] to
+    row_offsets[r + 1] - 1.
+    - column_indices, array of count to output the column of each value.
+    - values, array of count doubles, or of count complex doubles if cplx,
+    to output the values.
+    - cplx, whether the values are complex numbers.
+*/
+static inline int dfl_sparse_to_csr_impl_(const dfl_sparse *sparse,
+    long long *row_offsets, int *column_indices, void *values, int cplx) {
+
+    if (sparse->dimensions != 2 ||
+        (cplx ? sparse->values_cplx == NULL : sparse->values == NULL)) {
+        return EINVAL;
+    }
+    size_t rows = (size_t)sparse->size[0];
+    size_t columns = (size_t)sparse->size[1];
+    size_t count = (size_t)sparse->count;
+    const int *indices = sparse->indices;
+
+    /* Sort by column */
+    size_t *next = (size_t *)dfl_allocate_impl_(NULL,
+        (columns > rows ? columns : rows) * sizeof(size_t));
+    size_t *by_column = (size_t *)dfl_allocate_impl_(NULL,
+        count * sizeof(size_t));
+    memset(next, 0, columns * sizeof(size_t));
+    for (size_t k = 0; k < count; k++) {
+        next[indices[2*k + 1]]++;
+    }
+    size_t total = 0;
+    for (size_t j = 0; j < columns; j++) {
+        size_t c = next[j];
+        next[j] = total;
+        total += c;
+    }
+    for (size_t k = 0; k < count; k++) {
+        by_column[next[indices[2*k + 1]]++] = k;
+    }
+
+    /* Then by row */
+    memset(row_offsets, 0, (rows + 1) * sizeof(long long));
+    for (size_t k = 0; k < count; k++) {
+        row_offsets[indices[2*k] + 1]++;
+    }
+    for (size_t i = 0; i < rows; i++) {
+        row_offsets[i + 1] += row_offsets[i];
+        next[i] = (size_t)row_offsets[i];
+    }
+    for (size_t s = 0; s < count; s++) {
+        size_t k = by_column[s];
+        size_t p = next[indices[2*k]]++;
+        column_indices[p] = indices[2*k + 1];
+        if (cplx) {
+            ((tpdfcplx_impl_ *)values)[p] = sparse->values_cplx[k];
+        } else {
+            ((double *)values)[p] = sparse->values[k];
+        }
+    }
+
+    free(by_column);
+    free(next);
+    return 0;
+}
+
+/*
+    Implementation for releasing the arrays of a sparse array output by an
+    import.
+
+    Parameters:
+    - sparse, the sparse array, whose pointers are reset.
+    - allocator, allocator given to the import, or NULL.
+*/
+static inline void dfl_sparse_free_impl_(dfl_sparse *sparse,
+    const dfl_allocator *allocator) {
+
+    dfl_free_impl_(allocator, sparse->size);
+    dfl_free_impl_(allocator, sparse->indices);
+    dfl_free_impl_(allocator, sparse->values);
+    dfl_free_impl_(allocator, sparse->values_cplx);
+    sparse->size = NULL;
+    sparse->indices = NULL;
+    sparse->values = NULL;
+    sparse->values_cplx = NULL;
+    sparse->count = 0;
+}
+
+#endif /* DATA_FILE_LIBRARY_SPARSE_IMPL_H */
@@ -0,0 +1,316 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/stats_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of the statistics computed while the files are
+        parsed, without storing their values. Each value is fed to a
+        streaming accumulator of its column (or of its index along an axis
+        of WL files), with the Welford update for the mean and the variance,
+        a compensated sum, and a scaled sum of squares for the norm.
+*/
+
+#ifndef DATA_FILE_LIBRARY_STATS_IMPL_H
+#define DATA_FILE_LIBRARY_STATS_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For EXIT_FAILURE and free() */
+#include <string.h> /* For strerror() */
+#include <errno.h> /* For errno */
+#include <ctype.h> /* For isspace() */
+#include <math.h> /* For fabs(), sqrt(), hypot() and isnan() */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "parse_impl_.h"
+#include "sepdat_impl_.h"
+
+/*
+    Statistics of a column, or of an index along an axis. For complex
+    values, they are the statistics of the absolute values.
+    - count, number of values.
+    - skipped, number of cells that are empty, not numbers, or NaN, which
+    are not counted.
+    - min, smallest value.
+    - max, largest value.
+    - sum, compensated sum of the values.
+    - mean, mean of the values.
+    - variance, population variance, i.e., the mean of the squared
+    deviations from the mean.
+    - norm, Euclidean norm, i.e., the square root of the sum of the squared
+    absolute values.
+    The other fields are internal.
+*/
+typedef struct dfl_stats {
+    long long count;
+    long long skipped;
+    double min;
+    double max;
+    double sum;
+    double mean;
+    double variance;
+    double norm;
+    double compensation;
+    double m2;
+    double scale;
+    double ssq;
+} dfl_stats;
+
+/*
+    Resets the accumulator of a statistics.
+
+    Parameter:
+    - stats, the statistics.
+*/
+static inline void stats_init_impl_(dfl_stats *stats) {
+    memset(stats, 0, sizeof(dfl_stats));
+    stats->ssq = 1.0;
+}
+
+/*
+    Feeds a value to the accumulator of a statistics.
+
+    Parameters:
+    - stats, the statistics.
+    - value, the value, which is skipped if it is NaN.
+*/
+static inline void stats_add_impl_(dfl_stats *stats, double value) {
+    if (isnan(value)) {
+        stats->skipped++;
+        return;
+    }
+    if (stats->count == 0 || value < stats->min) stats->min = value;
+    if (stats->count == 0 || value > stats->max) stats->max = value;
+    stats->count++;
+
+    /* Compensated sum (Neumaier) */
+    double t = stats->sum + value;
+    if (fabs(stats->sum) >= fabs(value)) {
+        stats->compensation += (stats->sum - t) + value;
+    } else {
+        stats->compensation += (value - t) + stats->sum;
+    }
+    stats->sum = t;
+
+    /* Welford update of the mean and of the squared deviations */
+    double delta = value - stats->mean;
+    stats->mean += delta / (double)stats->count;
+    stats->m2 += delta * (value - stats->mean);
+
+    /* Scaled sum of squares, which neither overflows nor underflows */
+    double a = fabs(value);
+    if (a > 0.0) {
+        if (stats->scale < a) {
+            stats->ssq = 1.0 + stats->ssq * (stats->scale / a) *
+                (stats->scale / a);
+            stats->scale = a;
+        } else {
+            stats->ssq += (a / stats->scale) * (a / stats->scale);
+        }
+    }
+}
+
+/*
+    Computes the results of a statistics from its accumulator.
+
+    Parameter:
+    - stats, the statistics.
+*/
+static inline void stats_finish_impl_(dfl_stats *stats) {
+    stats->sum += stats->compensation;
+    stats->compensation = 0.0;
+    stats->variance = stats->count > 0 ?
+        stats->m2 / (double)stats->count : 0.0;
+    stats->norm = stats->scale == INFINITY ? INFINITY :
+        stats->scale * sqrt(stats->ssq);
+}
+
+/*
+    Implementation for computing the statistics of each column of a
+    breakline-separated lines and char-separated columns data file while it
+    is parsed. Returns the number of columns of the file.
+
+    Parameters:
+    - file_path, path to the file.
+    - stats, array of max_columns statistics to output the statistics of
+    the first max_columns columns.
+    - max_columns, size of the stats array.
+    - sep, column separator.
+    - cplx, whether the values are complex numbers, whose absolute values
+    are used.
+*/
+static inline int sepdat_stats_impl_(const char *file_path,
+    dfl_stats *stats, int max_columns, char sep, int cplx) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "rb");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " sepdat_stats_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    for (int j = 0; j < max_columns; j++) {
+        stats_init_impl_(&stats[j]);
+    }
+
+    /* Read file */
+    size_t capacity = 128;
+    char *buffer = (char *)dfl_allocate_impl_(NULL, capacity);
+    long long consumed;
+    int columns = 0;
+    int j = 0;
+    int ch;
+    for (;;) {
+        ch = sepdat_read_token_impl_(file, sep, &buffer, &capacity,
+            &consumed);
+        if (j == 0 && ch != sep && buffer[0] == '\0') {
+            /* Blank line, or the end of the file */
+            if (ch == EOF) break;
+            continue;
+        }
+        if (j < max_columns) {
+            int valid;
+            double value;
+            if (cplx) {
+                tpdfcplx_impl_ z = parse_complex_checked_impl_(buffer,
+                    &valid);
+                value = hypot(creal_impl_(z), cimag_impl_(z));
+            } else {
+                value = parse_real_checked_impl_(buffer, &valid);
+            }
+            if (valid) {
+                stats_add_impl_(&stats[j], value);
+            } else {
+                stats[j].skipped++;
+            }
+        }
+        if (ch == sep) {
+            j++;
+        } else {
+            if (j + 1 > columns) columns = j + 1;
+            j = 0;
+            if (ch == EOF) break;
+        }
+    }
+    free(buffer);
+
+    /* Close file */
+    fclose(file);
+
+    for (int k = 0; k < max_columns; k++) {
+        stats_finish_impl_(&stats[k]);
+    }
+    return columns;
+}
+
+/*
+    Implementation for computing the statistics of the values of a Wolfram
+    Language package source format, grouped by their index along an axis,
+    while it is parsed, each value being read into a buffer that grows as
+    needed. Returns the size of the axis, or 1 if all values are grouped
+    together.
+
+    Parameters:
+    - file_path, path to the data file.
+    - stats, array of max_count statistics to output the statistics of the
+    first max_count indices.
+    - max_count, size of the stats array.
+    - axis, dimension whose index groups the values, from 0 for the
+    outermost to N-1 for the innermost, or -1 to group all values in
+    stats[0].
+    - cplx, whether the values are complex numbers, whose absolute values
+    are used.
+*/
+static inline int wldat_stats_impl_(const char *file_path, dfl_stats *stats,
+    int max_count, int axis, int cplx) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "rb");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_stats_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    for (int k = 0; k < max_count; k++) {
+        stats_init_impl_(&stats[k]);
+    }
+
+    int ch;
+
+    /* Skip the first line */
+    while ((ch = getc(file)) != EOF && ch != '\n') {}
+
+    /* Index of the current element at each level */
+    long long indices[128];
+    int depth = 0;
+    int groups = axis < 0 ? 1 : 0;
+    size_t capacity = 128;
+    char *buf = (char *)dfl_allocate_impl_(NULL, capacity);
+    size_t buf_i = 0;
+    while ((ch = getc(file)) != EOF) {
+        if (ch == '{') {
+            if (depth == 128) break;
+            indices[depth++] = 0;
+        } else if (ch == ',' || ch == '}') {
+            if (buf_i > 0 && depth > 0) {
+                /* Feed the value to the group of its index */
+                buf[buf_i] = '\0';
+                buf_i = 0;
+                long long group = 0;
+                if (axis >= 0) {
+                    group = axis < depth ? indices[axis] : -1;
+                    if (group >= groups) groups = (int)group + 1;
+                }
+                if (group >= 0 && group < max_count) {
+                    int valid;
+                    double value;
+                    if (cplx) {
+                        tpdfcplx_impl_ z = parse_complex_checked_impl_(buf,
+                            &valid);
+                        value = hypot(creal_impl_(z), cimag_impl_(z));
+                    } else {
+                        value = parse_real_checked_impl_(buf, &valid);
+                    }
+                    if (valid) {
+                        stats_add_impl_(&stats[group], value);
+                    } else {
+                        stats[group].skipped++;
+                    }
+                }
+                indices[depth - 1]++;
+            }
+            if (ch == '}') {
+                if (depth == 0) break;
+                depth--;
+                if (depth == 0) break;
+                indices[depth - 1]++;
+            }
+        } else if (!isspace(ch)) {
+            if (buf_i + 1 == capacity) {
+                buffer_grow_impl_(&buf, &capacity, "wldat_stats_impl_");
+            }
+            buf[buf_i++] = (char)ch;
+        }
+    }
+    free(buf);
+
+    /* Close file */
+    fclose(file);
+
+    for (int k = 0; k < max_count; k++) {
+        stats_finish_impl_(&stats[k]);
+    }
+    return groups;
+}
+
+#endif /* DATA_FILE_LIBRARY_STATS_IMPL_H */
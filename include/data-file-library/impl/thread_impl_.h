@@ -0,0 +1,207 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/thread_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Minimal portable layer over POSIX threads and Win32 threads (threads,
+        mutexes and condition variables), used by the functions that work
+        with several threads. On POSIX systems, programs using it must be
+        linked with -pthread.
+*/
+
+#ifndef DATA_FILE_LIBRARY_THREAD_IMPL_H
+#define DATA_FILE_LIBRARY_THREAD_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For malloc(), free() and EXIT_FAILURE */
+
+#if defined(_WIN32) || defined(_WIN64)
+
+#include <windows.h>
+
+typedef HANDLE tpthread_impl_;
+typedef CRITICAL_SECTION tpmutex_impl_;
+typedef CONDITION_VARIABLE tpcond_impl_;
+
+/* Function and argument of a thread, for the Win32 trampoline */
+typedef struct {
+    void *(*function)(void *);
+    void *argument;
+} tpthread_start_impl_;
+
+/*
+    Runs the function of a tpthread_start_impl_ in a Win32 thread.
+*/
+static inline DWORD WINAPI thread_trampoline_impl_(LPVOID start) {
+    tpthread_start_impl_ s = *(tpthread_start_impl_ *)start;
+    free(start);
+    s.function(s.argument);
+    return 0;
+}
+
+#else
+
+#include <pthread.h>
+#include <unistd.h> /* For sysconf() */
+
+typedef pthread_t tpthread_impl_;
+typedef pthread_mutex_t tpmutex_impl_;
+typedef pthread_cond_t tpcond_impl_;
+
+#endif /* _WIN32 || _WIN64 */
+
+/*
+    Starts a thread running function(argument). Exits on failure.
+
+    Parameters:
+    - thread, to output the thread.
+    - function, the function to be run.
+    - argument, the argument of the function.
+*/
+static inline void thread_create_impl_(tpthread_impl_ *thread,
+    void *(*function)(void *), void *argument) {
+
+    int failed;
+#if defined(_WIN32) || defined(_WIN64)
+    tpthread_start_impl_ *start =
+        (tpthread_start_impl_ *)malloc(sizeof(tpthread_start_impl_));
+    failed = (start == NULL);
+    if (!failed) {
+        start->function = function;
+        start->argument = argument;
+        *thread = CreateThread(NULL, 0, thread_trampoline_impl_, start, 0,
+            NULL);
+        failed = (*thread == NULL);
+        if (failed) free(start);
+    }
+#else
+    failed = pthread_create(thread, NULL, function, argument) != 0;
+#endif
+    if (failed) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " thread_create_impl_() ->"
+                        " Error in creating a thread."
+                        " Exiting.");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*
+    Waits for a thread to finish.
+
+    Parameter:
+    - thread, the thread.
+*/
+static inline void thread_join_impl_(tpthread_impl_ thread) {
+#if defined(_WIN32) || defined(_WIN64)
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+/*
+    Releases the resources of a thread that will never be joined.
+
+    Parameter:
+    - thread, the thread.
+*/
+static inline void thread_detach_impl_(tpthread_impl_ thread) {
+#if defined(_WIN32) || defined(_WIN64)
+    CloseHandle(thread);
+#else
+    pthread_detach(thread);
+#endif
+}
+
+/*
+    Wrappers of the mutexes and condition variables.
+*/
+static inline void mutex_init_impl_(tpmutex_impl_ *mutex) {
+#if defined(_WIN32) || defined(_WIN64)
+    InitializeCriticalSection(mutex);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+static inline void mutex_destroy_impl_(tpmutex_impl_ *mutex) {
+#if defined(_WIN32) || defined(_WIN64)
+    DeleteCriticalSection(mutex);
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+static inline void mutex_lock_impl_(tpmutex_impl_ *mutex) {
+#if defined(_WIN32) || defined(_WIN64)
+    EnterCriticalSection(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+static inline void mutex_unlock_impl_(tpmutex_impl_ *mutex) {
+#if defined(_WIN32) || defined(_WIN64)
+    LeaveCriticalSection(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+static inline void cond_init_impl_(tpcond_impl_ *cond) {
+#if defined(_WIN32) || defined(_WIN64)
+    InitializeConditionVariable(cond);
+#else
+    pthread_cond_init(cond, NULL);
+#endif
+}
+
+static inline void cond_destroy_impl_(tpcond_impl_ *cond) {
+#if defined(_WIN32) || defined(_WIN64)
+    (void)cond;
+#else
+    pthread_cond_destroy(cond);
+#endif
+}
+
+static inline void cond_wait_impl_(tpcond_impl_ *cond,
+    tpmutex_impl_ *mutex) {
+#if defined(_WIN32) || defined(_WIN64)
+    SleepConditionVariableCS(cond, mutex, INFINITE);
+#else
+    pthread_cond_wait(cond, mutex);
+#endif
+}
+
+static inline void cond_broadcast_impl_(tpcond_impl_ *cond) {
+#if defined(_WIN32) || defined(_WIN64)
+    WakeAllConditionVariable(cond);
+#else
+    pthread_cond_broadcast(cond);
+#endif
+}
+
+/*
+    Returns the number of processors available, at least 1.
+*/
+static inline int hardware_threads_impl_(void) {
+#if defined(_WIN32) || defined(_WIN64)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#else
+    return 1;
+#endif
+}
+
+#endif /* DATA_FILE_LIBRARY_THREAD_IMPL_H */
@@ -17,9 +17,15 @@
 
 #include <stdio.h> /* For fopen(), fclose(), fprintf(), ... */
 #include <stdlib.h> /* For EXIT_FAILURE */
+#include <string.h> /* For strerror() */
+#include <errno.h> /* For errno */
 #include <ctype.h> /* For isspace() */
+#include <stddef.h> /* For ptrdiff_t */
+#include <math.h> /* For fabs(), floor() and isfinite() */
 #include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
 #include "parse_impl_.h"
+#include "direct_impl_.h"
 
 /*
     Implementation for returning the size of the comment from a Wolfram
@@ -88,24 +94,13 @@ static inline void wldat_get_comment_impl_(const char *file_path,
 }
 
 /*
-    Implementation for returning the number of dimensions from a Wolfram
-    Language package source format.
-    The number of dimensions is limited to 128.
+    Scans an opened Wolfram Language package source format for its number
+    of dimensions, i.e., the number of '{' that start its second line.
 
     Parameter:
-    - file_path, path to the file.
+    - file, the file, at its start.
 */
-static inline int wldat_get_dimensions_impl_(const char *file_path) {
-
-    /* Open file */
-    FILE *file = fopen(file_path, "r");
-    if (!file) {
-        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " wldat_get_dimensions_impl_() ->"
-                        " Error in opening file: %s."
-                        " Exiting.", strerror(errno));
-        exit(EXIT_FAILURE);
-    }
+static inline int wldat_scan_dimensions_impl_(FILE *file) {
 
     int ch, count = 0;
 
@@ -125,6 +120,30 @@ static inline int wldat_get_dimensions_impl_(const char *file_path) {
             break;
         }
     }
+    return count;
+}
+
+/*
+    Implementation for returning the number of dimensions from a Wolfram
+    Language package source format.
+    The number of dimensions is limited to 128.
+
+    Parameter:
+    - file_path, path to the file.
+*/
+static inline int wldat_get_dimensions_impl_(const char *file_path) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "r");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_get_dimensions_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    int count = wldat_scan_dimensions_impl_(file);
 
     /* Close file */
     fclose(file);
@@ -141,35 +160,23 @@ static inline int wldat_get_dimensions_impl_(const char *file_path) {
 }
 
 /*
-    Implementation for getting the size of each dimension from a Wolfram
-    Language package source format.
+    Scans an opened Wolfram Language package source format for the size of
+    each dimension, as size_t.
 
     Parameters:
-    - file_path, path to the file.
-    - size, array of size given by wldat_get_dimensions_impl_(), to
-    sequentially output the size of each dimension. The size of this array
-    is limited to 128.
+    - file, the file, at its start.
+    - dimensions, number of dimensions, as given by
+    wldat_scan_dimensions_impl_(), limited to 128.
+    - size, array of size dimensions to output the size of each dimension.
 */
-static inline void wldat_get_sizes_impl_(const char *file_path, int *size) {
-
-    /* Get dimensions */
-    int dimensions = wldat_get_dimensions_impl_(file_path);
+static inline void wldat_scan_sizes_impl_(FILE *file, int dimensions,
+    size_t *size) {
 
     /* Initialize counts */
     for (int i = 0; i < dimensions; i++) {
         size[i] = 1;
     }
 
-    /* Open file */
-    FILE *file = fopen(file_path, "r");
-    if (!file) {
-        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " wldat_get_sizes_impl_() ->"
-                        " Error in opening file: %s."
-                        " Exiting.", strerror(errno));
-        exit(EXIT_FAILURE);
-    }
-
     int ch;
 
     /* Skip the first line */
@@ -228,32 +235,160 @@ static inline void wldat_get_sizes_impl_(const char *file_path, int *size) {
             size[dimensions - active_dimensions - 1]++;
         }
     }
+}
+
+/*
+    Implementation for getting the size of each dimension from a Wolfram
+    Language package source format.
+
+    Parameters:
+    - file_path, path to the file.
+    - size, array of size given by wldat_get_dimensions_impl_(), to
+    sequentially output the size of each dimension as size_t, so that
+    dimensions with more than 2^31 elements may be handled. The size of this
+    array is limited to 128.
+*/
+static inline void wldat_get_sizes64_impl_(const char *file_path,
+    size_t *size) {
+
+    /* Get dimensions */
+    int dimensions = wldat_get_dimensions_impl_(file_path);
+
+    /* Open file */
+    FILE *file = fopen(file_path, "r");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_get_sizes64_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    wldat_scan_sizes_impl_(file, dimensions, size);
 
     /* Close file */
     fclose(file);
 }
 
 /*
-    Compute flat index in row-major order. Example, considering an array
-    arr of two dimensions 0<=i<IMAX and 0<=j<JMAX, in the
-    row-major order one can write arr[j + JMAX*i], with the size of arr
-    being IMAX*JMAX.
+    Implementation for getting the number of dimensions and the size of each
+    dimension from a Wolfram Language package source format, as size_t,
+    opening the file once and without exiting on failure. Returns 0, the
+    errno of the failure to open the file, or EINVAL if the dimensions
+    exceed 128.
 
     Parameters:
-    - indices, array with the indices i.
-    - size, array with the maximum value XMAX for each x.
-    - dimensions, number of x's.
+    - file_path, path to the file.
+    - &dimensions, to output the number of dimensions.
+    - size, array of size 128 to output the size of each dimension.
 */
-static inline int row_major_flat_index_impl_(const int *indices,
-    const int *size, int dimensions) {
-    
-    int idx = 0;
+static inline int wldat_get_sizes_status_impl_(const char *file_path,
+    int *dimensions, size_t *size) {
+
+    FILE *file = fopen(file_path, "r");
+    if (!file) return errno != 0 ? errno : EIO;
+    *dimensions = wldat_scan_dimensions_impl_(file);
+    if (*dimensions > 128) {
+        fclose(file);
+        return EINVAL;
+    }
+    rewind(file);
+    wldat_scan_sizes_impl_(file, *dimensions, size);
+    fclose(file);
+    return 0;
+}
+
+/*
+    Implementation for getting the size of each dimension from a Wolfram
+    Language package source format as int.
+
+    Parameters:
+    - file_path, path to the file.
+    - size, array of size given by wldat_get_dimensions_impl_(), to
+    sequentially output the size of each dimension.
+*/
+static inline void wldat_get_sizes_impl_(const char *file_path, int *size) {
+
+    size_t size64[128];
+    wldat_get_sizes64_impl_(file_path, size64);
+    int dimensions = wldat_get_dimensions_impl_(file_path);
+    for (int d = 0; d < dimensions; d++) {
+        size[d] = size_to_int_impl_(size64[d], "wldat_get_sizes_impl_");
+    }
+}
+
+/*
+    Copies the int sizes of each dimension into an array of size_t.
+
+    Parameters:
+    - size, array with the size of each dimension.
+    - dimensions, number of dimensions.
+    - size64, array to output the sizes.
+*/
+static inline void widen_sizes_impl_(const int *size, int dimensions,
+    size_t *size64) {
+
     for (int d = 0; d < dimensions; d++) {
-        idx = indices[d] + size[d] * idx;
+        size64[d] = (size_t)size[d];
+    }
+}
+
+/*
+    Copies the int strides of each dimension into an array of ptrdiff_t.
+
+    Parameters:
+    - stride, array with the stride of each dimension.
+    - dimensions, number of dimensions.
+    - stride64, array to output the strides.
+*/
+static inline void widen_strides_impl_(const int *stride, int dimensions,
+    ptrdiff_t *stride64) {
+
+    for (int d = 0; d < dimensions; d++) {
+        stride64[d] = (ptrdiff_t)stride[d];
+    }
+}
+
+/*
+    Compute flat index with arbitrary strides, i.e., the sum of
+    indices[d]*stride[d] over all dimensions d. The row-major order has
+    stride[N-1] = 1 and stride[d] = stride[d+1]*size[d+1], and the
+    column-major order has stride[0] = 1 and stride[d] = stride[d-1]*size[d-1].
+
+    Parameters:
+    - indices, array with the indices of each dimension.
+    - stride, array with the distance in elements between two consecutive
+    indices of each dimension.
+    - dimensions, number of dimensions.
+*/
+static inline ptrdiff_t strided_flat_index_impl_(const ptrdiff_t *indices,
+    const ptrdiff_t *stride, int dimensions) {
+
+    ptrdiff_t idx = 0;
+    for (int d = 0; d < dimensions; d++) {
+        idx += indices[d] * stride[d];
     }
     return idx;
 }
 
+/*
+    Compute the strides of the row-major order of an array.
+
+    Parameters:
+    - size, array with the size of each dimension.
+    - dimensions, number of dimensions.
+    - stride, array to output the stride of each dimension.
+*/
+static inline void row_major_strides_impl_(const size_t *size,
+    int dimensions, ptrdiff_t *stride) {
+
+    ptrdiff_t s = 1;
+    for (int d = dimensions - 1; d >= 0; d--) {
+        stride[d] = s;
+        s *= (ptrdiff_t)size[d];
+    }
+}
+
 /*
     Implementation for a recursive function for dealing with nested braces
     from a Wolfram Language package source format with real numbers.
@@ -262,17 +397,18 @@ static inline int row_major_flat_index_impl_(const int *indices,
     - file, file with the data, already read until the first '\n'.
     - level, level of the nested brace.
     - dimensions, number of dimensions of the data.
-    - size, array with the size of each dimension.
+    - stride, array with the stride of each dimension.
     - indices, array with the indices of each dimension.
     - data, array to store the results.
 */
 static inline void read_nested_braces_impl_(FILE *file, int level,
-    int dimensions, const int *size, int *indices, double *data) {
+    int dimensions, const ptrdiff_t *stride, ptrdiff_t *indices,
+    double *data) {
     
     int ch;
     char buf[128];
     int buf_i = 0;
-    int element_count = 0;
+    ptrdiff_t element_count = 0;
 
     /* Expect '{' */
     do { ch = fgetc(file); } while (ch != EOF && isspace(ch));
@@ -282,14 +418,14 @@ static inline void read_nested_braces_impl_(FILE *file, int level,
         if (ch == '{') {
             ungetc(ch, file);
             indices[level] = element_count;
-            read_nested_braces_impl_(file, level + 1, dimensions, size,
+            read_nested_braces_impl_(file, level + 1, dimensions, stride,
                 indices, data);
             element_count++;
         } else if (ch == '}') {
             if (buf_i > 0) {
                 buf[buf_i] = '\0';
                 indices[level] = element_count;
-                int idx = row_major_flat_index_impl_(indices, size,
+                ptrdiff_t idx = strided_flat_index_impl_(indices, stride,
                     dimensions);
                 data[idx] = parse_real_impl_(buf);
                 buf_i = 0;
@@ -300,13 +436,13 @@ static inline void read_nested_braces_impl_(FILE *file, int level,
             if (buf_i > 0) {
                 buf[buf_i] = '\0';
                 indices[level] = element_count;
-                int idx = row_major_flat_index_impl_(indices, size,
+                ptrdiff_t idx = strided_flat_index_impl_(indices, stride,
                     dimensions);
                 data[idx] = parse_real_impl_(buf);
                 buf_i = 0;
                 element_count++;
             }
-        } else if (!isspace(ch)) {
+        } else if (!isspace(ch) && buf_i < (int)sizeof(buf) - 1) {
             buf[buf_i++] = (char)ch;
         }
     }
@@ -320,18 +456,18 @@ static inline void read_nested_braces_impl_(FILE *file, int level,
     - file, file with the data, already read until the first '\n'.
     - level, level of the nested brace.
     - dimensions, number of dimensions of the data.
-    - size, array with the size of each dimension.
+    - stride, array with the stride of each dimension.
     - indices, array with the indices of each dimension.
     - data, array to store the results.
 */
 static inline void read_nested_braces_cplx_impl_(FILE *file, int level,
-    int dimensions, const int *size, int *indices,
+    int dimensions, const ptrdiff_t *stride, ptrdiff_t *indices,
     tpdfcplx_impl_ *data) {
     
     int ch;
     char buf[128];
     int buf_i = 0;
-    int element_count = 0;
+    ptrdiff_t element_count = 0;
 
     /* Expect '{' */
     do { ch = fgetc(file); } while (ch != EOF && isspace(ch));
@@ -342,13 +478,13 @@ static inline void read_nested_braces_cplx_impl_(FILE *file, int level,
             ungetc(ch, file);
             indices[level] = element_count;
             read_nested_braces_cplx_impl_(file, level + 1, dimensions,
-                size, indices, data);
+                stride, indices, data);
             element_count++;
         } else if (ch == '}') {
             if (buf_i > 0) {
                 buf[buf_i] = '\0';
                 indices[level] = element_count;
-                int idx = row_major_flat_index_impl_(indices, size,
+                ptrdiff_t idx = strided_flat_index_impl_(indices, stride,
                     dimensions);
                 data[idx] = parse_complex_impl_(buf);
                 buf_i = 0;
@@ -359,18 +495,145 @@ static inline void read_nested_braces_cplx_impl_(FILE *file, int level,
             if (buf_i > 0) {
                 buf[buf_i] = '\0';
                 indices[level] = element_count;
-                int idx = row_major_flat_index_impl_(indices, size,
+                ptrdiff_t idx = strided_flat_index_impl_(indices, stride,
                     dimensions);
                 data[idx] = parse_complex_impl_(buf);
                 buf_i = 0;
                 element_count++;
             }
-        } else if (!isspace(ch)) {
+        } else if (!isspace(ch) && buf_i < (int)sizeof(buf) - 1) {
+            buf[buf_i++] = (char)ch;
+        }
+    }
+}
+
+/*
+    Implementation for a recursive function for dealing with nested braces
+    from a Wolfram Language package source format with complex numbers,
+    storing the real and imaginary parts in two separate arrays.
+
+    Parameters:
+    - file, file with the data, already read until the first '\n'.
+    - level, level of the nested brace.
+    - dimensions, number of dimensions of the data.
+    - stride, array with the stride of each dimension.
+    - indices, array with the indices of each dimension.
+    - re, array to store the real parts.
+    - im, array to store the imaginary parts.
+*/
+static inline void read_nested_braces_split_impl_(FILE *file, int level,
+    int dimensions, const ptrdiff_t *stride, ptrdiff_t *indices,
+    double *re, double *im) {
+
+    int ch;
+    char buf[128];
+    int buf_i = 0;
+    ptrdiff_t element_count = 0;
+
+    /* Expect '{' */
+    do { ch = fgetc(file); } while (ch != EOF && isspace(ch));
+    if (ch != '{') return;
+
+    while ((ch = fgetc(file)) != EOF) {
+        if (ch == '{') {
+            ungetc(ch, file);
+            indices[level] = element_count;
+            read_nested_braces_split_impl_(file, level + 1, dimensions,
+                stride, indices, re, im);
+            element_count++;
+        } else if (ch == '}' || ch == ',') {
+            if (buf_i > 0) {
+                buf[buf_i] = '\0';
+                indices[level] = element_count;
+                ptrdiff_t idx = strided_flat_index_impl_(indices, stride,
+                    dimensions);
+                tpdfcplx_impl_ value = parse_complex_impl_(buf);
+                re[idx] = creal_impl_(value);
+                im[idx] = cimag_impl_(value);
+                buf_i = 0;
+                element_count++;
+            }
+            if (ch == '}') break;
+        } else if (!isspace(ch) && buf_i < (int)sizeof(buf) - 1) {
             buf[buf_i++] = (char)ch;
         }
     }
 }
 
+/*
+    Reads data of real numbers from an opened Wolfram Language package source
+    format into a double-type array with arbitrary strides. See
+    wldat_read_strided_impl_().
+*/
+static inline void wldat_read_file_strided_impl_(FILE *file,
+    double *data, int dimensions, const ptrdiff_t *stride) {
+
+    int ch;
+
+    /* Skip the first line */
+    while ((ch = fgetc(file)) != EOF) {
+        if ((char)ch == '\n') {
+            break;
+        }
+    }
+
+    ptrdiff_t indices[128];
+    read_nested_braces_impl_(file, 0, dimensions, stride, indices,
+        data);
+}
+
+/*
+    Implementation for reading data of real numbers from a Wolfram Language
+    package source format of known dimensions, as given by
+    wldat_get_dimensions_impl_(), into a double-type array with arbitrary
+    strides, i.e., the value of indices (i1, ..., iN) is stored at
+    data[i1*stride[0] + ... + iN*stride[N-1]].
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type to output the data.
+    - dimensions, number N of dimensions of the data.
+    - stride, array of size N containing the stride of each dimension.
+*/
+static inline void wldat_read_strided_impl_(const char *file_path,
+    double *data, int dimensions, const ptrdiff_t *stride) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "r");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_read_strided_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    wldat_read_file_strided_impl_(file, data, dimensions, stride);
+
+    /* Close file */
+    fclose(file);
+}
+
+/*
+    Implementation for reading data of real numbers from a Wolfram Language
+    package source format of known dimensions and sizes, as given by
+    wldat_get_dimensions_impl_() and wldat_get_sizes_impl_(), into an
+    one-dimensional double-type array following the row-major order.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type of size S1*S2*...*SN.
+    - dimensions, number N of dimensions of the data.
+    - size, array of size N containing the size of each dimension.
+*/
+static inline void wldat_read_impl_(const char *file_path,
+    double *data, int dimensions, const size_t *size) {
+
+    ptrdiff_t stride[128];
+    row_major_strides_impl_(size, dimensions, stride);
+    wldat_read_strided_impl_(file_path, data, dimensions, stride);
+}
+
 /*
     Implementation for importing data of real numbers from a Wolfram Language
     package source format, and storing in an one-dimensional
@@ -386,21 +649,76 @@ static inline void read_nested_braces_cplx_impl_(FILE *file, int level,
 */
 static inline void wldat_import_impl_(const char *file_path,
     double *data) {
-    
+
     /* Get dimensions and sizes */
     int dimensions = wldat_get_dimensions_impl_(file_path);
-    int size[128];
-    wldat_get_sizes_impl_(file_path, size);
+    size_t size[128];
+    wldat_get_sizes64_impl_(file_path, size);
 
-    /* Open file */
-    FILE *file = fopen(file_path, "r");
-    if (!file) {
-        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " wldat_import_impl_() ->"
-                        " Error in opening file: %s."
-                        " Exiting.", strerror(errno));
-        exit(EXIT_FAILURE);
+    wldat_read_impl_(file_path, data, dimensions, size);
+}
+
+/*
+    Implementation for importing data of real numbers from a Wolfram
+    Language package source format into an one-dimensional double-type
+    array allocated by the library, following the row-major order.
+
+    Parameters:
+    - file_path, path to the data file.
+    - &dimensions, to output the number N of dimensions.
+    - &size, to output an array of size N, allocated by the library, with
+    the size of each dimension.
+    - allocator, allocator of the returned arrays, or NULL for malloc().
+*/
+static inline double *wldat_import_alloc_impl_(const char *file_path,
+    int *dimensions, int **size, const dfl_allocator *allocator) {
+
+    *dimensions = wldat_get_dimensions_impl_(file_path);
+    *size = (int *)dfl_allocate_impl_(allocator,
+        (size_t)(*dimensions) * sizeof(int));
+    size_t size64[128];
+    wldat_get_sizes64_impl_(file_path, size64);
+
+    size_t total = 1;
+    for (int d = 0; d < *dimensions; d++) {
+        (*size)[d] = size_to_int_impl_(size64[d], "wldat_import_alloc_impl_");
+        total *= size64[d];
     }
+    double *data = (double *)dfl_allocate_impl_(allocator,
+        total * sizeof(double));
+    wldat_read_impl_(file_path, data, *dimensions, size64);
+    return data;
+}
+
+/*
+    Implementation for importing data of real numbers from a Wolfram
+    Language package source format into a double-type array with arbitrary
+    strides, e.g., following the column-major order or into a sub-block of
+    a larger array, without an intermediate copy.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type to output the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - stride, array of size N containing the stride of each dimension, where
+    N may be obtained through wldat_get_dimensions_impl_().
+*/
+static inline void wldat_import_strided_impl_(const char *file_path,
+    double *data, const int *stride) {
+
+    int dimensions = wldat_get_dimensions_impl_(file_path);
+    ptrdiff_t stride64[128];
+    widen_strides_impl_(stride, dimensions, stride64);
+    wldat_read_strided_impl_(file_path, data, dimensions, stride64);
+}
+
+/*
+    Reads data of complex numbers from an opened Wolfram Language package
+    source format into a 'double complex'-type array with arbitrary strides.
+    See wldat_read_cplx_strided_impl_().
+*/
+static inline void wldat_read_file_cplx_strided_impl_(FILE *file,
+    tpdfcplx_impl_ *data, int dimensions, const ptrdiff_t *stride) {
 
     int ch;
 
@@ -411,14 +729,93 @@ static inline void wldat_import_impl_(const char *file_path,
         }
     }
 
-    int indices[128];
-    read_nested_braces_impl_(file, 0, dimensions, size, indices,
+    ptrdiff_t indices[128];
+    read_nested_braces_cplx_impl_(file, 0, dimensions, stride, indices,
         data);
+}
+
+/*
+    Implementation for reading data of complex numbers from a Wolfram Language
+    package source format of known dimensions, as given by
+    wldat_get_dimensions_impl_(), into a 'double complex'-type array with
+    arbitrary strides, i.e., the value of indices (i1, ..., iN) is stored at
+    data[i1*stride[0] + ... + iN*stride[N-1]].
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type to output the data.
+    - dimensions, number N of dimensions of the data.
+    - stride, array of size N containing the stride of each dimension.
+*/
+static inline void wldat_read_cplx_strided_impl_(const char *file_path,
+    tpdfcplx_impl_ *data, int dimensions, const ptrdiff_t *stride) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "r");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_read_cplx_strided_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    wldat_read_file_cplx_strided_impl_(file, data, dimensions, stride);
 
     /* Close file */
     fclose(file);
 }
 
+/*
+    Implementation for reading data of real or complex numbers from a
+    Wolfram Language package source format of known dimensions into an array
+    with arbitrary strides, as wldat_read_strided_impl_(), without exiting
+    on failure. Returns 0, or the errno of the failure to open the file.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type to output the data, or NULL.
+    - data_cplx, array of 'double complex'-type to output the data, used if
+    data is NULL.
+    - dimensions, number N of dimensions of the data.
+    - stride, array of size N containing the stride of each dimension.
+*/
+static inline int wldat_read_status_impl_(const char *file_path,
+    double *data, tpdfcplx_impl_ *data_cplx, int dimensions,
+    const ptrdiff_t *stride) {
+
+    FILE *file = fopen(file_path, "r");
+    if (!file) return errno != 0 ? errno : EIO;
+    if (data != NULL) {
+        wldat_read_file_strided_impl_(file, data, dimensions, stride);
+    } else {
+        wldat_read_file_cplx_strided_impl_(file, data_cplx, dimensions,
+            stride);
+    }
+    fclose(file);
+    return 0;
+}
+
+/*
+    Implementation for reading data of complex numbers from a Wolfram Language
+    package source format of known dimensions and sizes, as given by
+    wldat_get_dimensions_impl_() and wldat_get_sizes_impl_(), into an
+    one-dimensional 'double complex'-type array following the row-major order.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type of size S1*S2*...*SN.
+    - dimensions, number N of dimensions of the data.
+    - size, array of size N containing the size of each dimension.
+*/
+static inline void wldat_read_cplx_impl_(const char *file_path,
+    tpdfcplx_impl_ *data, int dimensions, const size_t *size) {
+
+    ptrdiff_t stride[128];
+    row_major_strides_impl_(size, dimensions, stride);
+    wldat_read_cplx_strided_impl_(file_path, data, dimensions, stride);
+}
+
 /*
     Implementation for importing data of complex numbers from a Wolfram
     Language package source format, and storing in an one-dimensional
@@ -434,17 +831,101 @@ static inline void wldat_import_impl_(const char *file_path,
 */
 static inline void wldat_import_cplx_impl_(const char *file_path,
     tpdfcplx_impl_ *data) {
-    
+
+    /* Get dimensions and sizes */
+    int dimensions = wldat_get_dimensions_impl_(file_path);
+    size_t size[128];
+    wldat_get_sizes64_impl_(file_path, size);
+
+    wldat_read_cplx_impl_(file_path, data, dimensions, size);
+}
+
+/*
+    Implementation for importing data of complex numbers from a Wolfram
+    Language package source format into an one-dimensional
+    'double complex'-type array allocated by the library, following the
+    row-major order.
+
+    Parameters:
+    - file_path, path to the data file.
+    - &dimensions, to output the number N of dimensions.
+    - &size, to output an array of size N, allocated by the library, with
+    the size of each dimension.
+    - allocator, allocator of the returned arrays, or NULL for malloc().
+*/
+static inline tpdfcplx_impl_ *wldat_import_cplx_alloc_impl_(
+    const char *file_path, int *dimensions, int **size,
+    const dfl_allocator *allocator) {
+
+    *dimensions = wldat_get_dimensions_impl_(file_path);
+    *size = (int *)dfl_allocate_impl_(allocator,
+        (size_t)(*dimensions) * sizeof(int));
+    size_t size64[128];
+    wldat_get_sizes64_impl_(file_path, size64);
+
+    size_t total = 1;
+    for (int d = 0; d < *dimensions; d++) {
+        (*size)[d] = size_to_int_impl_(size64[d],
+            "wldat_import_cplx_alloc_impl_");
+        total *= size64[d];
+    }
+    tpdfcplx_impl_ *data = (tpdfcplx_impl_ *)dfl_allocate_impl_(allocator,
+        total * sizeof(tpdfcplx_impl_));
+    wldat_read_cplx_impl_(file_path, data, *dimensions, size64);
+    return data;
+}
+
+/*
+    Implementation for importing data of complex numbers from a Wolfram
+    Language package source format into a 'double complex'-type array with
+    arbitrary strides, e.g., following the column-major order or into a
+    sub-block of a larger array, without an intermediate copy.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type to output the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - stride, array of size N containing the stride of each dimension, where
+    N may be obtained through wldat_get_dimensions_impl_().
+*/
+static inline void wldat_import_cplx_strided_impl_(const char *file_path,
+    tpdfcplx_impl_ *data, const int *stride) {
+
+    int dimensions = wldat_get_dimensions_impl_(file_path);
+    ptrdiff_t stride64[128];
+    widen_strides_impl_(stride, dimensions, stride64);
+    wldat_read_cplx_strided_impl_(file_path, data, dimensions, stride64);
+}
+
+/*
+    Implementation for importing data of complex numbers from a Wolfram
+    Language package source format into two double-type arrays, one with
+    the real parts and one with the imaginary parts, both following the
+    row-major order, without an interleaved intermediate array.
+
+    Parameters:
+    - file_path, path to the data file.
+    - re, array of double-type of size S1*S2*...*SN to output the real
+    parts, where N and Sn may be obtained through
+    wldat_get_dimensions_impl_() and wldat_get_sizes_impl_().
+    - im, array of double-type of size S1*S2*...*SN to output the imaginary
+    parts.
+*/
+static inline void wldat_import_cplx_split_impl_(const char *file_path,
+    double *re, double *im) {
+
     /* Get dimensions and sizes */
     int dimensions = wldat_get_dimensions_impl_(file_path);
-    int size[128];
-    wldat_get_sizes_impl_(file_path, size);
+    size_t size[128];
+    wldat_get_sizes64_impl_(file_path, size);
+    ptrdiff_t stride[128];
+    row_major_strides_impl_(size, dimensions, stride);
 
     /* Open file */
     FILE *file = fopen(file_path, "r");
     if (!file) {
         fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " wldat_import_cplx_impl_() ->"
+                        " wldat_import_cplx_split_impl_() ->"
                         " Error in opening file: %s."
                         " Exiting.", strerror(errno));
         exit(EXIT_FAILURE);
@@ -459,14 +940,111 @@ static inline void wldat_import_cplx_impl_(const char *file_path,
         }
     }
 
-    int indices[128];
-    read_nested_braces_cplx_impl_(file, 0, dimensions, size, indices,
-        data);
+    ptrdiff_t indices[128];
+    read_nested_braces_split_impl_(file, 0, dimensions, stride, indices, re,
+        im);
 
     /* Close file */
     fclose(file);
 }
 
+/*
+    Options of the Wolfram Language exports, where a NULL pointer keeps the
+    default form, i.e., 17 significant digits in the exponential form (e.g.,
+    1.0000000000000000*^+00) and elements separated by ", ".
+    - precision, number of significant digits (1 to 17), or 0 for the
+    fewest digits that are read back as the same double.
+    - no_spaces, 1 to write {1,2} and 1-2*I instead of {1, 2} and
+    1 - 2*I, otherwise 0.
+    - integers, 1 to write the values without a fractional part and below
+    1e15 in magnitude as integers (e.g., 0 and -3), which the Wolfram
+    Language reads as exact integers, otherwise 0.
+*/
+typedef struct dfl_wl_format {
+    int precision;
+    int no_spaces;
+    int integers;
+} dfl_wl_format;
+
+/*
+    Writes a real value in the Wolfram Language form with the given options.
+    Numbers in the exponential form are written as m*^n, where the mantissa
+    m always has a decimal point so that it is read as a real value.
+
+    Parameters:
+    - output, the output string of at least 64 chars.
+    - output_size, is the sizeof(output).
+    - input, the input number.
+    - format, the options, or NULL for the default form.
+*/
+static inline void wldat_format_real_impl_(char *output, size_t output_size,
+    double input, const dfl_wl_format *format) {
+
+    if (format == NULL) {
+        e_to_star_caret_impl_(output, output_size, input);
+        return;
+    }
+
+    /* Integer shortcut */
+    if (format->integers && input == floor(input) && fabs(input) < 1e15) {
+        /* Digits written backwards, without the cost of snprintf() */
+        char digits[24];
+        int length = 0;
+        long long integer = (long long)input;
+        unsigned long long u = (unsigned long long)(integer < 0 ?
+            -integer : integer);
+        do {
+            digits[length++] = (char)('0' + u % 10);
+            u /= 10;
+        } while (u != 0);
+        size_t k = 0;
+        if (integer < 0 && k + 1 < output_size) output[k++] = '-';
+        while (length > 0 && k + 1 < output_size) {
+            output[k++] = digits[--length];
+        }
+        output[k] = '\0';
+        return;
+    }
+
+    /* Fixed or fewest round-trip significant digits */
+    char buf[64];
+    if (format->precision > 0) {
+        format_real_g_impl_(buf, sizeof(buf), input,
+            format->precision < 17 ? format->precision : 17);
+    } else {
+        /* 17 digits always read back as the same double */
+        int precision = 15;
+        for (; precision < 17; precision++) {
+            format_real_g_impl_(buf, sizeof(buf), input, precision);
+            if (!isfinite(input) || strtod_c_impl_(buf, NULL) == input) {
+                break;
+            }
+        }
+        if (precision == 17) {
+            format_real_g_impl_(buf, sizeof(buf), input, 17);
+        }
+    }
+    if (!isfinite(input)) {
+        snprintf(output, output_size, "%s", buf);
+        return;
+    }
+
+    /* Mantissa with a decimal point, then *^ and the bare exponent */
+    char *e = strchr(buf, 'e');
+    if (e != NULL) *e = '\0';
+    snprintf(output, output_size, "%s%s", buf,
+        strchr(buf, '.') == NULL ? "." : "");
+    if (e != NULL) {
+        const char *exponent = e + 1;
+        int negative = (*exponent == '-');
+        if (*exponent == '+' || *exponent == '-') exponent++;
+        while (*exponent == '0' && exponent[1] != '\0') exponent++;
+        size_t len = strlen(output);
+        snprintf(output + len, output_size - len, "*^%s%s",
+            negative ? "-" : "", exponent);
+    }
+}
+
 /*
     Implementation for a recursive function for writing nested braces
     from a Wolfram Language package source format with real numbers.
@@ -476,33 +1054,59 @@ static inline void wldat_import_cplx_impl_(const char *file_path,
     - level, level of the nested brace.
     - dimensions, number of dimensions of the data.
     - size, array with the size of each dimension.
+    - stride, array with the stride of each dimension.
     - indices, array with the indices of each dimension.
     - data, array to store the results.
+    - format, options of the numbers, or NULL.
 */
 static inline void write_nested_braces_impl_(FILE *file, int level,
-    int dimensions, const int *size, int *indices,
-    const double *data) {
+    int dimensions, const size_t *size, const ptrdiff_t *stride,
+    ptrdiff_t *indices,
+    const double *data, const dfl_wl_format *format) {
 
+    const char *separator = (format != NULL && format->no_spaces) ?
+        "," : ", ";
     fprintf(file, "{");
-    for (int i = 0; i < size[level]; i++) {
-        indices[level] = i;
+    for (size_t i = 0; i < size[level]; i++) {
+        indices[level] = (ptrdiff_t)i;
         if (level == dimensions - 1) {
             /* Deepest level -> print number */
-            int idx = row_major_flat_index_impl_(indices, size,
+            ptrdiff_t idx = strided_flat_index_impl_(indices, stride,
                 dimensions);
             char buf[128];
-            e_to_star_caret_impl_(buf, sizeof(buf), data[idx]);
-            fprintf(file, "%s", buf);
+            wldat_format_real_impl_(buf, sizeof(buf), data[idx], format);
+            fputs(buf, file);
         } else {
             /* Recurse into next level */
             write_nested_braces_impl_(file, level + 1, dimensions,
-                size, indices, data);
+                size, stride, indices, data, format);
         }
-        if (i < size[level] - 1) fprintf(file, ", ");
+        if (i + 1 < size[level]) fputs(separator, file);
     }
     fprintf(file, "}");
 }
 
+/*
+    Writes a complex value of the type a + b*I or a - b*I to a file.
+
+    Parameters:
+    - file, the file.
+    - re, real part.
+    - im, imaginary part.
+    - format, options of the numbers, or NULL.
+*/
+static inline void wldat_write_cplx_impl_(FILE *file, double re,
+    double im, const dfl_wl_format *format) {
+
+    char buf_re[128], buf_abs_im[128];
+    wldat_format_real_impl_(buf_re, sizeof(buf_re), re, format);
+    wldat_format_real_impl_(buf_abs_im, sizeof(buf_abs_im), fabs(im),
+        format);
+    const char *sign = (im < 0.0) ? " - " : " + ";
+    if (format != NULL && format->no_spaces) sign = (im < 0.0) ? "-" : "+";
+    fprintf(file, "%s%s%s*I", buf_re, sign, buf_abs_im);
+}
+
 /*
     Implementation for a recursive function for writing nested braces
     from a Wolfram Language package source format with complex numbers.
@@ -512,69 +1116,230 @@ static inline void write_nested_braces_impl_(FILE *file, int level,
     - level, level of the nested brace.
     - dimensions, number of dimensions of the data.
     - size, array with the size of each dimension.
+    - stride, array with the stride of each dimension.
     - indices, array with the indices of each dimension.
     - data, array to store the results.
+    - format, options of the numbers, or NULL.
 */
 static inline void write_nested_braces_cplx_impl_(FILE *file, int level,
-    int dimensions, const int *size, int *indices,
-    const tpdfcplx_impl_ *data) {
+    int dimensions, const size_t *size, const ptrdiff_t *stride,
+    ptrdiff_t *indices,
+    const tpdfcplx_impl_ *data, const dfl_wl_format *format) {
+
+    const char *separator = (format != NULL && format->no_spaces) ?
+        "," : ", ";
 
     fprintf(file, "{");
-    for (int i = 0; i < size[level]; i++) {
-        indices[level] = i;
+    for (size_t i = 0; i < size[level]; i++) {
+        indices[level] = (ptrdiff_t)i;
         if (level == dimensions - 1) {
             /* Deepest level -> print number */
-            int idx = row_major_flat_index_impl_(indices, size,
+            ptrdiff_t idx = strided_flat_index_impl_(indices, stride,
                 dimensions);
-            char buf_re[128], buf_abs_im[128];
-            e_to_star_caret_impl_(buf_re, sizeof(buf_re),
-                creal(data[idx]));
-            e_to_star_caret_impl_(buf_abs_im, sizeof(buf_abs_im),
-                fabs(cimag(data[idx])));
-            if (cimag(data[idx]) < 0.0) {
-                fprintf(file, "%s - %s*I", buf_re, buf_abs_im);
-            }
-            else {
-                fprintf(file, "%s + %s*I", buf_re, buf_abs_im);
-            }
+            wldat_write_cplx_impl_(file, creal_impl_(data[idx]),
+                cimag_impl_(data[idx]), format);
         } else {
             /* Recurse into next level */
             write_nested_braces_cplx_impl_(file, level + 1, dimensions,
-                size, indices, data);
+                size, stride, indices, data, format);
         }
-        if (i < size[level] - 1) fprintf(file, ", ");
+        if (i + 1 < size[level]) fputs(separator, file);
     }
     fprintf(file, "}");
 }
 
 /*
-    Implementation for exporting double-type data of an one-dimensional
-    double-type array, following the row-major order, to Wolfram Language
-    package source format of arbitrary dimension.
+    Implementation for a recursive function for writing nested braces
+    from a Wolfram Language package source format with complex numbers
+    given by two separate arrays of real and imaginary parts.
+
+    Parameters:
+    - file, file with the data, already read until the first '\n'.
+    - level, level of the nested brace.
+    - dimensions, number of dimensions of the data.
+    - size, array with the size of each dimension.
+    - stride, array with the stride of each dimension.
+    - indices, array with the indices of each dimension.
+    - re, array with the real parts.
+    - im, array with the imaginary parts.
+    - format, options of the numbers, or NULL.
+*/
+static inline void write_nested_braces_split_impl_(FILE *file, int level,
+    int dimensions, const size_t *size, const ptrdiff_t *stride,
+    ptrdiff_t *indices,
+    const double *re, const double *im, const dfl_wl_format *format) {
+
+    const char *separator = (format != NULL && format->no_spaces) ?
+        "," : ", ";
+
+    fprintf(file, "{");
+    for (size_t i = 0; i < size[level]; i++) {
+        indices[level] = (ptrdiff_t)i;
+        if (level == dimensions - 1) {
+            /* Deepest level -> print number */
+            ptrdiff_t idx = strided_flat_index_impl_(indices, stride,
+                dimensions);
+            wldat_write_cplx_impl_(file, re[idx], im[idx], format);
+        } else {
+            /* Recurse into next level */
+            write_nested_braces_split_impl_(file, level + 1, dimensions,
+                size, stride, indices, re, im, format);
+        }
+        if (i + 1 < size[level]) fputs(separator, file);
+    }
+    fprintf(file, "}");
+}
+
+/*
+    Writes double-type data of a double-type array with arbitrary strides to
+    an opened file in the Wolfram Language package source format, after the
+    comment line.
+
+    Parameters:
+    - file, the file.
+    - data, array of double-type containing the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - stride, array of size N containing the stride of each dimension.
+    - comment, text to be stored at the very first line of the file.
+    - format, options of the numbers, or NULL for the default form.
+*/
+static inline void wldat_write_strided64_impl_(FILE *file,
+    const double *data, int dimensions, const size_t *size,
+    const ptrdiff_t *stride, const char *comment,
+    const dfl_wl_format *format) {
+
+    if (comment == NULL || comment[0] == '\0' ) {
+        fprintf(file, "(* Created with Data File Library:"
+            " <https://github.com/jodesarro/data-file-library> *)\n");
+    } else {
+        fprintf(file, "(* %s *)\n", comment);
+    }
+
+    ptrdiff_t indices[128];
+    write_nested_braces_impl_(file, 0, dimensions, size, stride,
+        indices, data, format);
+
+    /* Break line */
+    fprintf(file, "\n");
+}
+
+/*
+    Implementation for exporting double-type data of a double-type array with
+    arbitrary strides, e.g., following the column-major order or a sub-block
+    of a larger array, to Wolfram Language package source format of
+    arbitrary dimension.
 
     Parameters:
     - file_path, path to the data file.
-    - data, array of double-type of size S1*S2*...*SN, containing data
-    following the row-major order, where N is the number of dimensions,
-    and for each dimension n, being 1<=n<=N, Sn is its respective size.
+    - data, array of double-type containing the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
     - dimensions, number N of the dimensions of the data, limited to 128.
     - size, array of size N containing the size of each dimension.
+    - stride, array of size N containing the stride of each dimension.
     - comment, text to be stored at the very first line of the file.
+    - format, options of the numbers, or NULL for the default form.
 */
-static inline void wldat_export_impl_(const char *file_path,
-    const double *data, int dimensions, const int *size,
-    const char *comment) {
+static inline void wldat_export_strided64_impl_(const char *file_path,
+    const double *data, int dimensions, const size_t *size,
+    const ptrdiff_t *stride, const char *comment,
+    const dfl_wl_format *format) {
 
     /* Open file */
     FILE *file = fopen(file_path, "w");
     if (!file) {
         fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " wldat_export_impl_() ->"
+                        " wldat_export_strided64_impl_() ->"
                         " Error in opening file: %s."
                         " Exiting.", strerror(errno));
         exit(EXIT_FAILURE);
     }
 
+    wldat_write_strided64_impl_(file, data, dimensions, size, stride,
+        comment, format);
+
+    /* Close file */
+    fclose(file);
+}
+
+/*
+    Implementation for exporting double-type data of a double-type array with
+    arbitrary strides, as wldat_export_strided64_impl_(), with int sizes and
+    strides.
+*/
+static inline void wldat_export_strided_impl_(const char *file_path,
+    const double *data, int dimensions, const int *size, const int *stride,
+    const char *comment, const dfl_wl_format *format) {
+
+    size_t size64[128];
+    ptrdiff_t stride64[128];
+    widen_sizes_impl_(size, dimensions, size64);
+    widen_strides_impl_(stride, dimensions, stride64);
+    wldat_export_strided64_impl_(file_path, data, dimensions, size64,
+        stride64, comment, format);
+}
+
+/*
+    Implementation for exporting double-type data of an one-dimensional
+    double-type array, following the row-major order, to Wolfram Language
+    package source format of arbitrary dimension.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type of size S1*S2*...*SN, containing data
+    following the row-major order, where N is the number of dimensions,
+    and for each dimension n, being 1<=n<=N, Sn is its respective size.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension as
+    size_t, so that dimensions with more than 2^31 elements may be handled.
+    - comment, text to be stored at the very first line of the file.
+    - format, options of the numbers, or NULL for the default form.
+*/
+static inline void wldat_export64_impl_(const char *file_path,
+    const double *data, int dimensions, const size_t *size,
+    const char *comment, const dfl_wl_format *format) {
+
+    ptrdiff_t stride[128];
+    row_major_strides_impl_(size, dimensions, stride);
+    wldat_export_strided64_impl_(file_path, data, dimensions, size,
+        stride, comment, format);
+}
+
+/*
+    Implementation for exporting double-type data of an one-dimensional
+    double-type array, as wldat_export64_impl_(), with int sizes.
+*/
+static inline void wldat_export_impl_(const char *file_path,
+    const double *data, int dimensions, const int *size,
+    const char *comment, const dfl_wl_format *format) {
+
+    size_t size64[128];
+    widen_sizes_impl_(size, dimensions, size64);
+    wldat_export64_impl_(file_path, data, dimensions, size64, comment,
+        format);
+}
+
+/*
+    Writes 'double complex'-type data of a 'double complex'-type array with
+    arbitrary strides to an opened file in the Wolfram Language package
+    source format, after the comment line.
+
+    Parameters:
+    - file, the file.
+    - data, array of 'double complex'-type containing the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - stride, array of size N containing the stride of each dimension.
+    - comment, text to be stored at the very first line of the file.
+    - format, options of the numbers, or NULL for the default form.
+*/
+static inline void wldat_write_cplx_strided64_impl_(FILE *file,
+    const tpdfcplx_impl_ *data, int dimensions, const size_t *size,
+    const ptrdiff_t *stride, const char *comment,
+    const dfl_wl_format *format) {
+
     if (comment == NULL || comment[0] == '\0' ) {
         fprintf(file, "(* Created with Data File Library:"
             " <https://github.com/jodesarro/data-file-library> *)\n");
@@ -582,17 +1347,69 @@ static inline void wldat_export_impl_(const char *file_path,
         fprintf(file, "(* %s *)\n", comment);
     }
 
-    int indices[128];
-    write_nested_braces_impl_(file, 0, dimensions, size, indices,
-        data);
+    ptrdiff_t indices[128];
+    write_nested_braces_cplx_impl_(file, 0, dimensions, size, stride,
+        indices, data, format);
 
     /* Break line */
     fprintf(file, "\n");
+}
+
+/*
+    Implementation for exporting 'double complex'-type data of a
+    'double complex'-type array with arbitrary strides, e.g., following the
+    column-major order or a sub-block of a larger array, to Wolfram Language
+    package source format of arbitrary dimension.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of 'double complex'-type containing the value of indices
+    (i1, ..., iN) at data[i1*stride[0] + ... + iN*stride[N-1]].
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - stride, array of size N containing the stride of each dimension.
+    - comment, text to be stored at the very first line of the file.
+    - format, options of the numbers, or NULL for the default form.
+*/
+static inline void wldat_export_cplx_strided64_impl_(
+    const char *file_path, const tpdfcplx_impl_ *data, int dimensions,
+    const size_t *size, const ptrdiff_t *stride, const char *comment,
+    const dfl_wl_format *format) {
+
+    /* Open file */
+    FILE *file = fopen(file_path, "w");
+    if (!file) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " wldat_export_cplx_strided64_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+
+    wldat_write_cplx_strided64_impl_(file, data, dimensions, size, stride,
+        comment, format);
 
     /* Close file */
     fclose(file);
 }
 
+/*
+    Implementation for exporting 'double complex'-type data of a
+    'double complex'-type array with arbitrary strides, as
+    wldat_export_cplx_strided64_impl_(), with int sizes and strides.
+*/
+static inline void wldat_export_cplx_strided_impl_(const char *file_path,
+    const tpdfcplx_impl_ *data, int dimensions, const int *size,
+    const int *stride, const char *comment, const dfl_wl_format *format) {
+
+    size_t size64[128];
+    ptrdiff_t stride64[128];
+    widen_sizes_impl_(size, dimensions, size64);
+    widen_strides_impl_(stride, dimensions, stride64);
+    wldat_export_cplx_strided64_impl_(file_path, data, dimensions, size64,
+        stride64, comment, format);
+}
+
 /*
     Implementation for exporting 'double complex'-type data of an
     one-dimensional 'double complex'-type array, following the row-major
@@ -605,18 +1422,62 @@ static inline void wldat_export_impl_(const char *file_path,
     dimensions, and for each dimension n, being 1<=n<=N, Sn is its respective
     size.
     - dimensions, number N of the dimensions of the data, limited to 128.
-    - size, array of size N containing the size of each dimension.
+    - size, array of size N containing the size of each dimension as
+    size_t, so that dimensions with more than 2^31 elements may be handled.
     - comment, text to be stored at the very first line of the file.
+    - format, options of the numbers, or NULL for the default form.
+*/
+static inline void wldat_export_cplx64_impl_(const char *file_path,
+    const tpdfcplx_impl_ *data, int dimensions, const size_t *size,
+    const char *comment, const dfl_wl_format *format) {
+
+    ptrdiff_t stride[128];
+    row_major_strides_impl_(size, dimensions, stride);
+    wldat_export_cplx_strided64_impl_(file_path, data, dimensions, size,
+        stride, comment, format);
+}
+
+/*
+    Implementation for exporting 'double complex'-type data of an
+    one-dimensional 'double complex'-type array, as
+    wldat_export_cplx64_impl_(), with int sizes.
 */
 static inline void wldat_export_cplx_impl_(const char *file_path,
     const tpdfcplx_impl_ *data, int dimensions, const int *size,
-    const char *comment) {
+    const char *comment, const dfl_wl_format *format) {
+
+    size_t size64[128];
+    widen_sizes_impl_(size, dimensions, size64);
+    wldat_export_cplx64_impl_(file_path, data, dimensions, size64, comment,
+        format);
+}
+
+/*
+    Implementation for exporting 'double complex'-type data given by two
+    double-type arrays, one with the real parts and one with the imaginary
+    parts, following the row-major order, to Wolfram Language package source
+    format of arbitrary dimension, without an interleaved intermediate array.
+
+    Parameters:
+    - file_path, path to the data file.
+    - re, array of double-type of size S1*S2*...*SN containing the real
+    parts following the row-major order.
+    - im, array of double-type of size S1*S2*...*SN containing the
+    imaginary parts following the row-major order.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+    - format, options of the numbers, or NULL for the default form.
+*/
+static inline void wldat_export_cplx_split_impl_(const char *file_path,
+    const double *re, const double *im, int dimensions, const int *size,
+    const char *comment, const dfl_wl_format *format) {
 
     /* Open file */
     FILE *file = fopen(file_path, "w");
     if (!file) {
         fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
-                        " wldat_export_cplx_impl_() ->"
+                        " wldat_export_cplx_split_impl_() ->"
                         " Error in opening file: %s."
                         " Exiting.", strerror(errno));
         exit(EXIT_FAILURE);
@@ -629,9 +1490,13 @@ static inline void wldat_export_cplx_impl_(const char *file_path,
         fprintf(file, "(* %s *)\n", comment);
     }
 
-    int indices[128];
-    write_nested_braces_cplx_impl_(file, 0, dimensions, size, indices,
-        data);
+    size_t size64[128];
+    widen_sizes_impl_(size, dimensions, size64);
+    ptrdiff_t stride[128];
+    row_major_strides_impl_(size64, dimensions, stride);
+    ptrdiff_t indices[128];
+    write_nested_braces_split_impl_(file, 0, dimensions, size64, stride,
+        indices, re, im, format);
 
     /* Break line */
     fprintf(file, "\n");
@@ -640,4 +1505,54 @@ static inline void wldat_export_cplx_impl_(const char *file_path,
     fclose(file);
 }
 
+/*
+    Implementation for exporting double-type or 'double complex'-type data
+    of an one-dimensional array, following the row-major order, to Wolfram
+    Language package source format of arbitrary dimension through a file of
+    the direct exports (see direct_impl_.h), preallocated with an upper
+    bound of its size, i.e., 27 bytes per real value, 56 bytes per complex
+    value and 4 bytes per list. Returns 0, or the errno of the failure to
+    open or write the file.
+
+    Parameters:
+    - file_path, path to the data file.
+    - data, array of double-type of size S1*S2*...*SN containing data
+    following the row-major order, or NULL.
+    - data_cplx, array of 'double complex'-type of size S1*S2*...*SN
+    containing data following the row-major order, used if data is NULL.
+    - dimensions, number N of the dimensions of the data, limited to 128.
+    - size, array of size N containing the size of each dimension.
+    - comment, text to be stored at the very first line of the file.
+*/
+static inline int wldat_export_direct_impl_(const char *file_path,
+    const double *data, const tpdfcplx_impl_ *data_cplx, int dimensions,
+    const int *size, const char *comment) {
+
+    size_t size64[128];
+    widen_sizes_impl_(size, dimensions, size64);
+    ptrdiff_t stride[128];
+    row_major_strides_impl_(size64, dimensions, stride);
+
+    /* At most 25 chars per "m*^n" number, plus ", " or " + ", "*I" and
+       ", ", and "{", "}" and ", " per list */
+    long long lists = 0, values = 1;
+    for (int n = 0; n < dimensions; n++) {
+        lists += (long long)values;
+        values *= (long long)size64[n];
+    }
+    long long estimate = values*(data != NULL ? 27 : 56) + 4*lists + 128 +
+        (comment != NULL ? (long long)strlen(comment) : 0);
+    FILE *file = direct_fopen_impl_(file_path, estimate);
+    if (!file) return errno != 0 ? errno : EIO;
+
+    if (data != NULL) {
+        wldat_write_strided64_impl_(file, data, dimensions, size64, stride,
+            comment, NULL);
+    } else {
+        wldat_write_cplx_strided64_impl_(file, data_cplx, dimensions, size64,
+            stride, comment, NULL);
+    }
+    return direct_fclose_impl_(file);
+}
+
 #endif /* DATA_FILE_LIBRARY_WLDAT_IMPL_H */
\ No newline at end of file
@@ -0,0 +1,812 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: include/data-file-library/impl/zarrdat_impl_.h
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Implementation of a chunked store of N-dimensional arrays in the
+        Zarr version 2 layout, i.e., a directory with a .zarray JSON
+        manifest and one file per chunk of the row-major array, named by
+        the indices of the chunk joined by dots (e.g., 0.2.1). The chunks
+        are stored raw or, when the library is compiled with
+        DATA_FILE_LIBRARY_ZLIB (and linked with -lz), compressed by zlib.
+        The chunks are written and read by a pool of threads, and the reads
+        of a slab (a box of the array) touch only the chunks that overlap
+        it, so that a slice of a large field is read in a fraction of the
+        time of the whole field.
+*/
+
+#ifndef DATA_FILE_LIBRARY_ZARRDAT_IMPL_H
+#define DATA_FILE_LIBRARY_ZARRDAT_IMPL_H
+
+#include <stdio.h>
+#include <stdlib.h> /* For strtod(), strtoull() and free() */
+#include <string.h> /* For memcpy(), memset(), strstr() and strerror() */
+#include <errno.h> /* For errno */
+#include <math.h> /* For NAN and INFINITY */
+#include <limits.h> /* For INT_MAX */
+#include <sys/stat.h> /* For stat() and mkdir() */
+#include "cplx_c_cpp_impl_.h"
+#include "alloc_impl_.h"
+#include "thread_impl_.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <direct.h> /* For _mkdir() */
+#endif
+
+#ifdef DATA_FILE_LIBRARY_ZLIB
+#include <zlib.h> /* For compress2() and uncompress() */
+#endif
+
+/* Largest number of dimensions of a store */
+#define DFL_ZARR_MAX_DIMENSIONS_IMPL_ 32
+
+/*
+    Manifest of a store.
+    - dimensions, number N of dimensions.
+    - shape, size of each dimension of the array.
+    - chunk, size of each dimension of the chunks.
+    - cplx, whether the values are complex numbers.
+    - swap, whether the byte order of the values differs from the host.
+    - level, zlib level of the chunks, or 0 if they are raw.
+    - separator, separator of the indices in the names of the chunks.
+    - fill, value of the missing chunks, real and imaginary parts.
+*/
+typedef struct {
+    int dimensions;
+    size_t shape[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t chunk[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    int cplx;
+    int swap;
+    int level;
+    char separator;
+    double fill[2];
+} zarrdat_meta_impl_;
+
+/*
+    State shared by the threads that write or read the chunks of a slab.
+*/
+typedef struct {
+    const char *dir_path;
+    const zarrdat_meta_impl_ *meta;
+    unsigned char *data;
+    size_t start[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t count[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t first[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t chunks[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t total;
+    size_t next;
+    int writing;
+    int status;
+    tpmutex_impl_ mutex;
+} zarrdat_context_impl_;
+
+/*
+    Returns 1 if the host stores numbers in the little-endian byte order.
+*/
+static inline int host_little_endian_impl_(void) {
+    const unsigned short one = 1;
+    return *(const unsigned char *)&one == 1;
+}
+
+/*
+    Returns the size in bytes of the values of a store.
+*/
+static inline size_t zarrdat_value_size_impl_(
+    const zarrdat_meta_impl_ *meta) {
+
+    return meta->cplx ? sizeof(tpdfcplx_impl_) : sizeof(double);
+}
+
+/*
+    Returns the number of values of a chunk.
+*/
+static inline size_t zarrdat_chunk_count_impl_(
+    const zarrdat_meta_impl_ *meta) {
+
+    size_t count = 1;
+    for (int d = 0; d < meta->dimensions; d++) {
+        count *= meta->chunk[d];
+    }
+    return count;
+}
+
+/*
+    Writes the path of a file of a store, i.e., dir_path/name, to a buffer
+    allocated here, to be released with free().
+*/
+static inline char *zarrdat_path_impl_(const char *dir_path,
+    const char *name) {
+
+    size_t length = strlen(dir_path) + strlen(name) + 2;
+    char *path = (char *)dfl_allocate_impl_(NULL, length);
+    snprintf(path, length, "%s/%s", dir_path, name);
+    return path;
+}
+
+/*
+    Writes the name of a chunk, i.e., its indices joined by the separator,
+    to a buffer of at least 21 bytes per dimension.
+*/
+static inline void zarrdat_chunk_name_impl_(char *name,
+    const zarrdat_meta_impl_ *meta, const size_t *index) {
+
+    char *cursor = name;
+    for (int d = 0; d < meta->dimensions; d++) {
+        if (d > 0) *cursor++ = meta->separator;
+        cursor += sprintf(cursor, "%llu", (unsigned long long)index[d]);
+    }
+}
+
+/*
+    Returns a pointer to the value of a key of a JSON object, after the
+    colon and the blanks, or NULL if the key is not found.
+*/
+static inline const char *json_value_impl_(const char *json,
+    const char *key) {
+
+    size_t length = strlen(key);
+    const char *p = json;
+    while ((p = strstr(p, key)) != NULL) {
+        if (p > json && p[-1] == '"' && p[length] == '"') {
+            p += length + 1;
+            while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+            if (*p != ':') return NULL;
+            p++;
+            while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+            return p;
+        }
+        p += length;
+    }
+    return NULL;
+}
+
+/*
+    Parses a JSON array of at most max non-negative integers, and returns
+    their number, or -1 if it is not such an array or if an integer exceeds
+    INT_MAX, the limit of the int sizes of the zarrdat functions.
+*/
+static inline int json_sizes_impl_(const char *p, size_t *sizes, int max) {
+    if (p == NULL || *p != '[') return -1;
+    p++;
+    int count = 0;
+    for (;;) {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+        if (*p == ']') return count;
+        if (count == max || *p < '0' || *p > '9') return -1;
+        char *end;
+        unsigned long long value = strtoull(p, &end, 10);
+        if (value > (unsigned long long)INT_MAX) return -1;
+        sizes[count++] = (size_t)value;
+        p = end;
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+        if (*p == ',') p++;
+    }
+}
+
+/*
+    Returns 1 if a JSON value is the string str, otherwise 0.
+*/
+static inline int json_string_is_impl_(const char *p, const char *str) {
+    size_t length = strlen(str);
+    return p != NULL && *p == '"' && strncmp(p + 1, str, length) == 0 &&
+        p[length + 1] == '"';
+}
+
+/*
+    Parses a JSON number, or one of the strings "NaN", "Infinity" and
+    "-Infinity" used by Zarr, where null is 0.
+*/
+static inline double json_number_impl_(const char *p) {
+    if (json_string_is_impl_(p, "NaN")) return NAN;
+    if (json_string_is_impl_(p, "Infinity")) return INFINITY;
+    if (json_string_is_impl_(p, "-Infinity")) return -INFINITY;
+    if (*p == 'n') return 0.0;
+    return strtod(p, NULL);
+}
+
+/*
+    Implementation for reading the .zarray manifest of a store. Returns 0
+    on success, the errno of the failure to open it, or EINVAL if the store
+    is not supported, e.g., of another type than float64 or complex128, in
+    the Fortran order, with filters, or with another compressor than zlib
+    (or with zlib, when the library is compiled without it).
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - meta, to output the manifest.
+*/
+static inline int zarrdat_read_meta_impl_(const char *dir_path,
+    zarrdat_meta_impl_ *meta) {
+
+    /* Read the whole manifest */
+    char *path = zarrdat_path_impl_(dir_path, ".zarray");
+    FILE *file = fopen(path, "rb");
+    int error = errno != 0 ? errno : EIO;
+    free(path);
+    if (!file) return error;
+    size_t capacity = 4096;
+    size_t length = 0;
+    char *json = (char *)dfl_allocate_impl_(NULL, capacity);
+    size_t n;
+    while ((n = fread(json + length, 1, capacity - length - 1, file)) > 0) {
+        length += n;
+        if (length == capacity - 1) {
+            capacity *= 2;
+            char *grown = (char *)dfl_allocate_impl_(NULL, capacity);
+            memcpy(grown, json, length);
+            free(json);
+            json = grown;
+        }
+    }
+    json[length] = '\0';
+    fclose(file);
+
+    memset(meta, 0, sizeof(zarrdat_meta_impl_));
+    int status = EINVAL;
+    const char *p;
+    const char *dtype = json_value_impl_(json, "dtype");
+    const char *compressor = json_value_impl_(json, "compressor");
+    const char *filters = json_value_impl_(json, "filters");
+    const char *separator = json_value_impl_(json, "dimension_separator");
+    const char *fill = json_value_impl_(json, "fill_value");
+    int big_endian = dtype != NULL && dtype[0] == '"' && dtype[1] == '>';
+    meta->dimensions = json_sizes_impl_(json_value_impl_(json, "shape"),
+        meta->shape, DFL_ZARR_MAX_DIMENSIONS_IMPL_);
+    meta->cplx = json_string_is_impl_(dtype, "<c16") ||
+        json_string_is_impl_(dtype, ">c16");
+    meta->swap = big_endian == host_little_endian_impl_();
+    meta->separator = json_string_is_impl_(separator, "/") ? '/' : '.';
+
+    if (((p = json_value_impl_(json, "zarr_format")) == NULL ||
+        strtol(p, NULL, 10) != 2) || meta->dimensions < 1 ||
+        json_sizes_impl_(json_value_impl_(json, "chunks"), meta->chunk,
+        DFL_ZARR_MAX_DIMENSIONS_IMPL_) != meta->dimensions ||
+        !json_string_is_impl_(json_value_impl_(json, "order"), "C") ||
+        (!meta->cplx && !json_string_is_impl_(dtype, "<f8") &&
+        !json_string_is_impl_(dtype, ">f8")) ||
+        (filters != NULL && *filters != 'n' &&
+        strncmp(filters, "[]", 2) != 0)) {
+        goto done;
+    }
+    for (int d = 0; d < meta->dimensions; d++) {
+        if (meta->chunk[d] == 0) goto done;
+    }
+
+    /* Compressor, null or zlib */
+    if (compressor != NULL && *compressor == '{') {
+        if (!json_string_is_impl_(json_value_impl_(compressor, "id"),
+            "zlib")) {
+            goto done;
+        }
+#ifdef DATA_FILE_LIBRARY_ZLIB
+        p = json_value_impl_(compressor, "level");
+        meta->level = p != NULL ? (int)strtol(p, NULL, 10) : 1;
+        if (meta->level <= 0) meta->level = 1;
+#else
+        goto done;
+#endif
+    }
+
+    /* Fill value, a number, or a pair for complex values */
+    if (fill != NULL && *fill == '[') {
+        fill++;
+        while (*fill == ' ') fill++;
+        meta->fill[0] = json_number_impl_(fill);
+        fill = strchr(fill, ',');
+        if (fill != NULL) {
+            fill++;
+            while (*fill == ' ') fill++;
+            meta->fill[1] = json_number_impl_(fill);
+        }
+    } else if (fill != NULL) {
+        meta->fill[0] = json_number_impl_(fill);
+    }
+    status = 0;
+
+done:
+    free(json);
+    return status;
+}
+
+/*
+    Implementation for writing the .zarray manifest of a store, creating
+    its directory if needed. Returns 0 on success or the errno of the
+    failure.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - meta, the manifest.
+*/
+static inline int zarrdat_write_meta_impl_(const char *dir_path,
+    const zarrdat_meta_impl_ *meta) {
+
+#if defined(_WIN32) || defined(_WIN64)
+    if (_mkdir(dir_path) != 0 && errno != EEXIST) return errno;
+#else
+    if (mkdir(dir_path, 0777) != 0 && errno != EEXIST) return errno;
+#endif
+
+    char *path = zarrdat_path_impl_(dir_path, ".zarray");
+    FILE *file = fopen(path, "wb");
+    int error = errno != 0 ? errno : EIO;
+    free(path);
+    if (!file) return error;
+
+    fprintf(file, "{\n    \"chunks\": [");
+    for (int d = 0; d < meta->dimensions; d++) {
+        fprintf(file, d > 0 ? ", %llu" : "%llu",
+            (unsigned long long)meta->chunk[d]);
+    }
+    fprintf(file, "],\n    \"compressor\": ");
+    if (meta->level > 0) {
+        fprintf(file, "{\"id\": \"zlib\", \"level\": %d}", meta->level);
+    } else {
+        fprintf(file, "null");
+    }
+    fprintf(file, ",\n    \"dimension_separator\": \"%c\",\n",
+        meta->separator);
+    fprintf(file, "    \"dtype\": \"%c%s\",\n",
+        host_little_endian_impl_() ? '<' : '>', meta->cplx ? "c16" : "f8");
+    fprintf(file, "    \"fill_value\": %s,\n",
+        meta->cplx ? "[0.0, 0.0]" : "0.0");
+    fprintf(file, "    \"filters\": null,\n    \"order\": \"C\",\n");
+    fprintf(file, "    \"shape\": [");
+    for (int d = 0; d < meta->dimensions; d++) {
+        fprintf(file, d > 0 ? ", %llu" : "%llu",
+            (unsigned long long)meta->shape[d]);
+    }
+    fprintf(file, "],\n    \"zarr_format\": 2\n}\n");
+
+    int status = ferror(file) ? EIO : 0;
+    if (fclose(file) != 0 && status == 0) status = errno != 0 ? errno : EIO;
+    return status;
+}
+
+/*
+    Copies the values of the intersection of a chunk and the slab of a
+    context between the chunk buffer and the slab.
+
+    Parameters:
+    - context, the context.
+    - origin, global index of the first value of the chunk.
+    - chunk_data, the values of the chunk, following the row-major order.
+    - to_chunk, 1 to copy from the slab to the chunk, 0 for the opposite.
+*/
+static inline void zarrdat_copy_impl_(const zarrdat_context_impl_ *context,
+    const size_t *origin, unsigned char *chunk_data, int to_chunk) {
+
+    const zarrdat_meta_impl_ *meta = context->meta;
+    int n = meta->dimensions;
+    size_t value_size = zarrdat_value_size_impl_(meta);
+    size_t lo[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t hi[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t index[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t chunk_stride[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t slab_stride[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    for (int d = 0; d < n; d++) {
+        size_t chunk_end = origin[d] + meta->chunk[d];
+        size_t slab_end = context->start[d] + context->count[d];
+        lo[d] = origin[d] > context->start[d] ? origin[d] : context->start[d];
+        hi[d] = chunk_end < slab_end ? chunk_end : slab_end;
+        if (lo[d] >= hi[d]) return;
+        index[d] = lo[d];
+    }
+    chunk_stride[n - 1] = 1;
+    slab_stride[n - 1] = 1;
+    for (int d = n - 2; d >= 0; d--) {
+        chunk_stride[d] = chunk_stride[d + 1] * meta->chunk[d + 1];
+        slab_stride[d] = slab_stride[d + 1] * context->count[d + 1];
+    }
+
+    /* One contiguous run along the last dimension per row */
+    size_t run = (hi[n - 1] - lo[n - 1]) * value_size;
+    for (;;) {
+        size_t chunk_offset = 0;
+        size_t slab_offset = 0;
+        for (int d = 0; d < n; d++) {
+            chunk_offset += (index[d] - origin[d]) * chunk_stride[d];
+            slab_offset += (index[d] - context->start[d]) * slab_stride[d];
+        }
+        unsigned char *chunk_ptr = chunk_data + chunk_offset*value_size;
+        unsigned char *slab_ptr = context->data + slab_offset*value_size;
+        if (to_chunk) {
+            memcpy(chunk_ptr, slab_ptr, run);
+        } else {
+            memcpy(slab_ptr, chunk_ptr, run);
+        }
+
+        int d = n - 2;
+        while (d >= 0) {
+            if (++index[d] < hi[d]) break;
+            index[d] = lo[d];
+            d--;
+        }
+        if (d < 0) break;
+    }
+}
+
+/*
+    Writes one chunk of a store from the slab of a context, which is the
+    whole array. Returns 0 on success or the errno of the failure.
+
+    Parameters:
+    - context, the context.
+    - index, indices of the chunk.
+    - origin, global index of the first value of the chunk.
+    - chunk_data, buffer of the size of a chunk.
+    - packed, buffer of packed_size bytes for the compressed chunk.
+    - packed_size, size of packed.
+*/
+static inline int zarrdat_write_chunk_impl_(
+    const zarrdat_context_impl_ *context, const size_t *index,
+    const size_t *origin, unsigned char *chunk_data, unsigned char *packed,
+    size_t packed_size) {
+
+    const zarrdat_meta_impl_ *meta = context->meta;
+    size_t bytes = zarrdat_chunk_count_impl_(meta) *
+        zarrdat_value_size_impl_(meta);
+
+    /* Chunks at the edges are padded with the fill value (0) */
+    for (int d = 0; d < meta->dimensions; d++) {
+        if (origin[d] + meta->chunk[d] > meta->shape[d]) {
+            memset(chunk_data, 0, bytes);
+            break;
+        }
+    }
+    zarrdat_copy_impl_(context, origin, chunk_data, 1);
+
+    const unsigned char *output = chunk_data;
+    size_t output_size = bytes;
+#ifdef DATA_FILE_LIBRARY_ZLIB
+    if (meta->level > 0) {
+        uLongf length = (uLongf)packed_size;
+        if (compress2(packed, &length, chunk_data, (uLong)bytes,
+            meta->level) != Z_OK) {
+            return EIO;
+        }
+        output = packed;
+        output_size = (size_t)length;
+    }
+#else
+    (void)packed;
+    (void)packed_size;
+#endif
+
+    char name[21*DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    zarrdat_chunk_name_impl_(name, meta, index);
+    char *path = zarrdat_path_impl_(context->dir_path, name);
+    FILE *file = fopen(path, "wb");
+    int error = errno != 0 ? errno : EIO;
+    free(path);
+    if (!file) return error;
+    int status = fwrite(output, 1, output_size, file) == output_size ? 0 :
+        EIO;
+    if (fclose(file) != 0 && status == 0) status = errno != 0 ? errno : EIO;
+    return status;
+}
+
+/*
+    Reads one chunk of a store into the slab of a context. Missing chunks
+    hold the fill value. Returns 0 on success, the errno of the failure to
+    open the chunk, or EINVAL if it does not have the size of a chunk.
+
+    Parameters:
+    - context, the context.
+    - index, indices of the chunk.
+    - origin, global index of the first value of the chunk.
+    - chunk_data, buffer of the size of a chunk.
+    - packed, pointer to a buffer for the compressed chunk, grown here.
+    - packed_size, pointer to the size of packed.
+*/
+static inline int zarrdat_read_chunk_impl_(
+    const zarrdat_context_impl_ *context, const size_t *index,
+    const size_t *origin, unsigned char *chunk_data, unsigned char **packed,
+    size_t *packed_size) {
+
+    const zarrdat_meta_impl_ *meta = context->meta;
+    size_t count = zarrdat_chunk_count_impl_(meta);
+    size_t bytes = count * zarrdat_value_size_impl_(meta);
+
+    char name[21*DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    zarrdat_chunk_name_impl_(name, meta, index);
+    char *path = zarrdat_path_impl_(context->dir_path, name);
+    struct stat info;
+    FILE *file = stat(path, &info) == 0 ? fopen(path, "rb") : NULL;
+    int error = errno != 0 ? errno : EIO;
+    free(path);
+
+    if (!file) {
+        if (error != ENOENT) return error;
+        /* Missing chunk */
+        double *values = (double *)chunk_data;
+        for (size_t k = 0; k < count; k++) {
+            if (meta->cplx) {
+                values[2*k] = meta->fill[0];
+                values[2*k + 1] = meta->fill[1];
+            } else {
+                values[k] = meta->fill[0];
+            }
+        }
+    } else {
+        size_t size = (size_t)info.st_size;
+        int status = 0;
+        if (meta->level > 0) {
+#ifdef DATA_FILE_LIBRARY_ZLIB
+            if (size > *packed_size) {
+                free(*packed);
+                *packed = (unsigned char *)dfl_allocate_impl_(NULL, size);
+                *packed_size = size;
+            }
+            uLongf length = (uLongf)bytes;
+            if (fread(*packed, 1, size, file) != size ||
+                uncompress(chunk_data, &length, *packed, (uLong)size) !=
+                Z_OK || (size_t)length != bytes) {
+                status = EINVAL;
+            }
+#else
+            (void)packed;
+            (void)packed_size;
+#endif
+        } else if (size != bytes || fread(chunk_data, 1, bytes, file) !=
+            bytes) {
+            status = EINVAL;
+        }
+        fclose(file);
+        if (status != 0) return status;
+
+        /* Values in the other byte order */
+        if (meta->swap) {
+            for (size_t k = 0; k < bytes; k += 8) {
+                for (int b = 0; b < 4; b++) {
+                    unsigned char byte = chunk_data[k + b];
+                    chunk_data[k + b] = chunk_data[k + 7 - b];
+                    chunk_data[k + 7 - b] = byte;
+                }
+            }
+        }
+    }
+    zarrdat_copy_impl_(context, origin, chunk_data, 0);
+    return 0;
+}
+
+/*
+    Thread of a write or a read. Each thread takes the next chunk not yet
+    taken until all chunks are done or one fails.
+
+    Parameter:
+    - arg, the zarrdat_context_impl_.
+*/
+static inline void *zarrdat_worker_impl_(void *arg) {
+    zarrdat_context_impl_ *context = (zarrdat_context_impl_ *)arg;
+    const zarrdat_meta_impl_ *meta = context->meta;
+    int n = meta->dimensions;
+    size_t bytes = zarrdat_chunk_count_impl_(meta) *
+        zarrdat_value_size_impl_(meta);
+    unsigned char *chunk_data = (unsigned char *)dfl_allocate_impl_(NULL,
+        bytes);
+    unsigned char *packed = NULL;
+    size_t packed_size = 0;
+#ifdef DATA_FILE_LIBRARY_ZLIB
+    if (context->writing && meta->level > 0) {
+        packed_size = (size_t)compressBound((uLong)bytes);
+        packed = (unsigned char *)dfl_allocate_impl_(NULL, packed_size);
+    }
+#endif
+
+    for (;;) {
+        mutex_lock_impl_(&context->mutex);
+        size_t k = context->next++;
+        int failed = context->status != 0;
+        mutex_unlock_impl_(&context->mutex);
+        if (k >= context->total || failed) break;
+
+        /* Indices of the k-th chunk of the range, in the row-major order */
+        size_t index[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+        size_t origin[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+        for (int d = n - 1; d >= 0; d--) {
+            index[d] = context->first[d] + k % context->chunks[d];
+            k /= context->chunks[d];
+            origin[d] = index[d] * meta->chunk[d];
+        }
+
+        int status = context->writing ?
+            zarrdat_write_chunk_impl_(context, index, origin, chunk_data,
+            packed, packed_size) :
+            zarrdat_read_chunk_impl_(context, index, origin, chunk_data,
+            &packed, &packed_size);
+        if (status != 0) {
+            mutex_lock_impl_(&context->mutex);
+            if (context->status == 0) context->status = status;
+            mutex_unlock_impl_(&context->mutex);
+        }
+    }
+    free(packed);
+    free(chunk_data);
+    return NULL;
+}
+
+/*
+    Writes or reads the chunks that overlap a slab with a pool of threads.
+    Returns 0 on success or the status of the first chunk that failed.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - meta, the manifest.
+    - data, the values of the slab, following the row-major order.
+    - start, index of the first value of the slab in each dimension.
+    - count, size of the slab in each dimension.
+    - threads, number of threads, where 0 selects the number of processors.
+    - writing, 1 to write the chunks, 0 to read them.
+*/
+static inline int zarrdat_run_impl_(const char *dir_path,
+    const zarrdat_meta_impl_ *meta, void *data, const size_t *start,
+    const size_t *count, int threads, int writing) {
+
+    zarrdat_context_impl_ context;
+    context.dir_path = dir_path;
+    context.meta = meta;
+    context.data = (unsigned char *)data;
+    context.total = 1;
+    for (int d = 0; d < meta->dimensions; d++) {
+        if (count[d] == 0) return 0;
+        context.start[d] = start[d];
+        context.count[d] = count[d];
+        context.first[d] = start[d] / meta->chunk[d];
+        context.chunks[d] = (start[d] + count[d] - 1) / meta->chunk[d] -
+            context.first[d] + 1;
+        context.total *= context.chunks[d];
+    }
+    context.next = 0;
+    context.writing = writing;
+    context.status = 0;
+    mutex_init_impl_(&context.mutex);
+
+    if (threads <= 0) threads = hardware_threads_impl_();
+    if ((size_t)threads > context.total) threads = (int)context.total;
+
+    /* The calling thread works as one of the threads */
+    tpthread_impl_ *pool = NULL;
+    if (threads > 1) {
+        pool = (tpthread_impl_ *)dfl_allocate_impl_(NULL,
+            (size_t)(threads - 1) * sizeof(tpthread_impl_));
+        for (int t = 0; t < threads - 1; t++) {
+            thread_create_impl_(&pool[t], zarrdat_worker_impl_, &context);
+        }
+    }
+    zarrdat_worker_impl_(&context);
+    for (int t = 0; t < threads - 1; t++) {
+        thread_join_impl_(pool[t]);
+    }
+    free(pool);
+
+    mutex_destroy_impl_(&context.mutex);
+    return context.status;
+}
+
+/*
+    Implementation for exporting an N-dimensional array, following the
+    row-major order, to a chunked store. Returns 0 on success, the errno of
+    the failure to write a file, or EINVAL for invalid sizes, or a level
+    above 0 when the library is compiled without zlib.
+
+    Parameters:
+    - dir_path, path to the directory of the store, created if needed.
+    - data, the S1*S2*...*SN values.
+    - dimensions, number N of dimensions.
+    - size, size of each dimension of the array.
+    - chunk, size of each dimension of the chunks.
+    - level, zlib level (1 to 9) of the chunks, or 0 for raw chunks.
+    - threads, number of threads, where 0 selects the number of processors.
+    - cplx, whether the values are complex numbers.
+*/
+static inline int zarrdat_export_impl_(const char *dir_path,
+    const void *data, int dimensions, const int *size, const int *chunk,
+    int level, int threads, int cplx) {
+
+    if (dimensions < 1 || dimensions > DFL_ZARR_MAX_DIMENSIONS_IMPL_ ||
+        level < 0 || level > 9) {
+        return EINVAL;
+    }
+#ifndef DATA_FILE_LIBRARY_ZLIB
+    if (level > 0) return EINVAL;
+#endif
+
+    zarrdat_meta_impl_ meta;
+    memset(&meta, 0, sizeof(meta));
+    meta.dimensions = dimensions;
+    meta.cplx = cplx;
+    meta.level = level;
+    meta.separator = '.';
+    size_t start[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    for (int d = 0; d < dimensions; d++) {
+        if (size[d] < 0 || chunk[d] < 1) return EINVAL;
+        meta.shape[d] = (size_t)size[d];
+        meta.chunk[d] = (size_t)chunk[d];
+        start[d] = 0;
+    }
+
+    int status = zarrdat_write_meta_impl_(dir_path, &meta);
+    if (status != 0) return status;
+    return zarrdat_run_impl_(dir_path, &meta, (void *)data, start,
+        meta.shape, threads, 1);
+}
+
+/*
+    Implementation for importing a slab of a chunked store, reading only
+    the chunks that overlap it. Returns 0 on success, the errno of the
+    failure to open a file, or EINVAL if the store is not supported, is of
+    the other value type, or the slab is out of its bounds.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - data, array of count[0]*count[1]*...*count[N-1] values to output the
+    slab following the row-major order.
+    - start, index of the first value of the slab in each dimension, or
+    NULL for the whole array.
+    - count, size of the slab in each dimension, or NULL for the whole
+    array.
+    - threads, number of threads, where 0 selects the number of processors.
+    - cplx, whether the values are complex numbers.
+*/
+static inline int zarrdat_import_slab_impl_(const char *dir_path,
+    void *data, const int *start, const int *count, int threads,
+    int cplx) {
+
+    zarrdat_meta_impl_ meta;
+    int status = zarrdat_read_meta_impl_(dir_path, &meta);
+    if (status != 0) return status;
+    if (meta.cplx != cplx) return EINVAL;
+
+    size_t first[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    size_t sizes[DFL_ZARR_MAX_DIMENSIONS_IMPL_];
+    for (int d = 0; d < meta.dimensions; d++) {
+        first[d] = start != NULL ? (size_t)start[d] : 0;
+        sizes[d] = count != NULL ? (size_t)count[d] : meta.shape[d];
+        if ((start != NULL && start[d] < 0) ||
+            (count != NULL && count[d] < 0) || first[d] > meta.shape[d] ||
+            sizes[d] > meta.shape[d] - first[d]) {
+            return EINVAL;
+        }
+    }
+    return zarrdat_run_impl_(dir_path, &meta, data, first, sizes, threads,
+        0);
+}
+
+/*
+    Implementation for getting the number of dimensions, the size of each
+    dimension, or the size of each dimension of the chunks of a store,
+    exiting with a warning if its manifest cannot be read. Returns the
+    number of dimensions.
+
+    Parameters:
+    - dir_path, path to the directory of the store.
+    - size, array of size N to output the size of each dimension, or NULL.
+    - chunk, array of size N to output the size of each dimension of the
+    chunks, or NULL.
+*/
+static inline int zarrdat_get_sizes_impl_(const char *dir_path, int *size,
+    int *chunk) {
+
+    zarrdat_meta_impl_ meta;
+    int status = zarrdat_read_meta_impl_(dir_path, &meta);
+    if (status != 0) {
+        fprintf(stderr, "[DATA-FILE-LIBRARY WARNING]"
+                        " zarrdat_get_sizes_impl_() ->"
+                        " Error in opening file: %s."
+                        " Exiting.", status == EINVAL ?
+                        "Not a supported Zarr store" : strerror(status));
+        exit(EXIT_FAILURE);
+    }
+    for (int d = 0; d < meta.dimensions; d++) {
+        if (size != NULL) size[d] = (int)meta.shape[d];
+        if (chunk != NULL) chunk[d] = (int)meta.chunk[d];
+    }
+    return meta.dimensions;
+}
+
+#endif /* DATA_FILE_LIBRARY_ZARRDAT_IMPL_H */
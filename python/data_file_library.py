@@ -0,0 +1,505 @@
+"""
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: python/data_file_library.py
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: Python 3 with NumPy
+    License: include/data-file-library/license.txt
+
+    Description:
+        NumPy binding of the compiled library (see the Makefile). Every
+        import function allocates the output NumPy array exactly once and
+        lets the C parser fill its buffer in place, so no copy is done after
+        parsing. Arrays in the Fortran (column-major) order and strided views,
+        e.g., slices of larger arrays, are exported as they are, and imports
+        may fill Fortran-ordered arrays, through the *_strided() functions.
+        The calls go through ctypes, which releases the GIL while the
+        C functions run, so several Python threads may parse files at the
+        same time. The *_import_arrow() functions return pyarrow record
+        batches that take the buffers of the C parser through the Arrow C
+        Data Interface, also without a copy.
+
+        The imports of CSV, TSV and WL files scan the file once for its
+        sizes and once for its values, through the *_get_sizes_status() and
+        *_read_*strided() functions, which return the errno of a failure
+        instead of exiting, raised here as OSError.
+
+        WARNING: the other C functions end the process with exit() when a
+        file cannot be opened or is malformed, which would also end the
+        Python interpreter. This module checks that the files can be opened
+        before calling them, which covers the common failures, but a file
+        removed in between or a malformed Arrow or Zarr file still ends the
+        process.
+"""
+
+import ctypes
+import os
+
+import numpy as np
+
+__all__ = [
+    "load_library",
+    "csv_get_sizes", "csv_import", "csv_export",
+    "tsv_get_sizes", "tsv_import", "tsv_export",
+    "wl_get_comment", "wl_get_sizes", "wl_import", "wl_export",
+    "csv_import_arrow", "tsv_import_arrow",
+    "arrow_get_sizes", "arrow_import", "arrow_import_arrow", "arrow_export",
+    "zarr_get_sizes", "zarr_get_chunks", "zarr_import", "zarr_export",
+]
+
+_double_p = ctypes.POINTER(ctypes.c_double)
+_int_p = ctypes.POINTER(ctypes.c_int)
+_size_p = ctypes.POINTER(ctypes.c_size_t)
+
+_lib = None
+
+
+class _ArrowSchema(ctypes.Structure):
+    """struct ArrowSchema of the Arrow C Data Interface."""
+    _fields_ = [("format", ctypes.c_char_p), ("name", ctypes.c_char_p),
+                ("metadata", ctypes.c_char_p), ("flags", ctypes.c_int64),
+                ("n_children", ctypes.c_int64), ("children", ctypes.c_void_p),
+                ("dictionary", ctypes.c_void_p), ("release", ctypes.c_void_p),
+                ("private_data", ctypes.c_void_p)]
+
+
+class _ArrowArray(ctypes.Structure):
+    """struct ArrowArray of the Arrow C Data Interface."""
+    _fields_ = [("length", ctypes.c_int64), ("null_count", ctypes.c_int64),
+                ("offset", ctypes.c_int64), ("n_buffers", ctypes.c_int64),
+                ("n_children", ctypes.c_int64), ("buffers", ctypes.c_void_p),
+                ("children", ctypes.c_void_p),
+                ("dictionary", ctypes.c_void_p), ("release", ctypes.c_void_p),
+                ("private_data", ctypes.c_void_p)]
+
+
+def _default_library_path():
+    """Returns the path of the library built by the Makefile."""
+    if os.name == "nt":
+        ext = "dll"
+    elif os.uname().sysname == "Darwin":
+        ext = "dylib"
+    else:
+        ext = "so"
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    return os.path.join(root, "build", "libdata-file-library." + ext)
+
+
+def _declare(lib):
+    """Declares the argument and return types of the C functions."""
+    for fmt in ("csvdat", "tsvdat"):
+        getattr(lib, fmt + "_get_sizes").argtypes = [
+            ctypes.c_char_p, _int_p, _int_p]
+        for suffix in ("_import", "_import_cplx"):
+            getattr(lib, fmt + suffix).argtypes = [
+                ctypes.c_char_p, ctypes.c_void_p]
+        for suffix in ("_export", "_export_cplx"):
+            getattr(lib, fmt + suffix).argtypes = [
+                ctypes.c_char_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int]
+        for suffix in ("_import_strided", "_import_cplx_strided"):
+            getattr(lib, fmt + suffix).argtypes = [
+                ctypes.c_char_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int]
+        for suffix in ("_export_strided", "_export_cplx_strided"):
+            getattr(lib, fmt + suffix).argtypes = [
+                ctypes.c_char_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int,
+                ctypes.c_int, ctypes.c_int]
+        for name in ("_get_sizes", "_import", "_import_cplx", "_export",
+                     "_export_cplx", "_import_strided",
+                     "_import_cplx_strided", "_export_strided",
+                     "_export_cplx_strided"):
+            getattr(lib, fmt + name).restype = None
+        getattr(lib, fmt + "_get_sizes_status").argtypes = [
+            ctypes.c_char_p, _size_p, _size_p]
+        for suffix in ("_read_strided", "_read_cplx_strided"):
+            getattr(lib, fmt + suffix).argtypes = [
+                ctypes.c_char_p, ctypes.c_void_p, ctypes.c_size_t,
+                ctypes.c_size_t, ctypes.c_ssize_t, ctypes.c_ssize_t]
+        for name in ("_get_sizes_status", "_read_strided",
+                     "_read_cplx_strided"):
+            getattr(lib, fmt + name).restype = ctypes.c_int
+
+    lib.wldat_get_comment_size.argtypes = [ctypes.c_char_p]
+    lib.wldat_get_comment_size.restype = ctypes.c_int
+    lib.wldat_get_comment.argtypes = [ctypes.c_char_p, ctypes.c_char_p]
+    lib.wldat_get_comment.restype = None
+    lib.wldat_get_dimensions.argtypes = [ctypes.c_char_p]
+    lib.wldat_get_dimensions.restype = ctypes.c_int
+    lib.wldat_get_sizes.argtypes = [ctypes.c_char_p, _int_p]
+    lib.wldat_get_sizes.restype = None
+    for suffix in ("_import", "_import_cplx"):
+        getattr(lib, "wldat" + suffix).argtypes = [
+            ctypes.c_char_p, ctypes.c_void_p]
+        getattr(lib, "wldat" + suffix).restype = None
+    for suffix in ("_export", "_export_cplx"):
+        getattr(lib, "wldat" + suffix).argtypes = [
+            ctypes.c_char_p, ctypes.c_void_p, ctypes.c_int, _int_p,
+            ctypes.c_char_p]
+        getattr(lib, "wldat" + suffix).restype = None
+    for suffix in ("_import_strided", "_import_cplx_strided"):
+        getattr(lib, "wldat" + suffix).argtypes = [
+            ctypes.c_char_p, ctypes.c_void_p, _int_p]
+        getattr(lib, "wldat" + suffix).restype = None
+    for suffix in ("_export_strided", "_export_cplx_strided"):
+        getattr(lib, "wldat" + suffix).argtypes = [
+            ctypes.c_char_p, ctypes.c_void_p, ctypes.c_int, _int_p, _int_p,
+            ctypes.c_char_p]
+        getattr(lib, "wldat" + suffix).restype = None
+    lib.wldat_get_sizes_status.argtypes = [ctypes.c_char_p, _int_p, _size_p]
+    lib.wldat_get_sizes_status.restype = ctypes.c_int
+    for suffix in ("_read_strided", "_read_cplx_strided"):
+        getattr(lib, "wldat" + suffix).argtypes = [
+            ctypes.c_char_p, ctypes.c_void_p, ctypes.c_int,
+            ctypes.POINTER(ctypes.c_ssize_t)]
+        getattr(lib, "wldat" + suffix).restype = ctypes.c_int
+
+    for fmt in ("csvdat", "tsvdat", "arrowdat"):
+        getattr(lib, fmt + "_import_arrow").argtypes = [
+            ctypes.c_char_p, ctypes.c_void_p, ctypes.c_void_p]
+        getattr(lib, fmt + "_import_arrow").restype = ctypes.c_int
+    lib.arrowdat_get_sizes.argtypes = [ctypes.c_char_p, _int_p, _int_p]
+    lib.arrowdat_get_sizes.restype = None
+    lib.arrowdat_import.argtypes = [ctypes.c_char_p, ctypes.c_void_p]
+    lib.arrowdat_import.restype = None
+    lib.arrowdat_export.argtypes = [
+        ctypes.c_char_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int]
+    lib.arrowdat_export.restype = None
+
+    lib.zarrdat_get_dimensions.argtypes = [ctypes.c_char_p]
+    lib.zarrdat_get_dimensions.restype = ctypes.c_int
+    for suffix in ("_get_sizes", "_get_chunks"):
+        getattr(lib, "zarrdat" + suffix).argtypes = [ctypes.c_char_p, _int_p]
+        getattr(lib, "zarrdat" + suffix).restype = None
+    for suffix in ("_export", "_export_cplx"):
+        getattr(lib, "zarrdat" + suffix).argtypes = [
+            ctypes.c_char_p, ctypes.c_void_p, ctypes.c_int, _int_p, _int_p,
+            ctypes.c_int, ctypes.c_int]
+        getattr(lib, "zarrdat" + suffix).restype = ctypes.c_int
+    for suffix in ("_import_slab", "_import_slab_cplx"):
+        getattr(lib, "zarrdat" + suffix).argtypes = [
+            ctypes.c_char_p, ctypes.c_void_p, _int_p, _int_p, ctypes.c_int]
+        getattr(lib, "zarrdat" + suffix).restype = ctypes.c_int
+
+
+def load_library(path=None):
+    """
+    Loads the compiled library. The path defaults to the environment variable
+    DATA_FILE_LIBRARY_PATH or, if not set, to the library built by the
+    Makefile. It is called automatically by the first function used.
+    """
+    global _lib
+    if path is None:
+        path = os.environ.get("DATA_FILE_LIBRARY_PATH",
+                              _default_library_path())
+    lib = ctypes.CDLL(path)
+    _declare(lib)
+    _lib = lib
+    return lib
+
+
+def _library():
+    return _lib if _lib is not None else load_library()
+
+
+def _path(file_path):
+    return os.fsencode(file_path)
+
+
+def _check(status, file_path):
+    """Raises OSError for a nonzero errno returned by a C function."""
+    if status != 0:
+        raise OSError(status, os.strerror(status), file_path)
+
+
+def _readable(file_path):
+    """
+    Raises OSError if the file cannot be opened for reading, before a C
+    function that would otherwise exit the process.
+    """
+    with open(file_path, "rb"):
+        pass
+    return _path(file_path)
+
+
+def _writable(file_path):
+    """
+    Raises OSError if the file cannot be opened for writing, before a C
+    function that would otherwise exit the process. The file is truncated,
+    as the export does anyway.
+    """
+    with open(file_path, "wb"):
+        pass
+    return _path(file_path)
+
+
+def _dtype(cplx):
+    return np.complex128 if cplx else np.float64
+
+
+def _strided(data, cplx):
+    """
+    Returns data as an array of float64 or complex128 whose strides are whole
+    elements, copying it only when needed, and its strides in elements.
+    """
+    data = np.asarray(data, dtype=_dtype(cplx))
+    itemsize = data.itemsize
+    if any(s % itemsize for s in data.strides):
+        data = np.ascontiguousarray(data)
+    return data, tuple(s // itemsize for s in data.strides)
+
+
+def _sep_get_sizes(fmt, file_path):
+    rows, columns = ctypes.c_size_t(), ctypes.c_size_t()
+    _check(getattr(_library(), fmt + "_get_sizes_status")(
+        _path(file_path), ctypes.byref(rows), ctypes.byref(columns)),
+        file_path)
+    return rows.value, columns.value
+
+
+def _sep_import(fmt, file_path, cplx, order):
+    rows, columns = _sep_get_sizes(fmt, file_path)
+    data = np.empty((rows, columns), dtype=_dtype(cplx), order=order)
+    if data.size == 0:
+        return data
+    data, strides = _strided(data, cplx)
+    name = fmt + ("_read_cplx_strided" if cplx else "_read_strided")
+    _check(getattr(_library(), name)(_path(file_path), data.ctypes.data,
+                                     rows, columns, *strides), file_path)
+    return data
+
+
+def _sep_export(fmt, file_path, data):
+    cplx = np.iscomplexobj(data)
+    data, strides = _strided(data, cplx)
+    if data.ndim == 1:
+        data = data.reshape(1, -1)
+        strides = (0,) + strides
+    if data.ndim != 2:
+        raise ValueError("data must be one- or two-dimensional")
+    name = fmt + ("_export_cplx_strided" if cplx else "_export_strided")
+    getattr(_library(), name)(_writable(file_path), data.ctypes.data,
+                              data.shape[0], data.shape[1], *strides)
+
+
+def csv_get_sizes(file_path):
+    """Returns the (rows, columns) of a Comma-Separated Values file."""
+    return _sep_get_sizes("csvdat", file_path)
+
+
+def csv_import(file_path, cplx=False, order="C"):
+    """
+    Imports a Comma-Separated Values file into a new (rows, columns) array of
+    float64, or complex128 if cplx is True, in the C (row-major) or F
+    (column-major) order.
+    """
+    return _sep_import("csvdat", file_path, cplx, order)
+
+
+def csv_export(file_path, data):
+    """
+    Exports a one- or two-dimensional array to a Comma-Separated Values file.
+    Complex arrays are exported with csvdat_export_cplx().
+    """
+    _sep_export("csvdat", file_path, data)
+
+
+def tsv_get_sizes(file_path):
+    """Returns the (rows, columns) of a Tab-Separated Values file."""
+    return _sep_get_sizes("tsvdat", file_path)
+
+
+def tsv_import(file_path, cplx=False, order="C"):
+    """
+    Imports a Tab-Separated Values file into a new (rows, columns) array of
+    float64, or complex128 if cplx is True, in the C (row-major) or F
+    (column-major) order.
+    """
+    return _sep_import("tsvdat", file_path, cplx, order)
+
+
+def tsv_export(file_path, data):
+    """
+    Exports a one- or two-dimensional array to a Tab-Separated Values file.
+    Complex arrays are exported with tsvdat_export_cplx().
+    """
+    _sep_export("tsvdat", file_path, data)
+
+
+def wl_get_comment(file_path):
+    """Returns the comment (first line) of a Wolfram Language file."""
+    lib = _library()
+    size = lib.wldat_get_comment_size(_readable(file_path))
+    comment = ctypes.create_string_buffer(size)
+    lib.wldat_get_comment(_readable(file_path), comment)
+    return comment.value.decode().rstrip("\r\n")
+
+
+def wl_get_sizes(file_path):
+    """Returns the shape of the tensor of a Wolfram Language file."""
+    dimensions = ctypes.c_int()
+    size = (ctypes.c_size_t * 128)()
+    _check(_library().wldat_get_sizes_status(
+        _path(file_path), ctypes.byref(dimensions), size), file_path)
+    return tuple(size[:dimensions.value])
+
+
+def wl_import(file_path, cplx=False, order="C"):
+    """
+    Imports a Wolfram Language file into a new array of float64, or
+    complex128 if cplx is True, shaped as the nested lists of the file, in
+    the C (row-major) or F (column-major) order.
+    """
+    data = np.empty(wl_get_sizes(file_path), dtype=_dtype(cplx), order=order)
+    if data.size == 0:
+        return data
+    data, strides = _strided(data, cplx)
+    stride = (ctypes.c_ssize_t * max(data.ndim, 1))(*strides)
+    name = "wldat_read_cplx_strided" if cplx else "wldat_read_strided"
+    _check(getattr(_library(), name)(_path(file_path), data.ctypes.data,
+                                     data.ndim, stride), file_path)
+    return data
+
+
+def wl_export(file_path, data, comment=""):
+    """
+    Exports an array of arbitrary dimension to a Wolfram Language file.
+    Complex arrays are exported with wldat_export_cplx().
+    """
+    cplx = np.iscomplexobj(data)
+    data, strides = _strided(data, cplx)
+    size = (ctypes.c_int * max(data.ndim, 1))(*data.shape)
+    stride = (ctypes.c_int * max(data.ndim, 1))(*strides)
+    name = "wldat_export_cplx_strided" if cplx else "wldat_export_strided"
+    getattr(_library(), name)(_writable(file_path), data.ctypes.data,
+                              data.ndim, size, stride, comment.encode())
+
+
+def _import_arrow(fmt, file_path):
+    """
+    Returns a pyarrow.RecordBatch that takes the buffers filled by the
+    *_import_arrow() function of a format, without a copy.
+    """
+    import pyarrow as pa
+    schema, array = _ArrowSchema(), _ArrowArray()
+    status = getattr(_library(), fmt + "_import_arrow")(
+        _path(file_path), ctypes.addressof(schema), ctypes.addressof(array))
+    if status != 0:
+        raise OSError(status, os.strerror(status), file_path)
+    return pa.RecordBatch._import_from_c(ctypes.addressof(array),
+                                         ctypes.addressof(schema))
+
+
+def csv_import_arrow(file_path):
+    """
+    Imports a Comma-Separated Values file into a pyarrow.RecordBatch of one
+    float64 column per column, named column_1, column_2, ...
+    """
+    return _import_arrow("csvdat", file_path)
+
+
+def tsv_import_arrow(file_path):
+    """
+    Imports a Tab-Separated Values file into a pyarrow.RecordBatch of one
+    float64 column per column, named column_1, column_2, ...
+    """
+    return _import_arrow("tsvdat", file_path)
+
+
+def arrow_get_sizes(file_path):
+    """Returns the (rows, columns) of an Arrow IPC (Feather V2) file."""
+    rows, columns = ctypes.c_int(), ctypes.c_int()
+    _library().arrowdat_get_sizes(
+        _readable(file_path), ctypes.byref(rows), ctypes.byref(columns))
+    return rows.value, columns.value
+
+
+def arrow_import(file_path):
+    """
+    Imports the numeric columns of an uncompressed Arrow IPC (Feather V2)
+    file into a new (rows, columns) array of float64, with nulls as NaN.
+    """
+    data = np.empty(arrow_get_sizes(file_path), dtype=np.float64)
+    if data.size > 0:
+        _library().arrowdat_import(_readable(file_path), data.ctypes.data)
+    return data
+
+
+def arrow_import_arrow(file_path):
+    """
+    Imports an uncompressed Arrow IPC (Feather V2) file into a
+    pyarrow.RecordBatch, whose buffers are those of the memory mapping of
+    the file when it has one record batch.
+    """
+    return _import_arrow("arrowdat", file_path)
+
+
+def arrow_export(file_path, data):
+    """
+    Exports a one- or two-dimensional array to an Arrow IPC (Feather V2) file
+    of one float64 column per column, named column_1, column_2, ...
+    """
+    data = np.ascontiguousarray(data, dtype=np.float64)
+    if data.ndim == 1:
+        data = data.reshape(1, -1)
+    if data.ndim != 2:
+        raise ValueError("data must be one- or two-dimensional")
+    _library().arrowdat_export(_writable(file_path), data.ctypes.data,
+                               data.shape[0], data.shape[1])
+
+
+def _zarr_sizes(name, dir_path):
+    lib = _library()
+    _readable(os.path.join(dir_path, ".zarray"))
+    dimensions = lib.zarrdat_get_dimensions(_path(dir_path))
+    size = (ctypes.c_int * dimensions)()
+    getattr(lib, name)(_path(dir_path), size)
+    return tuple(size)
+
+
+def zarr_get_sizes(dir_path):
+    """Returns the shape of the array of a Zarr store."""
+    return _zarr_sizes("zarrdat_get_sizes", dir_path)
+
+
+def zarr_get_chunks(dir_path):
+    """Returns the shape of the chunks of a Zarr store."""
+    return _zarr_sizes("zarrdat_get_chunks", dir_path)
+
+
+def zarr_import(dir_path, cplx=False, start=None, count=None, threads=0):
+    """
+    Imports a Zarr store of float64 values, or complex128 if cplx is True,
+    into a new array. When start and count are given, only the slab of the
+    indices start[d] to start[d] + count[d] - 1 of each dimension is
+    imported, from the chunks that overlap it.
+    """
+    shape = zarr_get_sizes(dir_path)
+    start = tuple(start) if start is not None else (0,) * len(shape)
+    count = tuple(count) if count is not None else tuple(
+        n - s for n, s in zip(shape, start))
+    data = np.empty(count, dtype=_dtype(cplx))
+    name = "zarrdat_import_slab_cplx" if cplx else "zarrdat_import_slab"
+    status = getattr(_library(), name)(
+        _path(dir_path), data.ctypes.data, (ctypes.c_int * len(start))(*start),
+        (ctypes.c_int * len(count))(*count), threads)
+    if status != 0:
+        raise OSError(status, os.strerror(status), dir_path)
+    return data
+
+
+def zarr_export(dir_path, data, chunks, level=0, threads=0):
+    """
+    Exports an array of arbitrary dimension to a Zarr store of chunks of the
+    shape chunks, compressed by zlib when level is above 0.
+    """
+    cplx = np.iscomplexobj(data)
+    data = np.ascontiguousarray(data, dtype=_dtype(cplx))
+    if len(chunks) != data.ndim:
+        raise ValueError("chunks must have one size per dimension")
+    size = (ctypes.c_int * data.ndim)(*data.shape)
+    chunk = (ctypes.c_int * data.ndim)(*chunks)
+    name = "zarrdat_export_cplx" if cplx else "zarrdat_export"
+    status = getattr(_library(), name)(_path(dir_path), data.ctypes.data,
+                                       data.ndim, size, chunk, level, threads)
+    if status != 0:
+        raise OSError(status, os.strerror(status), dir_path)
@@ -1,18 +1,193 @@
+typedef struct dfl_allocator { void *(*allocate)(void *context, size_t size); void (*deallocate)(void *context, void *ptr); void *context; } dfl_allocator;
+typedef struct dfl_arena { void *first; void *current; size_t block_size; } dfl_arena;
+typedef struct dfl_batch_item { int status; int dimensions; int *size; double *data; double complex *data_cplx; } dfl_batch_item;
+typedef struct dfl_follow { double *data; double complex *data_cplx; int rows; int columns; int restarted; int capacity; long long offset; long long size; unsigned long long device; unsigned long long inode; } dfl_follow;
+typedef struct dfl_probe { long long rows; int columns; int min_columns; long long ragged_rows; int is_complex; int formats; int sampled; long long bytes; } dfl_probe;
+typedef struct dfl_cell_error { long long row; long long column; long long offset; } dfl_cell_error;
+typedef struct dfl_parse_report { int mode; dfl_cell_error *errors; int max_errors; int count; } dfl_parse_report;
+typedef struct dfl_dialect { const char *separators; char comment; int header_rows; int collapse_separators; int cr_line_breaks; } dfl_dialect;
+typedef struct dfl_wl_format { int precision; int no_spaces; int integers; } dfl_wl_format;
+typedef struct dfl_sparse { int dimensions; int *size; long long count; int *indices; double *values; double complex *values_cplx; double background; } dfl_sparse;
+typedef struct dfl_stats { long long count; long long skipped; double min; double max; double sum; double mean; double variance; double norm; double compensation; double m2; double scale; double ssq; } dfl_stats;
+typedef struct dfl_convert_options { int input_format; int output_format; size_t columns; const dfl_wl_format *wl_format; const char *comment; int batches; size_t batch_values; } dfl_convert_options;
+struct ArrowSchema { const char *format; const char *name; const char *metadata; int64_t flags; int64_t n_children; struct ArrowSchema **children; struct ArrowSchema *dictionary; void (*release)(struct ArrowSchema *); void *private_data; };
+struct ArrowArray { int64_t length; int64_t null_count; int64_t offset; int64_t n_buffers; int64_t n_children; const void **buffers; struct ArrowArray **children; struct ArrowArray *dictionary; void (*release)(struct ArrowArray *); void *private_data; };
+typedef struct dfl_cache dfl_cache;
+typedef struct dfl_cache_view { int status; int dimensions; const int *size; const double *data; const double complex *data_cplx; void *entry; } dfl_cache_view;
+typedef struct dfl_executor dfl_executor;
+typedef struct dfl_task dfl_task;
+typedef void (*dfl_task_callback)(dfl_task *task, int state, void *user_data);
+void dfl_arena_init(dfl_arena *arena, size_t block_size);
+dfl_allocator dfl_arena_allocator(dfl_arena *arena);
+void dfl_arena_reset(dfl_arena *arena);
+void dfl_arena_destroy(dfl_arena *arena);
+void dfl_free(const dfl_allocator *allocator, void *ptr);
+void dfl_batch_free(dfl_batch_item *items, int count, const dfl_allocator *allocator);
+int dfl_sparse_to_csr(const dfl_sparse *sparse, long long *row_offsets, int *column_indices, double *values);
+int dfl_sparse_to_csr_cplx(const dfl_sparse *sparse, long long *row_offsets, int *column_indices, double complex *values);
+void dfl_sparse_free(dfl_sparse *sparse, const dfl_allocator *allocator);
+dfl_executor *dfl_executor_create(int threads);
+void dfl_executor_destroy(dfl_executor *executor);
+int dfl_task_state(dfl_task *task);
+int dfl_task_status(dfl_task *task);
+int dfl_task_wait(dfl_task *task);
+int dfl_task_cancel(dfl_task *task);
+void dfl_task_release(dfl_task *task);
+void dfl_follow_init(dfl_follow *follow);
+void dfl_follow_destroy(dfl_follow *follow);
+dfl_cache *dfl_cache_create(size_t max_bytes);
+void dfl_cache_destroy(dfl_cache *cache);
+void dfl_cache_clear(dfl_cache *cache);
+void dfl_cache_release(dfl_cache *cache, dfl_cache_view *view);
+int dfl_convert(const char *input_path, const char *output_path, const dfl_convert_options *options);
+void arrowdat_get_sizes(const char *file_path, int *rows, int *columns);
+void arrowdat_import(const char *file_path, double *data);
+int arrowdat_import_arrow(const char *file_path, struct ArrowSchema *schema, struct ArrowArray *array);
+void arrowdat_export(const char *file_path, const double *data, int rows, int columns);
 void csvdat_get_sizes(const char *file_path, int *rows, int *columns);
+void csvdat_get_sizes64(const char *file_path, size_t *rows, size_t *columns);
+int csvdat_get_sizes_status(const char *file_path, size_t *rows, size_t *columns);
+void csvdat_probe(const char *file_path, dfl_probe *probe, long long sample_bytes);
 void csvdat_import(const char *file_path, double * data);
 void csvdat_import_cplx(const char *file_path, double complex *data);
+int csvdat_import_checked(const char *file_path, double *data, dfl_parse_report *report);
+int csvdat_import_cplx_checked(const char *file_path, double complex *data, dfl_parse_report *report);
+int csvdat_stats(const char *file_path, dfl_stats *stats, int max_columns);
+int csvdat_stats_cplx(const char *file_path, dfl_stats *stats, int max_columns);
+int csvdat_import_arrow(const char *file_path, struct ArrowSchema *schema, struct ArrowArray *array);
+int csvdat_import_cached(dfl_cache *cache, const char *file_path, dfl_cache_view *view);
+int csvdat_import_cplx_cached(dfl_cache *cache, const char *file_path, dfl_cache_view *view);
+double *csvdat_import_alloc(const char *file_path, int *rows, int *columns, const dfl_allocator *allocator);
+double complex *csvdat_import_cplx_alloc(const char *file_path, int *rows, int *columns, const dfl_allocator *allocator);
+void csvdat_import_batch(const char *const *file_paths, int count, dfl_batch_item *items, int threads, const dfl_allocator *allocator);
+void csvdat_import_cplx_batch(const char *const *file_paths, int count, dfl_batch_item *items, int threads, const dfl_allocator *allocator);
+int csvdat_follow(const char *file_path, dfl_follow *follow);
+int csvdat_follow_cplx(const char *file_path, dfl_follow *follow);
+void csvdat_import_strided(const char *file_path, double *data, int row_stride, int column_stride);
+void csvdat_import_cplx_strided(const char *file_path, double complex *data, int row_stride, int column_stride);
+int csvdat_read_strided(const char *file_path, double *data, size_t rows, size_t columns, ptrdiff_t row_stride, ptrdiff_t column_stride);
+int csvdat_read_cplx_strided(const char *file_path, double complex *data, size_t rows, size_t columns, ptrdiff_t row_stride, ptrdiff_t column_stride);
+void csvdat_import_cplx_split(const char *file_path, double *re, double *im);
 void csvdat_export(const char *file_path, const double *data, int rows, int columns);
 void csvdat_export_cplx(const char *file_path, const double complex *data, int rows, int columns);
+void csvdat_export64(const char *file_path, const double *data, size_t rows, size_t columns);
+void csvdat_export_cplx64(const char *file_path, const double complex *data, size_t rows, size_t columns);
+void csvdat_export_strided(const char *file_path, const double *data, int rows, int columns, int row_stride, int column_stride);
+void csvdat_export_cplx_strided(const char *file_path, const double complex *data, int rows, int columns, int row_stride, int column_stride);
+void csvdat_export_cplx_split(const char *file_path, const double *re, const double *im, int rows, int columns);
+int csvdat_export_direct(const char *file_path, const double *data, size_t rows, size_t columns);
+int csvdat_export_cplx_direct(const char *file_path, const double complex *data, size_t rows, size_t columns);
+dfl_task *csvdat_import_async(dfl_executor *executor, const char *file_path, double *data, dfl_task_callback callback, void *user_data);
+dfl_task *csvdat_import_cplx_async(dfl_executor *executor, const char *file_path, double complex *data, dfl_task_callback callback, void *user_data);
+dfl_task *csvdat_export_async(dfl_executor *executor, const char *file_path, const double *data, int rows, int columns, dfl_task_callback callback, void *user_data);
+dfl_task *csvdat_export_cplx_async(dfl_executor *executor, const char *file_path, const double complex *data, int rows, int columns, dfl_task_callback callback, void *user_data);
+void dsvdat_get_sizes(const char *file_path, int *rows, int *columns, const dfl_dialect *dialect);
+void dsvdat_get_sizes64(const char *file_path, size_t *rows, size_t *columns, const dfl_dialect *dialect);
+void dsvdat_import(const char *file_path, double *data, const dfl_dialect *dialect);
+void dsvdat_import_cplx(const char *file_path, double complex *data, const dfl_dialect *dialect);
+int dsvdat_import_checked(const char *file_path, double *data, const dfl_dialect *dialect, dfl_parse_report *report);
+int dsvdat_import_cplx_checked(const char *file_path, double complex *data, const dfl_dialect *dialect, dfl_parse_report *report);
+void dsvdat_export(const char *file_path, const double *data, int rows, int columns, const dfl_dialect *dialect);
+void dsvdat_export_cplx(const char *file_path, const double complex *data, int rows, int columns, const dfl_dialect *dialect);
+void fwfdat_get_sizes(const char *file_path, int *rows, int *columns, const int *widths, int count);
+void fwfdat_import(const char *file_path, double *data, const int *widths, int count, int threads);
+void fwfdat_import_cplx(const char *file_path, double complex *data, const int *widths, int count, int threads);
+void fwfdat_export(const char *file_path, const double *data, int rows, const int *widths, int count);
+void fwfdat_export_cplx(const char *file_path, const double complex *data, int rows, const int *widths, int count);
+void mtxdat_get_sizes(const char *file_path, int *rows, int *columns);
+void mtxdat_import(const char *file_path, double *data);
+void mtxdat_import_cplx(const char *file_path, double complex *data);
+int mtxdat_import_sparse(const char *file_path, dfl_sparse *sparse, const dfl_allocator *allocator);
+int mtxdat_import_cplx_sparse(const char *file_path, dfl_sparse *sparse, const dfl_allocator *allocator);
+void mtxdat_export(const char *file_path, const double *data, int rows, int columns);
+void mtxdat_export_cplx(const char *file_path, const double complex *data, int rows, int columns);
+void mtxdat_export_sparse(const char *file_path, const dfl_sparse *sparse);
+void mtxdat_export_cplx_sparse(const char *file_path, const dfl_sparse *sparse);
 void tsvdat_get_sizes(const char *file_path, int *rows, int *columns);
+void tsvdat_get_sizes64(const char *file_path, size_t *rows, size_t *columns);
+int tsvdat_get_sizes_status(const char *file_path, size_t *rows, size_t *columns);
+void tsvdat_probe(const char *file_path, dfl_probe *probe, long long sample_bytes);
 void tsvdat_import(const char *file_path, double * data);
 void tsvdat_import_cplx(const char *file_path, double complex *data);
+int tsvdat_import_checked(const char *file_path, double *data, dfl_parse_report *report);
+int tsvdat_import_cplx_checked(const char *file_path, double complex *data, dfl_parse_report *report);
+int tsvdat_stats(const char *file_path, dfl_stats *stats, int max_columns);
+int tsvdat_stats_cplx(const char *file_path, dfl_stats *stats, int max_columns);
+int tsvdat_import_arrow(const char *file_path, struct ArrowSchema *schema, struct ArrowArray *array);
+int tsvdat_import_cached(dfl_cache *cache, const char *file_path, dfl_cache_view *view);
+int tsvdat_import_cplx_cached(dfl_cache *cache, const char *file_path, dfl_cache_view *view);
+double *tsvdat_import_alloc(const char *file_path, int *rows, int *columns, const dfl_allocator *allocator);
+double complex *tsvdat_import_cplx_alloc(const char *file_path, int *rows, int *columns, const dfl_allocator *allocator);
+void tsvdat_import_batch(const char *const *file_paths, int count, dfl_batch_item *items, int threads, const dfl_allocator *allocator);
+void tsvdat_import_cplx_batch(const char *const *file_paths, int count, dfl_batch_item *items, int threads, const dfl_allocator *allocator);
+int tsvdat_follow(const char *file_path, dfl_follow *follow);
+int tsvdat_follow_cplx(const char *file_path, dfl_follow *follow);
+void tsvdat_import_strided(const char *file_path, double *data, int row_stride, int column_stride);
+void tsvdat_import_cplx_strided(const char *file_path, double complex *data, int row_stride, int column_stride);
+int tsvdat_read_strided(const char *file_path, double *data, size_t rows, size_t columns, ptrdiff_t row_stride, ptrdiff_t column_stride);
+int tsvdat_read_cplx_strided(const char *file_path, double complex *data, size_t rows, size_t columns, ptrdiff_t row_stride, ptrdiff_t column_stride);
+void tsvdat_import_cplx_split(const char *file_path, double *re, double *im);
 void tsvdat_export(const char *file_path, const double *data, int rows, int columns);
 void tsvdat_export_cplx(const char *file_path, const double complex *data, int rows, int columns);
+void tsvdat_export64(const char *file_path, const double *data, size_t rows, size_t columns);
+void tsvdat_export_cplx64(const char *file_path, const double complex *data, size_t rows, size_t columns);
+void tsvdat_export_strided(const char *file_path, const double *data, int rows, int columns, int row_stride, int column_stride);
+void tsvdat_export_cplx_strided(const char *file_path, const double complex *data, int rows, int columns, int row_stride, int column_stride);
+void tsvdat_export_cplx_split(const char *file_path, const double *re, const double *im, int rows, int columns);
+int tsvdat_export_direct(const char *file_path, const double *data, size_t rows, size_t columns);
+int tsvdat_export_cplx_direct(const char *file_path, const double complex *data, size_t rows, size_t columns);
+dfl_task *tsvdat_import_async(dfl_executor *executor, const char *file_path, double *data, dfl_task_callback callback, void *user_data);
+dfl_task *tsvdat_import_cplx_async(dfl_executor *executor, const char *file_path, double complex *data, dfl_task_callback callback, void *user_data);
+dfl_task *tsvdat_export_async(dfl_executor *executor, const char *file_path, const double *data, int rows, int columns, dfl_task_callback callback, void *user_data);
+dfl_task *tsvdat_export_cplx_async(dfl_executor *executor, const char *file_path, const double complex *data, int rows, int columns, dfl_task_callback callback, void *user_data);
 int wldat_get_comment_size(const char *file_path);
 void wldat_get_comment(const char *file_path, char *comment);
 int wldat_get_dimensions(const char *file_path);
 void wldat_get_sizes(const char *file_path, int *sizes);
+void wldat_get_sizes64(const char *file_path, size_t *size);
+int wldat_get_sizes_status(const char *file_path, int *dimensions, size_t *size);
 void wldat_import(const char *file_path, double *data);
 void wldat_import_cplx(const char *file_path, double complex *data);
+double *wldat_import_alloc(const char *file_path, int *dimensions, int **size, const dfl_allocator *allocator);
+double complex *wldat_import_cplx_alloc(const char *file_path, int *dimensions, int **size, const dfl_allocator *allocator);
+void wldat_import_batch(const char *const *file_paths, int count, dfl_batch_item *items, int threads, const dfl_allocator *allocator);
+void wldat_import_cplx_batch(const char *const *file_paths, int count, dfl_batch_item *items, int threads, const dfl_allocator *allocator);
+void wldat_import_strided(const char *file_path, double *data, const int *stride);
+void wldat_import_cplx_strided(const char *file_path, double complex *data, const int *stride);
+int wldat_read_strided(const char *file_path, double *data, int dimensions, const ptrdiff_t *stride);
+int wldat_read_cplx_strided(const char *file_path, double complex *data, int dimensions, const ptrdiff_t *stride);
+void wldat_import_cplx_split(const char *file_path, double *re, double *im);
+void wldat_import_parallel(const char *file_path, double *data, int threads);
+void wldat_import_cplx_parallel(const char *file_path, double complex *data, int threads);
+int wldat_stats(const char *file_path, dfl_stats *stats, int max_count, int axis);
+int wldat_stats_cplx(const char *file_path, dfl_stats *stats, int max_count, int axis);
+int wldat_import_cached(dfl_cache *cache, const char *file_path, dfl_cache_view *view);
+int wldat_import_cplx_cached(dfl_cache *cache, const char *file_path, dfl_cache_view *view);
+int wldat_import_sparse(const char *file_path, dfl_sparse *sparse, const dfl_allocator *allocator);
+int wldat_import_cplx_sparse(const char *file_path, dfl_sparse *sparse, const dfl_allocator *allocator);
+void wldat_export_sparse(const char *file_path, const dfl_sparse *sparse, const char *comment);
+void wldat_export_cplx_sparse(const char *file_path, const dfl_sparse *sparse, const char *comment);
 void wldat_export(const char *file_path, double *data, int dimensions, int *sizes, char *comment);
-void wldat_export_cplx(const char *file_path, double complex *data, int dimensions, int *sizes, char *comment);
\ No newline at end of file
+void wldat_export_cplx(const char *file_path, double complex *data, int dimensions, int *sizes, char *comment);
+void wldat_export_strided(const char *file_path, const double *data, int dimensions, const int *size, const int *stride, const char *comment);
+void wldat_export_cplx_strided(const char *file_path, const double complex *data, int dimensions, const int *size, const int *stride, const char *comment);
+void wldat_export_cplx_split(const char *file_path, const double *re, const double *im, int dimensions, const int *size, const char *comment);
+void wldat_export_formatted(const char *file_path, const double *data, int dimensions, const int *size, const char *comment, const dfl_wl_format *format);
+void wldat_export_cplx_formatted(const char *file_path, const double complex *data, int dimensions, const int *size, const char *comment, const dfl_wl_format *format);
+void wldat_export64(const char *file_path, const double *data, int dimensions, const size_t *size, const char *comment);
+void wldat_export_cplx64(const char *file_path, const double complex *data, int dimensions, const size_t *size, const char *comment);
+int wldat_export_direct(const char *file_path, const double *data, int dimensions, const int *size, const char *comment);
+int wldat_export_cplx_direct(const char *file_path, const double complex *data, int dimensions, const int *size, const char *comment);
+dfl_task *wldat_import_async(dfl_executor *executor, const char *file_path, double *data, dfl_task_callback callback, void *user_data);
+dfl_task *wldat_import_cplx_async(dfl_executor *executor, const char *file_path, double complex *data, dfl_task_callback callback, void *user_data);
+dfl_task *wldat_export_async(dfl_executor *executor, const char *file_path, const double *data, int dimensions, const int *size, const char *comment, dfl_task_callback callback, void *user_data);
+dfl_task *wldat_export_cplx_async(dfl_executor *executor, const char *file_path, const double complex *data, int dimensions, const int *size, const char *comment, dfl_task_callback callback, void *user_data);
+int zarrdat_get_dimensions(const char *dir_path);
+void zarrdat_get_sizes(const char *dir_path, int *size);
+void zarrdat_get_chunks(const char *dir_path, int *chunk);
+int zarrdat_export(const char *dir_path, const double *data, int dimensions, const int *size, const int *chunk, int level, int threads);
+int zarrdat_export_cplx(const char *dir_path, const double complex *data, int dimensions, const int *size, const int *chunk, int level, int threads);
+int zarrdat_import(const char *dir_path, double *data, int threads);
+int zarrdat_import_cplx(const char *dir_path, double complex *data, int threads);
+int zarrdat_import_slab(const char *dir_path, double *data, const int *start, const int *count, int threads);
+int zarrdat_import_slab_cplx(const char *dir_path, double complex *data, const int *start, const int *count, int threads);
\ No newline at end of file
@@ -11,6 +11,11 @@
         Wrapper for compiling the include/data-file-library.h library.
 */
 
+/* Linux extensions, e.g., O_DIRECT for the direct exports */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
 /* Overwrite 'static inline' */
 #if defined(_WIN32) || defined(_WIN64)
     #ifdef __cplusplus
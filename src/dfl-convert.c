@@ -0,0 +1,139 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: src/dfl-convert.c
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads or Win32 threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Command-line tool for converting files between the CSV, TSV, WL and
+        binary formats by streaming their values with bounded memory, built
+        on dfl_convert(). Usage:
+            dfl-convert [options] input output
+        where input and output may be "-" for the standard input and output.
+*/
+
+#include <stdio.h>
+#include <stdlib.h> /* For strtol() and strtoull() */
+#include <string.h> /* For strcmp() and strerror() */
+#include "../include/data-file-library.h"
+
+/*
+    Prints the usage of the tool.
+
+    Parameter:
+    - file, where to print.
+*/
+static void print_usage(FILE *file) {
+    fprintf(file,
+        "Usage: dfl-convert [options] input output\n"
+        "Converts between the csv, tsv, wl and bin (raw double-type values)"
+        " formats.\n"
+        "Options:\n"
+        "  -f FORMAT     format of the input (default: from the extension)\n"
+        "  -t FORMAT     format of the output (default: from the extension)\n"
+        "  -c COLUMNS    number of columns of a bin input\n"
+        "  -p PRECISION  significant digits of a wl output, or 0 for the\n"
+        "                fewest digits that read back the same values\n"
+        "  -z            wl output without spaces and with integer values\n"
+        "                as integers\n"
+        "  -m COMMENT    first line of a wl output\n"
+        "  -b BATCHES    number of batches of the ring (default: 4)\n"
+        "  -s VALUES     number of values of each batch (default: 65536)\n"
+        "  -h            print this help\n"
+        "Use - as input or output for the standard input or output.\n");
+}
+
+/*
+    Returns the DFL_FILE_* format of a name, or -1 if it is unknown.
+
+    Parameter:
+    - name, the name, i.e., csv, tsv, wl or bin.
+*/
+static int format_from_name(const char *name) {
+    if (strcmp(name, "csv") == 0) return DFL_FILE_CSV;
+    if (strcmp(name, "tsv") == 0) return DFL_FILE_TSV;
+    if (strcmp(name, "wl") == 0) return DFL_FILE_WL;
+    if (strcmp(name, "bin") == 0) return DFL_FILE_BINARY;
+    return -1;
+}
+
+int main(int argc, char **argv) {
+
+    dfl_convert_options options;
+    memset(&options, 0, sizeof(options));
+    dfl_wl_format wl_format;
+    memset(&wl_format, 0, sizeof(wl_format));
+    int formatted = 0;
+    const char *paths[2];
+    int count = 0;
+
+    /* Read the arguments */
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (arg[0] != '-' || arg[1] == '\0') {
+            if (count == 2) {
+                print_usage(stderr);
+                return EXIT_FAILURE;
+            }
+            paths[count++] = arg;
+        } else if (strcmp(arg, "-h") == 0) {
+            print_usage(stdout);
+            return EXIT_SUCCESS;
+        } else if (strcmp(arg, "-z") == 0) {
+            wl_format.no_spaces = 1;
+            wl_format.integers = 1;
+            formatted = 1;
+        } else if (i + 1 < argc && strlen(arg) == 2) {
+            const char *value = argv[++i];
+            switch (arg[1]) {
+            case 'f':
+                options.input_format = format_from_name(value);
+                break;
+            case 't':
+                options.output_format = format_from_name(value);
+                break;
+            case 'c':
+                options.columns = (size_t)strtoull(value, NULL, 10);
+                break;
+            case 'p':
+                wl_format.precision = (int)strtol(value, NULL, 10);
+                formatted = 1;
+                break;
+            case 'm':
+                options.comment = value;
+                break;
+            case 'b':
+                options.batches = (int)strtol(value, NULL, 10);
+                break;
+            case 's':
+                options.batch_values = (size_t)strtoull(value, NULL, 10);
+                break;
+            default:
+                print_usage(stderr);
+                return EXIT_FAILURE;
+            }
+        } else {
+            print_usage(stderr);
+            return EXIT_FAILURE;
+        }
+    }
+    if (count != 2) {
+        print_usage(stderr);
+        return EXIT_FAILURE;
+    }
+    if (formatted) options.wl_format = &wl_format;
+
+    /* Convert */
+    int status = dfl_convert(paths[0], paths[1], &options);
+    if (status != 0) {
+        fprintf(stderr, "dfl-convert: %s -> %s: %s\n", paths[0], paths[1],
+            status == EINVAL ? "unknown format, bin input without -c, or"
+            " a value that is not a real number" :
+            strerror(status));
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,244 @@
+/*
+    Data File Library: A set of C functions for handling numeric data files
+
+    File: tests/cache_test.c
+    Version: include/data-file-library/version.h
+    Author: Jhonas Olivati de Sarro
+    Language standards: C99 with POSIX threads
+    License: include/data-file-library/license.txt
+
+    Description:
+        Test of the cache of imported files with two threads, i.e., that
+        concurrent imports of a file share one parse (single-flight), that a
+        file changed during its parse is evicted once ready, and that the
+        least recently used files are evicted while their views stay valid.
+        Run with "make test", e.g., with CFLAGS="-g -fsanitize=thread" to
+        also check the locking.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h> /* For memset() */
+#include <pthread.h>
+#include <sched.h> /* For sched_yield() */
+#include <sys/time.h> /* For utimes() */
+#include "../include/data-file-library.h"
+
+#define BIG_PATH "build/cache-test-big.csv"
+#define SMALL_PATH "build/cache-test-small.csv"
+#define BIG_ROWS 200000
+
+static int failures = 0;
+
+/*
+    Reports a failed check.
+
+    Parameters:
+    - condition, the check.
+    - message, what failed.
+*/
+static void check(int condition, const char *message) {
+    if (!condition) {
+        fprintf(stderr, "FAILED: %s\n", message);
+        failures++;
+    }
+}
+
+/*
+    Writes a CSV file of rows with two columns.
+
+    Parameters:
+    - path, path to the file.
+    - rows, number of rows.
+    - offset, added to the values.
+*/
+static void write_file(const char *path, int rows, int offset) {
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < rows; i++) {
+        fprintf(file, "%d,%d\n", i + offset, 2 * i + offset);
+    }
+    fclose(file);
+}
+
+/*
+    Sets the modification time of a file to a given number of seconds,
+    so that the cache sees it as changed.
+
+    Parameters:
+    - path, path to the file.
+    - seconds, the time.
+*/
+static void set_mtime(const char *path, long seconds) {
+    struct timeval times[2];
+    times[0].tv_sec = seconds;
+    times[0].tv_usec = 0;
+    times[1].tv_sec = seconds;
+    times[1].tv_usec = 0;
+    if (utimes(path, times) != 0) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*
+    Returns the number of files in the list of a cache.
+
+    Parameter:
+    - cache, the cache.
+*/
+static int count_entries(dfl_cache *cache) {
+    int count = 0;
+    mutex_lock_impl_(&cache->mutex);
+    for (cache_entry_impl_ *entry = cache->head; entry != NULL;
+        entry = entry->next) {
+        count++;
+    }
+    mutex_unlock_impl_(&cache->mutex);
+    return count;
+}
+
+typedef struct import_args {
+    dfl_cache *cache;
+    const char *path;
+    dfl_cache_view view;
+} import_args;
+
+/*
+    Initializes the arguments of an import in a thread.
+
+    Parameters:
+    - args, the arguments.
+    - cache, the cache.
+    - path, path to the file.
+*/
+static void import_args_init(import_args *args, dfl_cache *cache,
+    const char *path) {
+
+    memset(args, 0, sizeof(import_args));
+    args->cache = cache;
+    args->path = path;
+}
+
+/*
+    Imports a file through a cache, in a thread.
+
+    Parameter:
+    - arg, pointer to an import_args.
+*/
+static void *import_thread(void *arg) {
+    import_args *args = (import_args *)arg;
+    csvdat_import_cached(args->cache, args->path, &args->view);
+    return NULL;
+}
+
+/*
+    Two threads importing the same file share the values of one parse.
+*/
+static void test_single_flight(void) {
+    write_file(BIG_PATH, BIG_ROWS, 0);
+    set_mtime(BIG_PATH, 1000000000L);
+    dfl_cache *cache = dfl_cache_create((size_t)64 << 20);
+    import_args first;
+    import_args second;
+    import_args_init(&first, cache, BIG_PATH);
+    import_args_init(&second, cache, BIG_PATH);
+    pthread_t threads[2];
+    pthread_create(&threads[0], NULL, import_thread, &first);
+    pthread_create(&threads[1], NULL, import_thread, &second);
+    pthread_join(threads[0], NULL);
+    pthread_join(threads[1], NULL);
+
+    check(first.view.status == 0 && second.view.status == 0,
+        "single-flight imports succeed");
+    check(first.view.data == second.view.data,
+        "single-flight imports share their values");
+    check(first.view.size[0] == BIG_ROWS && first.view.size[1] == 2,
+        "single-flight imports have the sizes of the file");
+    check(count_entries(cache) == 1, "single-flight keeps one file");
+
+    dfl_cache_release(cache, &first.view);
+    dfl_cache_release(cache, &second.view);
+    dfl_cache_clear(cache);
+    check(cache->bytes == 0, "clear leaves no bytes");
+    dfl_cache_destroy(cache);
+}
+
+/*
+    A file changed while another thread parses it is imported again, and the
+    entry being parsed is evicted by its loader once ready.
+*/
+static void test_stale_while_loading(void) {
+    write_file(BIG_PATH, BIG_ROWS, 0);
+    set_mtime(BIG_PATH, 1000000000L);
+    dfl_cache *cache = dfl_cache_create((size_t)64 << 20);
+    import_args loading;
+    import_args_init(&loading, cache, BIG_PATH);
+    pthread_t thread;
+    pthread_create(&thread, NULL, import_thread, &loading);
+
+    /* Wait for the loader to publish its entry, then change the file */
+    while (count_entries(cache) == 0) {
+        sched_yield();
+    }
+    set_mtime(BIG_PATH, 1000000001L);
+    dfl_cache_view view;
+    csvdat_import_cached(cache, BIG_PATH, &view);
+    pthread_join(thread, NULL);
+
+    check(loading.view.status == 0 && view.status == 0,
+        "stale imports succeed");
+    check(loading.view.data != view.data,
+        "a changed file is imported again");
+    check(count_entries(cache) == 1, "the stale file is evicted");
+    check(cache->bytes == view.size[0] * view.size[1] * sizeof(double),
+        "the bytes count only the file kept");
+
+    dfl_cache_release(cache, &loading.view);
+    dfl_cache_release(cache, &view);
+    dfl_cache_clear(cache);
+    check(cache->bytes == 0, "clear leaves no bytes");
+    dfl_cache_destroy(cache);
+}
+
+/*
+    Importing files beyond the bytes of a cache evicts the least recently
+    used ones, whose views stay valid until released.
+*/
+static void test_eviction(void) {
+    write_file(SMALL_PATH, 1000, 0);
+    write_file(BIG_PATH, 1000, 7);
+    size_t bytes = (size_t)1000 * 2 * sizeof(double);
+    dfl_cache *cache = dfl_cache_create(bytes + bytes / 2);
+    dfl_cache_view small;
+    dfl_cache_view big;
+    csvdat_import_cached(cache, SMALL_PATH, &small);
+    csvdat_import_cached(cache, BIG_PATH, &big);
+
+    check(small.status == 0 && big.status == 0, "evicting imports succeed");
+    check(cache->bytes <= cache->max_bytes, "the bytes stay in the limit");
+    check(count_entries(cache) == 1, "the least recent file is evicted");
+    check(small.data[0] == 0.0 && small.data[2 * 999 + 1] == 2.0 * 999,
+        "the view of an evicted file stays valid");
+
+    dfl_cache_release(cache, &small);
+    dfl_cache_release(cache, &big);
+    dfl_cache_destroy(cache);
+}
+
+int main(void) {
+    test_single_flight();
+    test_stale_while_loading();
+    test_eviction();
+    remove(BIG_PATH);
+    remove(SMALL_PATH);
+    if (failures != 0) {
+        fprintf(stderr, "%d check(s) failed.\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("All cache checks passed.\n");
+    return EXIT_SUCCESS;
+}